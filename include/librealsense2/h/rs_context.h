@@ -43,6 +43,9 @@ rs2_context* rs2_create_context(int api_version, rs2_error** error);
 *             raw: leave all formats from camera as they are
 *         options-update-interval: 1000 - (uint32_t) time interval in milliseconds for option value change notifications
 *             (see rs2_set_options_changed_callback)
+*         trace-file: ""                - (string) record the time frames spend in each pipeline stage (backend, metadata
+*             parsing, format conversion, syncer, processing blocks, user callbacks) for as long as the context exists,
+*             then write it to this file in Chrome trace format (view in chrome://tracing or ui.perfetto.dev)
 * \param[out] error  If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
 * \return            Context object
 */
@@ -48,6 +48,20 @@ int rs2_device_list_contains(const rs2_device_list* info_list, const rs2_device*
 */
 rs2_device* rs2_create_device(const rs2_device_list* info_list, int index, rs2_error** error);
 
+/**
+* Creates all the devices in a list. Rather than one after the other, devices are initialized concurrently, so the time
+* it takes is closer to that of the slowest device than to the sum of all of them.
+* A device that fails to be created does not affect the others.
+* \param[in]  info_list the list containing the devices to create
+* \param[out] devices   Array of rs2_get_device_count() entries, receiving the devices in list order: each should be
+*                       released by rs2_delete_device, or is null if the device could not be created
+* \param[out] errors    Optional array of rs2_get_device_count() entries, receiving for each device that could not be
+*                       created the reason (to be released by rs2_free_error), or null
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               The number of devices created
+*/
+int rs2_create_devices(const rs2_device_list* info_list, rs2_device** devices, rs2_error** errors, rs2_error** error);
+
 /**
 * Delete RealSense device
 * \param[in]  device    Realsense device to delete
@@ -60,6 +74,15 @@ void rs2_delete_device(rs2_device* device);
 */
 int rs2_device_is_connected( const rs2_device * device, rs2_error ** error );
 
+/**
+* Get statistics of the device: for now, the time spent in each phase of its creation ("open-phases", in order, each
+* with its "name" and duration in "ms"). Empty for devices whose creation was not timed.
+* \param[in]  device    The RealSense device
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return  JSON object as rs2_raw_data_buffer, should be released by rs2_delete_raw_data
+*/
+const rs2_raw_data_buffer* rs2_get_device_statistics(const rs2_device* device, rs2_error** error);
+
 /**
 * Retrieve camera specific information, like versions of various internal components.
 * \param[in]  device    The RealSense device
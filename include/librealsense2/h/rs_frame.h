@@ -80,6 +80,13 @@ typedef enum rs2_frame_metadata_value
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata);
 const char* rs2_frame_metadata_value_to_string(rs2_frame_metadata_value metadata);
 
+/** \brief A frame metadata attribute and its value, as returned by rs2_get_all_frame_metadata */
+typedef struct rs2_frame_metadata_entry
+{
+    rs2_frame_metadata_value key;
+    rs2_metadata_type value;
+} rs2_frame_metadata_entry;
+
 /** \brief Calibration target type. */
 typedef enum rs2_calib_target_type
 {
@@ -108,6 +115,17 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve all the metadata the frame has, in one call: much cheaper than calling rs2_supports_frame_metadata and
+* rs2_get_frame_metadata for each attribute
+* \param[in] frame          handle returned from a callback
+* \param[out] entries       filled with the supported attributes and their values, in rs2_frame_metadata_value order
+* \param[in] capacity       number of entries available; RS2_FRAME_METADATA_COUNT is always enough
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                   the number of entries filled
+*/
+int rs2_get_all_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_entry* entries, int capacity, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
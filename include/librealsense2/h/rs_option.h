@@ -126,6 +126,9 @@ extern "C" {
         RS2_OPTION_GYRO_SENSITIVITY,/**< Control of the gyro sensitivity level, see rs2_gyro_sensitivity for values */
         RS2_OPTION_REGION_OF_INTEREST,/**< The rectangular area used from the streaming profile */
         RS2_OPTION_ROTATION,/**Rotates frames*/
+        RS2_OPTION_OUTPUT_DISTANCE, /**< Disparity to depth: output the distance in meters (RS2_FORMAT_DISTANCE) rather than Z16 */
+        RS2_OPTION_SYNC_TOLERANCE, /**< Syncer: largest difference, in milliseconds, between timestamps of frames in the same frameset; 0 for half a frame */
+        RS2_OPTION_SYNC_DEADLINE, /**< Syncer: longest time, in milliseconds, a frameset waits for missing frames before it is released without them. The syncer allows 0 (its default) to wait as long as they're expected; the multi-device syncer always has a deadline, 1 to 5000 with 100 by default, as devices that drop out cannot be told apart from late ones */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
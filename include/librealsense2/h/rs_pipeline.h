@@ -218,6 +218,17 @@ extern "C" {
     */
     rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_error ** error);
 
+    /**
+    * Return runtime statistics of the active pipeline: those of its syncer and aggregator (including the number of
+    * framesets waiting to be read, and those that were replaced before they were), and of each streaming sensor.
+    * The method returns a valid result only when the pipeline is active - between calls to \c start() and \c stop().
+    *
+    * \param[in] pipe    a pointer to an instance of the pipeline
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return  JSON object as rs2_raw_data_buffer, should be released by rs2_delete_raw_data
+    */
+    const rs2_raw_data_buffer* rs2_pipeline_get_statistics(rs2_pipeline* pipe, rs2_error ** error);
+
     /**
     * Retrieve the device used by the pipeline.
     * The device class provides the application access to control camera additional settings -
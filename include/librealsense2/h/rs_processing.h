@@ -35,6 +35,17 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates a Sync processing block for frames from several devices. Frames of each device are matched among themselves,
+* like the Sync processing block does, and the results are matched across devices by timestamp, into composite frames
+* of all the devices. Devices should stream with global timestamps (see RS2_OPTION_GLOBAL_TIME_ENABLED) for their
+* timestamps to be comparable.
+* The RS2_OPTION_SYNC_TOLERANCE option controls how far apart frames of the same frameset may be; RS2_OPTION_SYNC_DEADLINE
+* bounds how long a frameset waits for missing devices, after which it is released without them.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -147,6 +158,15 @@ void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* qu
 */
 void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error** error);
 
+/**
+* Get runtime statistics of the processing block: frames and bytes processed, a histogram of the processing time, and
+* the counters of the frames it output. Counters are monotonic and always on.
+* \param[in] block          Processing block
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return  JSON object as rs2_raw_data_buffer, should be released by rs2_delete_raw_data
+*/
+const rs2_raw_data_buffer* rs2_get_processing_block_statistics(const rs2_processing_block* block, rs2_error** error);
+
 /**
 * Deletes the processing block
 * \param[in] block          Processing block
@@ -356,6 +356,16 @@ rs2_stream_profile_list * rs2_get_debug_stream_profiles( rs2_sensor * sensor, rs
 */
 rs2_stream_profile_list* rs2_get_active_streams(rs2_sensor* sensor, rs2_error** error);
 
+/**
+* Get runtime statistics of the frames the sensor produced since it was created: counters of frames, bytes and frame
+* buffers (recycled vs. newly allocated), frames currently held, and latency histograms of the format converters and
+* the user callback. Counters are monotonic and always on.
+* \param[in] sensor  input RealSense subdevice
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return  JSON object as rs2_raw_data_buffer, should be released by rs2_delete_raw_data
+*/
+const rs2_raw_data_buffer* rs2_get_sensor_statistics(const rs2_sensor* sensor, rs2_error** error);
+
 /**
 * Get pointer to specific stream profile
 * \param[in] list        the list of supported profiles returned by rs2_get_supported_profiles
@@ -170,6 +170,27 @@ namespace rs2
             return connected;
         }
 
+        /**
+        * Retrieves statistics of the device, e.g. the time spent in each phase of its creation
+        * \return JSON object, as a string
+        */
+        std::string get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_device_statistics(_dev.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         template<class T>
         bool is() const
         {
@@ -1092,6 +1113,41 @@ namespace rs2
             return size;
         }
 
+        /**
+        * Create all the devices in the list, initializing them concurrently
+        * \param[out] errors  if not null, receives for each device that could not be created the reason, or an empty
+        *                     string if it was created
+        * \return             the devices, in list order; a device that could not be created is left empty
+        */
+        std::vector< device > create_all( std::vector< std::string > * errors = nullptr ) const
+        {
+            auto const n = size();
+            std::vector< rs2_device * > raw_devices( n, nullptr );
+            std::vector< rs2_error * > raw_errors( n, nullptr );
+            rs2_error * e = nullptr;
+            rs2_create_devices( _list.get(), raw_devices.data(), raw_errors.data(), &e );
+            error::handle( e );
+
+            std::vector< device > res;
+            res.reserve( n );
+            if( errors )
+                errors->assign( n, std::string() );
+            for( uint32_t i = 0; i < n; ++i )
+            {
+                if( raw_devices[i] )
+                    res.push_back( device( std::shared_ptr< rs2_device >( raw_devices[i], rs2_delete_device ) ) );
+                else
+                    res.push_back( device() );
+                if( raw_errors[i] )
+                {
+                    if( errors )
+                        ( *errors )[i] = rs2_get_error_message( raw_errors[i] );
+                    rs2_free_error( raw_errors[i] );
+                }
+            }
+            return res;
+        }
+
         device front() const { return std::move((*this)[0]); }
         device back() const
         {
@@ -525,6 +525,19 @@ namespace rs2
             return r != 0;
         }
 
+        /** retrieve all the metadata the frame supports, in one call
+        * \return            the supported frame_metadata and their values, in rs2_frame_metadata_value order
+        */
+        std::vector<rs2_frame_metadata_entry> get_all_frame_metadata() const
+        {
+            std::vector<rs2_frame_metadata_entry> results(RS2_FRAME_METADATA_COUNT);
+            rs2_error* e = nullptr;
+            auto n = rs2_get_all_frame_metadata(frame_ref, results.data(), (int)results.size(), &e);
+            error::handle(e);
+            results.resize(n);
+            return results;
+        }
+
         /**
         * retrieve frame number (from frame handle)
         * \return               the frame number of the frame, in milliseconds since the device was started
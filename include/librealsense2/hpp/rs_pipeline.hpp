@@ -591,6 +591,29 @@ namespace rs2
             return pipeline_profile(p);
         }
 
+        /**
+        * Return runtime statistics of the syncer, the aggregator and the streaming sensors used by the pipeline.
+        * The method returns a valid result only when the pipeline is active - between calls to \c start() and \c stop().
+        *
+        * \return  JSON object, as a string
+        */
+        std::string get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_pipeline_get_statistics(_pipeline.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         operator std::shared_ptr<rs2_pipeline>() const
         {
             return _pipeline;
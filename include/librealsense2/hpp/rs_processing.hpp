@@ -291,6 +291,28 @@ namespace rs2
             rs2_process_frame(get(), ptr, &e);
             error::handle(e);
         }
+
+        /**
+        * Retrieves runtime statistics of the processing block: monotonic counters of the frames it processed and
+        * output, and a histogram of the processing time
+        * \return JSON object, as a string
+        */
+        std::string get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_processing_block_statistics(get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
         /**
         * constructor with already created low level processing block assigned.
         *
@@ -369,7 +391,8 @@ namespace rs2
         */
         rs2::frame process(rs2::frame frame) const override
         {
-            invoke(frame);
+            // Hand over our reference: a frame the caller gave up (process(std::move(f))) may then be reused in place
+            invoke(std::move(frame));
             rs2::frame f;
             if (!_queue.poll_for_frame(&f))
                 throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
@@ -693,6 +716,18 @@ namespace rs2
             return false;
         }
 
+        /**
+        * Set an option of the syncer; e.g., RS2_OPTION_SYNC_DEADLINE to release framesets without missing streams
+        * once they've waited long enough
+        */
+        void set_option(rs2_option option, float value) const { _sync.set_option(option, value); }
+        float get_option(rs2_option option) const { return _sync.get_option(option); }
+
+        /**
+        * Retrieves runtime statistics of the syncer, including how long framesets waited, as a JSON string
+        */
+        std::string get_statistics() const { return _sync.get_statistics(); }
+
         void operator()(frame f) const
         {
             _sync.invoke(std::move(f));
@@ -702,6 +737,99 @@ namespace rs2
         frame_queue _results;
     };
 
+    class asynchronous_multi_device_syncer : public processing_block
+    {
+    public:
+        /**
+        * Real asynchronous syncer within multi_device_syncer class
+        */
+        asynchronous_multi_device_syncer() : processing_block(init()) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_multi_device_sync_processing_block(&e),
+                rs2_delete_processing_block);
+
+            error::handle(e);
+            return block;
+        }
+    };
+
+    class multi_device_syncer
+    {
+    public:
+        /**
+        * Sync instance to combine frames from several devices, by their global timestamps
+        * \param[in] queue_size    Number of framesets to keep until they're consumed
+        * \param[in] tolerance_ms  Largest difference between timestamps of frames in the same frameset; 0 for half a frame
+        * \param[in] deadline_ms   Longest time a frameset waits for missing devices before it is released without them
+        */
+        multi_device_syncer(int queue_size = 1, float tolerance_ms = 0.f, float deadline_ms = 100.f)
+            :_results(queue_size)
+        {
+            _sync.set_option(RS2_OPTION_SYNC_TOLERANCE, tolerance_ms);
+            _sync.set_option(RS2_OPTION_SYNC_DEADLINE, deadline_ms);
+            _sync.start(_results);
+        }
+
+        /**
+        * Wait until a set of frames from all devices becomes available
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return Set of frames from all devices
+        */
+        frameset wait_for_frames(unsigned int timeout_ms = 5000) const
+        {
+            return frameset(_results.wait_for_frame(timeout_ms));
+        }
+
+        /**
+        * Check if a set of frames from all devices is available
+        * \param[out] fs      New frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool poll_for_frames(frameset* fs) const
+        {
+            frame result;
+            if (_results.poll_for_frame(&result))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * Wait until a set of frames from all devices becomes available
+        * \param[in] timeout_ms     Max time in milliseconds to wait until an available frame
+        * \param[out] fs            New frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool try_wait_for_frames(frameset* fs, unsigned int timeout_ms = 5000) const
+        {
+            frame result;
+            if (_results.try_wait_for_frame(&result, timeout_ms))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        void set_option(rs2_option option, float value) const { _sync.set_option(option, value); }
+        float get_option(rs2_option option) const { return _sync.get_option(option); }
+
+        void operator()(frame f) const
+        {
+            _sync.invoke(std::move(f));
+        }
+    private:
+        asynchronous_multi_device_syncer _sync;
+        frame_queue _results;
+    };
+
     /**
     Auxiliary processing block that performs image alignment using depth data and camera calibration
     */
@@ -266,6 +266,28 @@ namespace rs2
             return results;
         }
 
+        /**
+        * Retrieves runtime statistics of the frames the sensor produced: monotonic counters of frames, bytes and frame
+        * buffers, and latency histograms of the format converters and the user callback
+        * \return JSON object, as a string
+        */
+        std::string get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<const rs2_raw_data_buffer> buffer(
+                rs2_get_sensor_statistics(_sensor.get(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(buffer.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(buffer.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         /**
         * get the recommended list of filters by the sensor
         * \return   list of filters that recommended by sensor
@@ -107,6 +107,38 @@ void rs2_reset_logger( rs2_error ** error);
 */
 void rs2_enable_rolling_log_file( unsigned max_size, rs2_error ** error );
 
+/**
+* Write log lines to console and file from a background thread, so logging does not wait for I/O.
+* Lines are still formatted when logged; when more than queue_size lines are waiting to be written, further lines are
+* dropped rather than blocking, and a line noting how many were dropped is written later. Log callbacks are unaffected.
+* \param[in] queue_size max number of lines waiting to be written; 0 goes back to synchronous logging
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_async_logging( unsigned queue_size, rs2_error ** error );
+
+/**
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return              number of log lines dropped, since the start, because the async logging queue was full
+*/
+unsigned long long rs2_get_log_drop_count( rs2_error ** error );
+
+/**
+* Control which calls are kept in the API trace, per function. Only available when librealsense is built with TRACE_API.
+* Calls are recorded into a fixed-size buffer of the most recent calls, and their arguments are formatted only when the
+* trace is dumped, so tracing can be left on; sampling further limits the cost of calls made for every frame.
+* \param[in] function_name  the API function, e.g. "rs2_get_frame_data", or null for all functions
+* \param[in] every_nth      record one call out of every N; 0 to stop recording, 1 (the default) for every call
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_api_trace_sampling( const char * function_name, unsigned every_nth, rs2_error ** error );
+
+/**
+* Write out the recorded API calls, oldest first. Only available when librealsense is built with TRACE_API.
+* \param[in] file_path  the file to write to, or null to write to the log
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_dump_api_trace( const char * file_path, rs2_error ** error );
+
 
 unsigned rs2_get_log_message_line_number( rs2_log_message const * msg, rs2_error** error );
 const char * rs2_get_log_message_filename( rs2_log_message const * msg, rs2_error** error );
@@ -50,6 +50,44 @@ namespace rs2
         rs2_enable_rolling_log_file( max_size, &e );
         error::handle( e );
     }
+
+    // Write log lines to console and file from a background thread, so logging does not wait for I/O. When more than
+    // queue_size lines are waiting to be written, further lines are dropped rather than blocking.
+    //
+    // @param queue_size max number of lines waiting to be written; 0 goes back to synchronous logging
+    //
+    inline void enable_async_logging( unsigned queue_size = 4096 )
+    {
+        rs2_error * e = nullptr;
+        rs2_enable_async_logging( queue_size, &e );
+        error::handle( e );
+    }
+
+    // Number of log lines dropped, since the start, because the async logging queue was full
+    inline unsigned long long get_log_drop_count()
+    {
+        rs2_error * e = nullptr;
+        auto count = rs2_get_log_drop_count( &e );
+        error::handle( e );
+        return count;
+    }
+
+    // Record one call out of every N to an API function (or all, if null) in the API trace; 0 to stop recording it.
+    // Requires librealsense built with TRACE_API.
+    inline void set_api_trace_sampling( const char * function_name, unsigned every_nth )
+    {
+        rs2_error * e = nullptr;
+        rs2_set_api_trace_sampling( function_name, every_nth, &e );
+        error::handle( e );
+    }
+
+    // Write out the recorded API calls to a file, or to the log if null. Requires librealsense built with TRACE_API.
+    inline void dump_api_trace( const char * file_path = nullptr )
+    {
+        rs2_error * e = nullptr;
+        rs2_dump_api_trace( file_path, &e );
+        error::handle( e );
+    }
     
     /*
         Interface to the log message data we expose.
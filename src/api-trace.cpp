@@ -0,0 +1,92 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "api-trace.h"
+
+#include <iomanip>
+
+
+namespace librealsense {
+
+
+void api_trace::set_sampling( char const * function_name, unsigned every_nth )
+{
+    std::lock_guard< std::mutex > lock( _functions_mutex );
+    if( ! function_name || ! *function_name )
+    {
+        _default_sampling = every_nth;
+        _sampling.clear();
+        for( auto function : _functions )
+            function->set_sampling( every_nth );
+        return;
+    }
+    // The function may not have been called yet: it will pick this up when it registers
+    _sampling[function_name] = every_nth;
+    for( auto function : _functions )
+        if( ! strcmp( function->name(), function_name ) )
+            function->set_sampling( every_nth );
+}
+
+
+void api_trace::dump( std::ostream & os ) const
+{
+    std::vector< char const * > names;
+    {
+        std::lock_guard< std::mutex > lock( _functions_mutex );
+        for( auto function : _functions )
+            names.push_back( function->name() );
+    }
+
+    // Copy the entries out first, as fast as we can: writers keep going and will overwrite the oldest ones
+    std::vector< api_trace_entry > entries;
+    entries.reserve( capacity );
+    auto const end = _next.load( std::memory_order_acquire );
+    auto const begin = end > capacity ? end - capacity : 0;
+    for( auto index = begin; index < end; ++index )
+    {
+        auto const & slot = _records[index & ( capacity - 1 )];
+        auto const seq = slot.seq.load( std::memory_order_acquire );
+        if( seq != 2 * index + 2 )
+            continue;
+        entries.push_back( slot.entry );
+        std::atomic_thread_fence( std::memory_order_acquire );
+        if( slot.seq.load( std::memory_order_relaxed ) != seq || entries.back().function_id >= names.size() )
+            entries.pop_back();  // was being rewritten while we read it
+    }
+
+    api_object_names objects;
+    for( auto const & entry : entries )
+    {
+        auto const flags = entry.flags;
+        std::string const function = names[entry.function_id];
+        os << std::fixed << std::setprecision( 6 ) << entry.start_ns / 1e9 << " [" << entry.thread_id << "] ";
+        os.unsetf( std::ios_base::floatfield );
+        if( ( flags & api_trace_entry::pointer_result ) && ! ( flags & api_trace_entry::failed ) && entry.result )
+        {
+            // The returning "type" is the last word in the function name
+            os << objects.add( function.substr( function.find_last_of( '_' ) + 1 ), entry.result ) << " = ";
+        }
+        os << function << "(";
+        if( entry.format_args )
+            entry.format_args( os, entry.arg_names, entry.n_args, entry.args, objects );
+        os << ")";
+        if( ( flags & api_trace_entry::has_result ) && ! ( flags & api_trace_entry::pointer_result ) && entry.format_result )
+        {
+            os << " returned ";
+            entry.format_result( os, entry.result, objects );
+        }
+        os << ";";
+        if( entry.duration_ns >= 1000 )
+            os << " /* Took " << entry.duration_ns / 1000 << "us */";
+        if( flags & api_trace_entry::failed )
+            os << " /* FAILED */";
+        os << "\n";
+
+        // The first argument of a deleter is the object it releases
+        if( entry.n_args && ( ! function.compare( 0, 10, "rs2_delete" ) || ! function.compare( 0, 11, "rs2_release" ) ) )
+            objects.remove( entry.args[0] );
+    }
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,440 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include "core/enum-helpers.h"  // streaming of enum arguments
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// Dump-time naming of API objects: pointers returned from API calls are shown as "<type><index>" (e.g., "device2")
+// rather than memory addresses, which makes a trace much easier to follow. Pointers we did not see created (frames
+// handed to callbacks, for example) are named after the parameter they were passed in.
+//
+class api_object_names
+{
+    std::map< uint64_t, std::string > _names;
+    std::map< std::string, int > _counters;
+
+public:
+    std::string const & add( std::string const & type, uint64_t address )
+    {
+        auto & name = _names[address];
+        name = type + std::to_string( ++_counters[type] );
+        return name;
+    }
+
+    void remove( uint64_t address ) { _names.erase( address ); }
+
+    void stream( std::ostream & os, std::string const & param, uint64_t address )
+    {
+        if( ! address )
+        {
+            os << "nullptr";
+            return;
+        }
+        auto it = _names.find( address );
+        os << ( it != _names.end() ? it->second : add( param, address ) );
+    }
+};
+
+
+// How an argument (or a return value) is stored in a trace record, and how it is shown when the trace is dumped: the
+// hot path only copies raw bits, and formatting is deferred until dump time.
+//
+// api.h specializes this for output_arg.
+//
+template< class T, class Enable = void >
+struct api_trace_arg_traits
+{
+    // Anything that is not a scalar is not recorded
+    static uint64_t to_word( T const & ) { return 0; }
+    static void stream( std::ostream & os, std::string const &, uint64_t, api_object_names & ) { os << "{...}"; }
+};
+
+template< class T >
+struct api_trace_arg_traits< T *, void >
+{
+    // Pointers are never dereferenced: by the time we dump, the object may no longer exist
+    static uint64_t to_word( T * p ) { return reinterpret_cast< uintptr_t >( p ); }
+    static void stream( std::ostream & os, std::string const & param, uint64_t word, api_object_names & names )
+    {
+        names.stream( os, param, word );
+    }
+};
+
+template< class T >
+struct api_trace_arg_traits< T, typename std::enable_if< std::is_integral< T >::value || std::is_enum< T >::value >::type >
+{
+    static uint64_t to_word( T v ) { return static_cast< uint64_t >( v ); }
+    static void stream( std::ostream & os, std::string const &, uint64_t word, api_object_names & )
+    {
+        os << static_cast< T >( word );
+    }
+};
+
+template< class T >
+struct api_trace_arg_traits< T, typename std::enable_if< std::is_floating_point< T >::value >::type >
+{
+    static uint64_t to_word( T v )
+    {
+        double d = v;
+        uint64_t word;
+        std::memcpy( &word, &d, sizeof( word ) );
+        return word;
+    }
+    static void stream( std::ostream & os, std::string const &, uint64_t word, api_object_names & )
+    {
+        double d;
+        std::memcpy( &d, &word, sizeof( d ) );
+        os << d;
+    }
+};
+
+
+// Only this many arguments are recorded per call; the rest show as "..."
+constexpr int api_trace_max_args = 8;
+
+typedef void ( *api_args_formatter )( std::ostream &, char const * names, int n_args, uint64_t const * words, api_object_names & );
+typedef void ( *api_result_formatter )( std::ostream &, uint64_t word, api_object_names & );
+
+
+template< class... T >
+struct api_args_format;
+
+template<>
+struct api_args_format<>
+{
+    static void format( std::ostream &, char const *, int, uint64_t const *, api_object_names & ) {}
+};
+
+// Same name splitting as stream_args(): the names are the stringized arguments of the API macros
+template< class T, class... U >
+struct api_args_format< T, U... >
+{
+    static void format( std::ostream & os, char const * names, int n_args, uint64_t const * words, api_object_names & objects )
+    {
+        if( ! n_args )
+        {
+            os << "...";
+            return;
+        }
+        std::string name;
+        while( *names && *names != ',' )
+            name += *names++;
+        os << name << ':';
+        api_trace_arg_traits< typename std::decay< T >::type >::stream( os, name, *words, objects );
+        while( *names && ( *names == ',' || isspace( *names ) ) )
+            ++names;
+        if( sizeof...( U ) )
+            os << ", ";
+        api_args_format< U... >::format( os, names, n_args - 1, words + 1, objects );
+    }
+};
+
+template< class T >
+void format_api_result( std::ostream & os, uint64_t word, api_object_names & objects )
+{
+    api_trace_arg_traits< T >::stream( os, std::string(), word, objects );
+}
+
+
+// One API call, as kept in the trace buffer
+//
+struct api_trace_entry
+{
+    enum flags : uint8_t
+    {
+        failed = 1,
+        has_result = 2,
+        pointer_result = 4,
+    };
+
+    uint16_t function_id;
+    uint8_t flags;
+    uint8_t n_args;
+    uint32_t thread_id;
+    int64_t start_ns;
+    int64_t duration_ns;
+    char const * arg_names;
+    api_args_formatter format_args;
+    api_result_formatter format_result;
+    uint64_t result;
+    uint64_t args[api_trace_max_args];
+};
+
+struct api_trace_record
+{
+    // Written last; 2*index+2 once the entry is complete and odd while it is being written, so a dump running
+    // concurrently with writers can tell if what it read is whole
+    std::atomic< uint64_t > seq;
+    api_trace_entry entry;
+};
+
+
+class api_function;
+
+
+// Binary trace of API calls when built with TRACE_API: a fixed-size ring of the most recent calls, recorded without
+// any string handling. Arguments are only formatted when the trace is dumped.
+//
+// Functions are interned: each API function registers itself once, on its first call, and records refer to it by ID.
+// Each function is sampled individually: every call, every N-th call, or none.
+//
+class api_trace
+{
+public:
+    static constexpr size_t capacity = 8192;  // must be a power of 2
+
+    static api_trace & instance()
+    {
+        static api_trace the_trace;
+        return the_trace;
+    }
+
+    inline uint16_t register_function( api_function * function );
+
+    // Record one call out of every N for the named function (or for all functions if null); 0 to stop recording it,
+    // 1 for every call
+    void set_sampling( char const * function_name, unsigned every_nth );
+
+    // Write out the recorded calls, oldest first, one per line
+    void dump( std::ostream & os ) const;
+
+    api_trace_record & begin_record( uint64_t & index )
+    {
+        index = _next.fetch_add( 1, std::memory_order_relaxed );
+        auto & r = _records[index & ( capacity - 1 )];
+        r.seq.store( 2 * index + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        return r;
+    }
+
+    void end_record( api_trace_record & r, uint64_t index ) { r.seq.store( 2 * index + 2, std::memory_order_release ); }
+
+    int64_t now_ns() const
+    {
+        return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - _start )
+            .count();
+    }
+
+    static uint32_t thread_id()
+    {
+        static std::atomic< uint32_t > n_threads( 0 );
+        thread_local uint32_t const id = ++n_threads;
+        return id;
+    }
+
+private:
+    api_trace()
+        : _records( new api_trace_record[capacity]() )
+        , _next( 0 )
+        , _start( std::chrono::steady_clock::now() )
+        , _default_sampling( 1 )
+    {
+    }
+
+    std::unique_ptr< api_trace_record[] > _records;
+    std::atomic< uint64_t > _next;
+    std::chrono::steady_clock::time_point const _start;
+
+    mutable std::mutex _functions_mutex;
+    std::vector< api_function * > _functions;  // indexed by ID
+    std::map< std::string, unsigned > _sampling;
+    unsigned _default_sampling;
+};
+
+
+// Static description of one API function: BEGIN_API_CALL declares one, function-local, so it is created (and
+// registered) once, on the first call
+//
+class api_function
+{
+    char const * const _name;
+    std::atomic< unsigned > _sample_every;
+    std::atomic< unsigned > _calls;
+    uint16_t const _id;
+
+public:
+    explicit api_function( char const * name )
+        : _name( name )
+        , _sample_every( 1 )
+        , _calls( 0 )
+        , _id( api_trace::instance().register_function( this ) )
+    {
+    }
+
+    char const * name() const { return _name; }
+    uint16_t id() const { return _id; }
+
+    void set_sampling( unsigned every_nth ) { _sample_every.store( every_nth, std::memory_order_relaxed ); }
+
+    bool sample()
+    {
+        auto const every = _sample_every.load( std::memory_order_relaxed );
+        if( every <= 1 )
+            return every == 1;
+        return _calls.fetch_add( 1, std::memory_order_relaxed ) % every == 0;
+    }
+};
+
+
+uint16_t api_trace::register_function( api_function * function )
+{
+    std::lock_guard< std::mutex > lock( _functions_mutex );
+    auto it = _sampling.find( function->name() );
+    function->set_sampling( it != _sampling.end() ? it->second : _default_sampling );
+    _functions.push_back( function );
+    return static_cast< uint16_t >( _functions.size() - 1 );
+}
+
+
+// The API macros are given an error return value, which is empty for functions returning void
+inline std::true_type api_returns_void() { return {}; }
+template< class T >
+std::false_type api_returns_void( T && ) { return {}; }
+
+// Never actually returned: stands for the result of a function body that always throws
+struct api_no_result
+{
+    template< class T >
+    operator T() const { return T(); }
+};
+
+
+// Lives for the duration of an API call: if the call is sampled, it is timed and recorded on the way out
+//
+class api_call
+{
+    api_function & _function;
+    bool const _sampled;
+    bool _expected_failure = false;
+    uint8_t _flags = 0;
+    uint8_t _n_args = 0;
+    int64_t _start_ns = 0;
+    char const * _arg_names = nullptr;
+    api_args_formatter _format_args = nullptr;
+    api_result_formatter _format_result = nullptr;
+    uint64_t _result = 0;
+    uint64_t _args[api_trace_max_args];
+
+    void capture_args( uint64_t * ) {}
+
+    template< class T, class... U >
+    void capture_args( uint64_t * word, T const & first, U const &... rest )
+    {
+        if( word == _args + api_trace_max_args )
+            return;
+        *word = api_trace_arg_traits< T >::to_word( first );
+        capture_args( word + 1, rest... );
+    }
+
+    template< class F >
+    void do_invoke( F & func, std::true_type /*body is void*/, std::true_type /*function is void*/ )
+    {
+        func();
+    }
+
+    // A body that can only throw, in a function that returns something
+    template< class F >
+    api_no_result do_invoke( F & func, std::true_type /*body is void*/, std::false_type /*function is void*/ )
+    {
+        func();
+        return {};
+    }
+
+    template< class F, class V >
+    auto do_invoke( F & func, std::false_type /*body is void*/, V ) -> decltype( func() )
+    {
+        typedef decltype( func() ) R;
+        auto r = func();
+        if( _sampled )
+        {
+            _result = api_trace_arg_traits< R >::to_word( r );
+            _format_result = &format_api_result< R >;
+            _flags |= api_trace_entry::has_result;
+            if( std::is_pointer< R >::value )
+                _flags |= api_trace_entry::pointer_result;
+        }
+        return r;
+    }
+
+public:
+    explicit api_call( api_function & function )
+        : _function( function )
+        , _sampled( function.sample() )
+    {
+        if( _sampled )
+            _start_ns = api_trace::instance().now_ns();
+    }
+
+    api_call( api_call const & ) = delete;
+    api_call & operator=( api_call const & ) = delete;
+
+    void set_args( char const * ) {}
+
+    template< class... T >
+    void set_args( char const * names, T const &... args )
+    {
+        if( ! _sampled )
+            return;
+        _arg_names = names;
+        _format_args = &api_args_format< T... >::format;
+        _n_args = sizeof...( T ) < api_trace_max_args ? sizeof...( T ) : api_trace_max_args;
+        capture_args( _args, args... );
+    }
+
+    // Calls the function body; function_is_void is api_returns_void( R ), R being the error return value
+    template< class F, class V >
+    auto invoke( F & func, V function_is_void )
+        -> decltype( do_invoke( func, typename std::is_void< decltype( func() ) >::type(), function_is_void ) )
+    {
+        return do_invoke( func, typename std::is_void< decltype( func() ) >::type(), function_is_void );
+    }
+
+    // EXPECTED_EXCEPTION: the error is reported to the caller, but it is part of normal operation
+    void expect_failure() { _expected_failure = true; }
+    bool is_expected_failure() const { return _expected_failure; }
+
+    void fail() { _flags |= api_trace_entry::failed; }
+
+    ~api_call()
+    {
+        if( ! _sampled )
+            return;
+        auto & trace = api_trace::instance();
+        auto const end_ns = trace.now_ns();
+        uint64_t index;
+        auto & r = trace.begin_record( index );
+        auto & e = r.entry;
+        e.function_id = _function.id();
+        e.flags = _flags;
+        e.n_args = _n_args;
+        e.thread_id = api_trace::thread_id();
+        e.start_ns = _start_ns;
+        e.duration_ns = end_ns - _start_ns;
+        e.arg_names = _arg_names;
+        e.format_args = _format_args;
+        e.format_result = _format_result;
+        e.result = _result;
+        std::memcpy( e.args, _args, _n_args * sizeof( uint64_t ) );
+        trace.end_record( r, index );
+    }
+};
+
+
+}  // namespace librealsense
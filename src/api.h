@@ -8,6 +8,7 @@
 #include <rsutils/subscription.h>
 #include "pose.h"
 #include "librealsense-exception.h"
+#include "api-trace.h"
 
 #include <librealsense2/rs.h>
 #include <type_traits>
@@ -145,283 +146,113 @@ namespace librealsense
     }
 
 #ifdef TRACE_API
-    // API objects repository holds all live objects
-    // created from API calls and not released yet.
-    // This is useful for two tasks:
-    // 1. More easily follow API calls in logs
-    // 2. See a snapshot of all not deallocated objects
-    class api_objects
-    {
-    public:
-        // Define singleton
-        static api_objects& instance() {
-            static api_objects instance;
-            return instance;
-        }
-
-        // Place new object into the registry and give it a name
-        // according to the class type and the index of the instance
-        // to be presented in the log instead of the object memory address
-        std::string register_new_object(const std::string& type, const std::string& address)
-        {
-            std::lock_guard<std::mutex> lock(_m);
-            return internal_register(type, address);
-        }
-
-        // Given a list of parameters in form of "param:val,param:val"
-        // This function will replace all val that have alternative names in this repository
-        // with their names
-        // the function is used by the log with param = function input param name from the prototype,
-        // and val = the address of the param.
-        // the function will change the val field from memory address to instance class and index name
-        std::string augment_params(std::string p)
-        {
-            std::lock_guard<std::mutex> lock(_m);
-            std::string acc = "";
-            std::string res = "";
-            std::string param = "";
-            p += ",";
-            bool is_value = false;
-            for (auto i = 0; i < p.size(); i++)
-            {
-                if (p[i] == ':')
-                {
-                    param = acc;
-                    acc = "";
-                    is_value = true;
-                }
-                else if (is_value)
-                {
-                    if (p[i] == ',')
-                    {
-                        auto it = _names.find(acc);
-                        if (it != _names.end()) acc = it->second;
-                        else
-                        {
-                            // Heuristic: Assume things that are the same length
-                            // as pointers are in-fact pointers
-                            std::stringstream ss; ss << (int*)0;
-                            if (acc.size() == ss.str().size())
-                            {
-                                acc = internal_register(param, acc);
-                            }
-                        }
-                        res += param + ":" + acc;
-                        if (i != p.size() - 1) res += ",";
-                        acc = "";
-                        is_value = false;
-                    }
-                    else acc += p[i];
-                }
-                else acc += p[i];
-            }
-            return res;
-        }
-
-        // Mark that a certain object is de-allocated
-        void remove_object(const std::string& name)
-        {
-            std::lock_guard<std::mutex> lock(_m);
-            auto it = _names.find(name);
-            if (it != _names.end())
-                _names.erase(it);
-        }
-    private:
-        std::string internal_register(const std::string& type, const std::string& address)
-        {
-            auto it = _counters.find(type);
-            if (it == _counters.end()) _counters[type] = 0;
-            _counters[type]++;
-            std::stringstream ss;
-            ss << type << _counters[type];
-            _names[address] = ss.str();
-            return _names[address];
-        }
-
-        std::mutex _m;
-        std::map<std::string, std::string> _names;
-        std::map<std::string, int> _counters;
-    };
-
-    // This class wraps every API call and reports on it once its done
-    class api_logger
+    // Traced output arguments show only whether they were provided; their content is not known until the call returns
+    template<>
+    struct api_trace_arg_traits< output_arg >
     {
-    public:
-        api_logger(std::string function)
-            : _function(std::move(function)), _result(""), _param_str(""), _type(""),
-              _params([]() { return std::string{}; })
-        {
-            _start = std::chrono::high_resolution_clock::now();
-            LOG_DEBUG("/* Begin " << _function << " */");
-
-            // Define the returning "type" as the last word in function name
-            std::size_t found = _function.find_last_of("_");
-            _type = _function.substr(found + 1);
-
-            check_if_deleter("rs2_delete");
-            check_if_deleter("rs2_release");
-        }
-
-        // if the calling function is going to release an API object - remove it from the tracing list
-        void check_if_deleter(const char* prefix)
-        {
-            auto deleter_pos = _function.find(prefix);
-            if (deleter_pos == 0)
-            {
-                _is_deleter = true;
-            }
-        }
-
-        void set_return_value(std::string result)
-        {
-            _result = std::move(result);
-        }
-
-        void set_params(std::function<std::string()> params)
-        {
-            _params = std::move(params);
-        }
-
-        std::string get_params() { return _param_str = _params(); }
-
-        void report_error() { _error = true; }
-        void report_pointer_return_type() { _returns_pointer = true; }
-
-        ~api_logger()
+        static uint64_t to_word( output_arg const & arg ) { return reinterpret_cast< uintptr_t >( arg.pointer ); }
+        static void stream( std::ostream & os, std::string const &, uint64_t word, api_object_names & )
         {
-            auto d = std::chrono::high_resolution_clock::now() - _start;
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(d).count();
-            std::stringstream ss;
-            std::string prefix = "";
-            if (_param_str == "") _param_str = _params();
-
-            auto&& objs = api_objects::instance();
-            if (_returns_pointer)
-            {
-                prefix = objs.register_new_object(_type, _result) + " = ";
-                _result = "";
-            }
-            if (_is_deleter) objs.remove_object(_result);
-            if (_param_str != "") _param_str = objs.augment_params(_param_str);
-
-            ss << prefix << _function << "(" << _param_str << ")";
-            if (_result != "") ss << " returned " << _result;
-            ss << ";";
-            if (ms > 0) ss << " /* Took " << ms << "ms */";
-            if (_error) LOG_ERROR(ss.str());
-            else LOG_INFO(ss.str());
+            if( ! word )
+                os << "nullptr";
+            os << "(out)";
         }
-    private:
-        std::string _function, _result, _type, _param_str;
-        std::function<std::string()> _params;
-        bool _returns_pointer = false;
-        bool _is_deleter = false;
-        bool _error = false;
-        std::chrono::high_resolution_clock::time_point _start;
     };
 
-    // This dummy helper function lets us fetch return type from lambda
-    // this is used for result_printer, to be able to be used
-    // similarly for functions with and without return parameter
-    template<typename F, typename R>
-    R fetch_return_type(F& f, R(F::*mf)() const);
-
-    // Result printer class will capture lambda result value
-    // and pass it as string to the api logger
-    template<class T>
-    class result_printer
-    {
-    public:
-        result_printer(api_logger* logger) : _logger(logger) {}
-
-        template<class F>
-        T invoke(F func)
-        {
-            _res = func(); // Invoke lambda and save result for later
-            // I assume this will not have any side-effects, since it is applied
-            // to types that are about to be passed from C API
-            return _res;
-        }
-
-        ~result_printer()
-        {
-            std::stringstream ss; ss << _res;
-            _logger->set_return_value(ss.str());
-        }
-    private:
-        T _res;
-        api_logger* _logger;
-    };
+// Begin API macro interns the function (once) and redirects the function body into a lambda, so the return value can
+// be captured; the body itself is wrapped in a try so EXPECTED_EXCEPTION can be chained as usual.
+// The extra brace ensures api_call will die after everything else, when the call is recorded.
+#define BEGIN_API_CALL                                                                                                 \
+    {                                                                                                                  \
+        static librealsense::api_function __api_function( __FUNCTION__ );                                              \
+        librealsense::api_call __api_call( __api_function );                                                           \
+        auto func = [&]() { try
 
-    // Result printer class for T* should not dump memory content
-    template<class T>
-    class result_printer<T*>
-    {
-    public:
-        result_printer(api_logger* logger) : _logger(logger) {}
+// The exception is still reported to the caller (with the return value given to HANDLE_EXCEPTIONS_AND_RETURN), only
+// without being logged as an error
+#define EXPECTED_EXCEPTION( E, R, ... )                                                                                \
+    catch( E const & e )                                                                                               \
+    {                                                                                                                  \
+        if( error )                                                                                                    \
+        {                                                                                                              \
+            std::ostringstream ss;                                                                                     \
+            librealsense::stream_args( ss, #__VA_ARGS__, __VA_ARGS__ );                                                \
+            *error = new rs2_error{ e.what(), __api_function.name(), ss.str(), RS2_EXCEPTION_TYPE_COUNT };             \
+        }                                                                                                              \
+        __api_call.expect_failure();                                                                                   \
+        throw;                                                                                                         \
+    }
 
-        template<class F>
-        T* invoke(F func)
-        {
-            _res = func(); // Invoke lambda and save result for later
-                           // I assume this will not have any side-effects, since it is applied
-                           // to types that are about to be passed from C API
-            return _res;
-        }
+// The various return macros finish the lambda and invoke it through api_call, practically capturing the function
+// arguments and return value as raw values (formatting is left for when the trace is dumped)
+#define NOEXCEPT_RETURN( R, ... )                                                                                      \
+    catch( ... ) { throw; } };                                                                                         \
+    try                                                                                                                \
+    {                                                                                                                  \
+        __api_call.set_args( #__VA_ARGS__, __VA_ARGS__ );                                                              \
+        return __api_call.invoke( func, librealsense::api_returns_void( R ) );                                         \
+    }                                                                                                                  \
+    catch( ... )                                                                                                       \
+    {                                                                                                                  \
+        std::ostringstream ss;                                                                                         \
+        librealsense::stream_args( ss, #__VA_ARGS__, __VA_ARGS__ );                                                    \
+        rs2_error * e;                                                                                                 \
+        librealsense::translate_exception( __FUNCTION__, ss.str(), &e );                                               \
+        LOG_WARNING( rs2_get_error_message( e ) );                                                                     \
+        rs2_free_error( e );                                                                                           \
+        __api_call.fail();                                                                                             \
+        return R;                                                                                                      \
+    }                                                                                                                  \
+    }
 
-        ~result_printer()
-        {
-            std::stringstream ss; ss << (int*)_res; // Force case to int* to avoid char* and such
-            // being dumped to log
-            _logger->report_pointer_return_type();
-            _logger->set_return_value(ss.str());
-        }
-    private:
-        T* _res;
-        api_logger* _logger;
-    };
+#define HANDLE_EXCEPTIONS_AND_RETURN( R, ... )                                                                         \
+    catch( ... ) { throw; } };                                                                                         \
+    try                                                                                                                \
+    {                                                                                                                  \
+        __api_call.set_args( #__VA_ARGS__, __VA_ARGS__ );                                                              \
+        return __api_call.invoke( func, librealsense::api_returns_void( R ) );                                         \
+    }                                                                                                                  \
+    catch( ... )                                                                                                       \
+    {                                                                                                                  \
+        if( ! __api_call.is_expected_failure() )                                                                       \
+        {                                                                                                              \
+            std::ostringstream ss;                                                                                     \
+            librealsense::stream_args( ss, #__VA_ARGS__, __VA_ARGS__ );                                                \
+            librealsense::translate_exception( __FUNCTION__, ss.str(), error );                                        \
+        }                                                                                                              \
+        __api_call.fail();                                                                                             \
+        return R;                                                                                                      \
+    }                                                                                                                  \
+    }
 
-    // To work-around the fact that void can't be "stringified"
-    // we define an alternative printer just for void returning lambdas
-    template<>
-    class result_printer<void>
-    {
-    public:
-        result_printer(api_logger* logger) {}
-        template<class F>
-        void invoke(F func) { func(); }
-    };
+#define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN( R )                                                                       \
+    catch( ... ) { throw; } };                                                                                         \
+    try                                                                                                                \
+    {                                                                                                                  \
+        __api_call.set_args( "" );                                                                                     \
+        return __api_call.invoke( func, librealsense::api_returns_void( R ) );                                         \
+    }                                                                                                                  \
+    catch( ... )                                                                                                       \
+    {                                                                                                                  \
+        librealsense::translate_exception( __FUNCTION__, "", error );                                                  \
+        __api_call.fail();                                                                                             \
+        return R;                                                                                                      \
+    }                                                                                                                  \
+    }
 
-// Begin API macro defines new API logger and redirects function body into a lambda
-// The extra brace ensures api_logger will die after everything else
-#define BEGIN_API_CALL { api_logger __api_logger(__FUNCTION__); {\
-auto func = [&](){
-
-// The various return macros finish the lambda and invoke it using the type printer
-// practically capturing function return value
-// In addition, error flag and function parameters are captured into the API logger
-#define NOEXCEPT_RETURN(R, ...) };\
-result_printer<decltype(fetch_return_type(func, &decltype(func)::operator()))> __p(&__api_logger);\
-__api_logger.set_params([&](){ std::ostringstream ss; librealsense::stream_args(ss, #__VA_ARGS__, __VA_ARGS__); return ss.str(); });\
-try {\
-return __p.invoke(func);\
-} catch(...) {\
-rs2_error* e; librealsense::translate_exception(__FUNCTION__, __api_logger.get_params(), &e);\
-LOG_WARNING(rs2_get_error_message(e)); rs2_free_error(e); __api_logger.report_error(); return R; } } }
-
-#define HANDLE_EXCEPTIONS_AND_RETURN(R, ...) };\
-result_printer<decltype(fetch_return_type(func, &decltype(func)::operator()))> __p(&__api_logger);\
-__api_logger.set_params([&](){ std::ostringstream ss; librealsense::stream_args(ss, #__VA_ARGS__, __VA_ARGS__); return ss.str(); });\
-try {\
-return __p.invoke(func);\
-} catch(...) {\
-librealsense::translate_exception(__FUNCTION__, __api_logger.get_params(), error); __api_logger.report_error(); return R; } } }
-
-#define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(R, ...) };\
-result_printer<decltype(fetch_return_type(func, &decltype(func)::operator()))> __p(&__api_logger);\
-try {\
-return __p.invoke(func);\
-} catch(...) { librealsense::translate_exception(__FUNCTION__, "", error); __api_logger.report_error(); return R; } } }
+#define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN_VOID()                                                                     \
+    catch( ... ) { throw; } };                                                                                         \
+    try                                                                                                                \
+    {                                                                                                                  \
+        __api_call.set_args( "" );                                                                                     \
+        __api_call.invoke( func, std::true_type() );                                                                   \
+    }                                                                                                                  \
+    catch( ... )                                                                                                       \
+    {                                                                                                                  \
+        librealsense::translate_exception( __FUNCTION__, "", error );                                                  \
+        __api_call.fail();                                                                                             \
+    }                                                                                                                  \
+    }
 
 #else // No API tracing:
 
@@ -11,6 +11,7 @@ namespace librealsense
 {
     class frame_interface;
     class sensor_interface;
+    struct frame_source_statistics;
 
     class archive_interface
     {
@@ -29,11 +30,15 @@ namespace librealsense
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
         virtual void unpublish_frame(frame_interface* frame) = 0;
         virtual void keep_frame(frame_interface* frame) = 0;
+
+        // Frames published and not yet released
+        virtual uint32_t get_published_count() const = 0;
         virtual ~archive_interface() = default;
     };
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
-        std::shared_ptr<metadata_parser_map> parsers);
+        std::shared_ptr<metadata_parser_map> parsers,
+        std::shared_ptr<frame_source_statistics> const & statistics = nullptr);
 
 }
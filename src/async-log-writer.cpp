@@ -0,0 +1,123 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "async-log-writer.h"
+
+
+namespace librealsense {
+
+
+async_log_writer::async_log_writer( size_t capacity,
+                                    std::function< void( std::string const & line, uint8_t targets ) > write,
+                                    std::function< void() > flush )
+    : _write( std::move( write ) )
+    , _flush( std::move( flush ) )
+    , _ring( capacity ? capacity : 1 )
+{
+    _thread = std::thread( [this]() { run(); } );
+}
+
+
+async_log_writer::~async_log_writer()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _queued_cv.notify_one();
+    if( _thread.joinable() )
+        _thread.join();
+}
+
+
+bool async_log_writer::push( std::string & line, uint8_t targets )
+{
+    bool was_empty;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( _size == _ring.size() || _stopping )
+        {
+            ++_n_dropped;
+            _dropped_targets |= targets;
+            return false;
+        }
+        auto & e = _ring[( _head + _size ) % _ring.size()];
+        e.line.swap( line );
+        e.targets = targets;
+        was_empty = ! _size++;
+        ++_n_queued;
+    }
+    // The writer only ever waits on an empty ring
+    if( was_empty )
+        _queued_cv.notify_one();
+    return true;
+}
+
+
+void async_log_writer::drain()
+{
+    if( std::this_thread::get_id() == _thread.get_id() )
+        return;  // a write function that logs; waiting would deadlock
+    std::unique_lock< std::mutex > lock( _mutex );
+    auto const target = _n_queued;
+    _written_cv.wait( lock, [&]() { return _n_written >= target; } );
+}
+
+
+async_log_writer::statistics async_log_writer::get_statistics() const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return { _n_queued, _n_written, _n_dropped };
+}
+
+
+void async_log_writer::run()
+{
+    // The batch is taken out of the ring by swapping strings, so that the writing itself happens without the lock and
+    // pushing threads never wait for I/O
+    std::vector< entry > batch( _ring.size() );
+    std::string notice;
+    while( true )
+    {
+        size_t n = 0;
+        uint64_t newly_dropped = 0;
+        uint8_t dropped_targets = 0;
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            _queued_cv.wait( lock, [this]() { return _size || _stopping; } );
+            if( ! _size )
+                break;  // stopping, and nothing left
+            for( ; n < _size; ++n )
+            {
+                auto & e = _ring[( _head + n ) % _ring.size()];
+                batch[n].line.swap( e.line );
+                batch[n].targets = e.targets;
+            }
+            _head = ( _head + n ) % _ring.size();
+            _size = 0;
+            newly_dropped = _n_dropped - _n_dropped_reported;
+            _n_dropped_reported = _n_dropped;
+            dropped_targets = _dropped_targets;
+            _dropped_targets = 0;
+        }
+
+        for( size_t i = 0; i < n; ++i )
+            _write( batch[i].line, batch[i].targets );
+        if( newly_dropped )
+        {
+            notice = "-- " + std::to_string( newly_dropped ) + " log lines dropped: the asynchronous log queue was full\n";
+            _write( notice, dropped_targets );
+        }
+        if( _flush )
+            _flush();
+
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _n_written += n;
+        }
+        _written_cv.notify_all();
+    }
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,88 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Moves the writing of log lines off the threads that log them: lines are queued in a ring of fixed size and written
+// by a background thread. When the ring is full, new lines are dropped rather than making the logging thread wait; the
+// number dropped is counted, and a line noting it is written once there is room again.
+//
+// The ring's strings are reused, so once they have grown to the usual line length, queueing does not allocate.
+//
+class async_log_writer
+{
+public:
+    // Where a line should go; a line can go to both
+    enum target : uint8_t
+    {
+        to_console = 1,
+        to_file = 2,
+    };
+
+    struct statistics
+    {
+        uint64_t queued;   // lines accepted into the ring
+        uint64_t written;  // lines handed to the write function
+        uint64_t dropped;  // lines that found the ring full
+    };
+
+    // 'write' is called on the background thread only, for each line, and 'flush' after each batch of lines
+    async_log_writer( size_t capacity,
+                      std::function< void( std::string const & line, uint8_t targets ) > write,
+                      std::function< void() > flush );
+    ~async_log_writer();  // writes whatever is still queued
+
+    async_log_writer( async_log_writer const & ) = delete;
+    async_log_writer & operator=( async_log_writer const & ) = delete;
+
+    // Swaps 'line' into the ring (so, on return, it holds some old line's memory); false if it was dropped
+    bool push( std::string & line, uint8_t targets );
+
+    // Waits until everything queued so far has been written
+    void drain();
+
+    statistics get_statistics() const;
+
+private:
+    void run();
+
+    struct entry
+    {
+        std::string line;
+        uint8_t targets = 0;
+    };
+
+    std::function< void( std::string const &, uint8_t ) > _write;
+    std::function< void() > _flush;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _queued_cv;   // something was queued, or we're stopping
+    std::condition_variable _written_cv;  // a batch was written
+    std::vector< entry > _ring;
+    size_t _head = 0;   // next to write
+    size_t _size = 0;   // number queued
+    bool _writing = false;  // the background thread holds a batch it's writing
+    bool _stopping = false;
+
+    uint64_t _n_queued = 0;
+    uint64_t _n_written = 0;
+    uint64_t _n_dropped = 0;
+    uint64_t _n_dropped_reported = 0;
+    uint8_t _dropped_targets = 0;  // where the lines dropped since the last notice would have gone
+
+    std::thread _thread;
+};
+
+
+}  // namespace librealsense
@@ -43,6 +43,11 @@ public:
     {
         return first()->find_metadata( frame_metadata, p_output_value );
     }
+
+    int find_all_metadata( rs2_frame_metadata_entry * entries, int capacity ) const override
+    {
+        return first()->find_all_metadata( entries, capacity );
+    }
     int get_frame_data_size() const override { return first()->get_frame_data_size(); }
     const uint8_t * get_frame_data() const override { return first()->get_frame_data(); }
     rs2_time_t get_frame_timestamp() const override { return first()->get_frame_timestamp(); }
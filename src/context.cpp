@@ -9,6 +9,7 @@
 #include "dds/rsdds-device-factory.h"
 #endif
 #include "rscore-pp-block-factory.h"
+#include "pipeline-trace.h"
 
 #include <librealsense2/hpp/rs_types.hpp>  // rs2_devices_changed_callback
 #include <librealsense2/rs.h>              // RS2_API_FULL_VERSION_STR
@@ -59,6 +60,10 @@ namespace librealsense {
 
          _settings = load_settings( settings );  // global | application | local
          _device_mask = _settings.nested( "device-mask" ).default_value< unsigned >( RS2_PRODUCT_LINE_ANY );
+
+         auto const & trace_file = _settings.nested( "trace-file" ).string_ref_or_empty();
+         if( ! trace_file.empty() )
+             _trace = pipeline_trace::start( trace_file );
     }
 
 
@@ -13,6 +13,7 @@ namespace librealsense
     class device_factory;
     class device_info;
     class processing_block_interface;
+    class pipeline_trace;
 
 
     class context
@@ -82,6 +83,8 @@ namespace librealsense
         unsigned _device_mask;
 
         std::vector< std::shared_ptr< device_factory > > _factories;
+
+        std::shared_ptr< pipeline_trace > _trace;  // if 'trace-file' is in the settings
     };
 
 }
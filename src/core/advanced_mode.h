@@ -10,6 +10,9 @@
 #include "serializable-interface.h"
 #include <rsutils/lazy.h>
 
+#include <map>
+#include <mutex>
+
 
 typedef enum
 {
@@ -210,6 +213,17 @@ namespace librealsense
         bool _blocked = false;
         std::string _block_message;
 
+        // What we last wrote to (or read from) each group, so unchanged groups need not be written again.
+        // Off by default: writes that bypass this class (RS2_OPTION_DEPTH_UNITS, raw hw-monitor commands, other
+        // processes) are not seen here and would leave the shadow stale.
+        mutable std::mutex _shadow_mutex;
+        mutable std::map< EtAdvancedModeRegGroup, std::vector< uint8_t > > _shadow;
+        bool _use_shadow = false;
+        bool _apply_between_frames = false;
+
+        void update_shadow( EtAdvancedModeRegGroup, uint8_t const * data, size_t size ) const;
+        void invalidate_shadow();
+
         preset get_all() const;
         void set_all( const preset & p );
         void set_all_depth( const preset & p );
@@ -221,17 +235,23 @@ namespace librealsense
         template<class T>
         void set(const T& strct, EtAdvancedModeRegGroup cmd) const
         {
-            if( _blocked )
-                throw std::runtime_error( _block_message );
-
-            auto ptr = (uint8_t*)(&strct);
-            std::vector<uint8_t> data(ptr, ptr + sizeof(T));
+            set_batch( { set_command( strct, cmd ) } );
+        }
 
-            assert_no_error(ds::fw_cmd::SET_ADV,
-                send_receive(encode_command(ds::fw_cmd::SET_ADV, static_cast<uint32_t>(cmd), 0, 0, 0, data)));
-            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        // A SET_ADV command for set_batch()
+        template<class T>
+        static command set_command(const T& strct, EtAdvancedModeRegGroup cmd)
+        {
+            command c( static_cast< uint8_t >( ds::fw_cmd::SET_ADV ), static_cast< uint32_t >( cmd ) );
+            auto ptr = (uint8_t const *)(&strct);
+            c.data.assign(ptr, ptr + sizeof(T));
+            return c;
         }
 
+        // Like set(), for several groups at once. With the shadow enabled, groups already holding these values are skipped.
+        void set_batch( std::vector< command > const & cmds ) const;
+        void wait_for_frame_boundary() const;
+
         template<class T>
         T get(EtAdvancedModeRegGroup cmd, T* ptr = static_cast<T*>(nullptr), int mode = 0) const
         {
@@ -244,6 +264,8 @@ namespace librealsense
                 throw std::runtime_error("The camera returned invalid sized result!");
             }
             res = *reinterpret_cast<T*>(data.data());
+            if( mode == 0 )  // current values, not min/max
+                update_shadow( cmd, data.data(), sizeof( T ) );
             return res;
         }
 
@@ -31,10 +31,7 @@ enum frame_metadata_internal
 class md_attribute_parser_base;
 
 
-// multimap is necessary here in order to permit registration to some metadata value in multiple
-// places in metadata as it is required for D405, in which exposure should be available from the
-// same sensor both for depth and color frames
-typedef std::multimap< rs2_frame_metadata_value, std::shared_ptr< md_attribute_parser_base > > metadata_parser_map;
+class metadata_parser_map;  // see metadata-parser.h
 
 #pragma pack( push, 1 )
 struct metadata_array_value
@@ -24,6 +24,8 @@ public:
     virtual frame_header const & get_header() const = 0;
 
     virtual bool find_metadata( rs2_frame_metadata_value, rs2_metadata_type * p_output_value ) const = 0;
+    // Fills up to 'capacity' entries with all the (public) metadata the frame has; returns how many were filled
+    virtual int find_all_metadata( rs2_frame_metadata_entry * entries, int capacity ) const = 0;
     virtual int get_frame_data_size() const = 0;
     virtual const uint8_t * get_frame_data() const = 0;
     virtual rs2_time_t get_frame_timestamp() const = 0;
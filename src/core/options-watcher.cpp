@@ -11,9 +11,13 @@ using rsutils::json;
 namespace librealsense {
 
 
+/*static*/ const std::chrono::milliseconds options_watcher::coalesce_window( 50 );
+
+
 options_watcher::options_watcher( std::chrono::milliseconds update_interval )
     : _update_interval( update_interval )
     , _destructing( false )
+    , _set_pending( false )
 {
 }
 
@@ -23,11 +27,34 @@ options_watcher::~options_watcher()
     stop();
 }
 
-void options_watcher::register_option( rs2_option id, std::shared_ptr< option > option )
+void options_watcher::configure( json const & settings )
+{
+    if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
+    {
+        auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
+        set_update_interval( std::chrono::milliseconds( interval ) );
+    }
+    if( auto intervals_j = settings.nested( std::string( "options-update-intervals", 24 ) ) )
+    {
+        for( auto it = intervals_j.begin(); it != intervals_j.end(); ++it )
+        {
+            auto interval = it.value().get< uint32_t >();  // NOTE: can throw!
+            _update_intervals_by_name[it.key()] = std::chrono::milliseconds( interval );
+        }
+    }
+}
+
+void options_watcher::register_option( rs2_option id, std::shared_ptr< option > option, std::string const & name )
 {
     {
         std::lock_guard< std::mutex > lock( _mutex );
-        _options[id] = { option };
+        auto & watched = _options[id];
+        watched = {};
+        watched.current.sptr = option;
+        watched.type = option->get_value_type();
+        auto it = _update_intervals_by_name.find( name );
+        if( it != _update_intervals_by_name.end() )
+            watched.update_interval = it->second;
     }
 
     if( should_start() )
@@ -45,6 +72,28 @@ void options_watcher::unregister_option( rs2_option id )
         stop();
 }
 
+void options_watcher::set_update_interval( rs2_option id, std::chrono::milliseconds update_interval )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    auto it = _options.find( id );
+    if( it != _options.end() )
+        it->second.update_interval = update_interval;
+}
+
+void options_watcher::notify_set( rs2_option id )
+{
+    if( should_stop() )
+        return;  // Nobody's watching
+
+    {
+        // The updater waits under _pending_mutex, so it either sees this or gets the notification
+        std::lock_guard< std::mutex > lock( _pending_mutex );
+        _pending_sets.push_back( id );
+        _set_pending = true;
+    }
+    _wakeup.notify_all();
+}
+
 rsutils::subscription options_watcher::subscribe( callback && cb )
 {
     rsutils::subscription ret = _on_values_changed.subscribe( std::move( cb ) );
@@ -78,7 +127,11 @@ void options_watcher::start()
 
 void options_watcher::stop()
 {
-    _stopping.notify_all();
+    {
+        // Make sure the updater is either waiting, and gets the notification, or yet to check should_stop()
+        std::lock_guard< std::mutex > lock( _pending_mutex );
+    }
+    _wakeup.notify_all();
     if( _updater.joinable() )
     {
         try
@@ -92,14 +145,35 @@ void options_watcher::stop()
     }
 }
 
+std::chrono::milliseconds options_watcher::get_update_interval( watched_option const & watched ) const
+{
+    return watched.update_interval.count() ? watched.update_interval : _update_interval;
+}
+
+options_watcher::clock::time_point options_watcher::next_update_time() const
+{
+    auto next = clock::now() + _update_interval;
+    for( auto & id_watched : _options )
+        if( id_watched.second.next_update < next )
+            next = id_watched.second.next_update;
+    return next;
+}
+
 void options_watcher::thread_loop()
 {
     // Checking should_stop because subscriptions can be canceled without us knowing
     while( ! should_stop() )
     {
+        clock::time_point next_update;
         {
-            std::unique_lock< std::mutex > lock( _mutex );
-            _stopping.wait_for( lock, _update_interval );
+            std::lock_guard< std::mutex > lock( _mutex );
+            next_update = next_update_time();
+        }
+        {
+            // Waiting under _pending_mutex rather than _mutex, so notify_set() can take it without waiting for an
+            // update in progress
+            std::unique_lock< std::mutex > lock( _pending_mutex );
+            _wakeup.wait_until( lock, next_update, [this]() { return _set_pending || should_stop(); } );
         }
 
         // Checking for stop conditions after sleep.
@@ -116,6 +190,32 @@ void options_watcher::thread_loop()
     }
 }
 
+// Option values are simple: rather than a generic JSON comparison, compare according to the option type
+static bool is_same_value( rs2_option_type type, json const & prev, json const & curr )
+{
+    if( prev.is_null() || curr.is_null() )
+        return prev.is_null() && curr.is_null();
+    switch( type )
+    {
+    case RS2_OPTION_TYPE_FLOAT:
+    case RS2_OPTION_TYPE_INTEGER:
+        if( prev.is_number() && curr.is_number() )
+            return prev.get< double >() == curr.get< double >();
+        break;
+    case RS2_OPTION_TYPE_BOOLEAN:
+        if( prev.is_boolean() && curr.is_boolean() )
+            return prev.get< bool >() == curr.get< bool >();
+        break;
+    case RS2_OPTION_TYPE_STRING:
+        if( prev.is_string() && curr.is_string() )
+            return prev.string_ref() == curr.string_ref();
+        break;
+    default:
+        break;
+    }
+    return prev == curr;
+}
+
 options_watcher::options_and_values options_watcher::update_options()
 {
     options_and_values updated_options;
@@ -125,28 +225,52 @@ options_watcher::options_and_values options_watcher::update_options()
     if( should_stop() )
         return updated_options;
 
-    for( auto & opt : _options )
+    // Options that were just set are due now
+    std::vector< rs2_option > just_set;
+    {
+        std::lock_guard< std::mutex > pending_lock( _pending_mutex );
+        just_set.swap( _pending_sets );
+        _set_pending = false;
+    }
+    for( auto id : just_set )
     {
+        auto it = _options.find( id );
+        if( it != _options.end() )
+            it->second.next_update = clock::time_point();
+    }
+
+    // Anything due soon is updated now, too, so we don't wake up again just for it
+    auto const now = clock::now();
+    auto const due = now + coalesce_window;
+
+    for( auto & id_watched : _options )
+    {
+        auto & watched = id_watched.second;
+        if( watched.next_update > due )
+            continue;
+        watched.next_update = now + get_update_interval( watched );
+
+        auto & opt = watched.current;
         try
         {
             json curr_val;
-            if( opt.second.sptr->is_enabled() )
-                curr_val = opt.second.sptr->get_value();
+            if( opt.sptr->is_enabled() )
+                curr_val = opt.sptr->get_value();
 
-            if( ! opt.second.p_last_known_value || *opt.second.p_last_known_value != curr_val )
+            if( ! opt.p_last_known_value || ! is_same_value( watched.type, *opt.p_last_known_value, curr_val ) )
             {
-                opt.second.p_last_known_value = std::make_shared< const json >( std::move( curr_val ) );
-                updated_options[opt.first] = opt.second;
+                opt.p_last_known_value = std::make_shared< const json >( std::move( curr_val ) );
+                updated_options[id_watched.first] = opt;
             }
         }
         catch( ... )
         {
             // Some options cannot be queried all the time (i.e. streaming only) - so if we HAD a value, it needs to be
             // removed!
-            if( opt.second.p_last_known_value && ! opt.second.p_last_known_value->is_null() )
+            if( opt.p_last_known_value && ! opt.p_last_known_value->is_null() )
             {
-                opt.second.p_last_known_value = std::make_shared< const json >();
-                updated_options[opt.first] = opt.second;
+                opt.p_last_known_value = std::make_shared< const json >();
+                updated_options[id_watched.first] = opt;
             }
         }
 
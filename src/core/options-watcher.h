@@ -10,11 +10,14 @@
 #include <rsutils/json-fwd.h>
 
 #include <map>
+#include <vector>
+#include <string>
 #include <chrono>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <atomic>
 
 
 namespace librealsense {
@@ -24,6 +27,14 @@ namespace librealsense {
 // When a user subscribes to notification the options_watcher will automatically update (query) registered options
 // values in set time intervals (creates a thread). If one or more of the values have changed the watcher will notify
 // through the callback subscription.
+//
+// Each option can have its own update interval, so options that rarely change (or only change when we change them)
+// need not be queried as often as, e.g., temperatures. Options whose update times fall close together are queried in
+// the same pass, so the device sees fewer, larger bursts of requests.
+//
+// Options changed through librealsense do not have to wait for their next update: call notify_set() and the option
+// will be re-queried right away.
+//
 class options_watcher
 {
 public:
@@ -35,17 +46,34 @@ public:
 
     using options_and_values = std::map< rs2_option, option_and_value >;
     using callback = std::function< void( options_and_values const & ) >;
+    using clock = std::chrono::steady_clock;
 
 public:
     options_watcher( std::chrono::milliseconds update_interval = std::chrono::milliseconds( 1000 ) );
     ~options_watcher();
 
-    void register_option( rs2_option id, std::shared_ptr< option > option );
+    // Take update intervals from the context settings:
+    //     "options-update-interval": 1000          // msec; the default for all options
+    //     "options-update-intervals": {            // msec, per option name; these override the default
+    //         "Exposure": 5000,
+    //         "Asic Temperature": 500
+    //     }
+    // Must be called before options are registered. Throws on invalid values.
+    void configure( rsutils::json const & settings );
+
+    // The name is used to look up any per-option interval from the settings
+    void register_option( rs2_option id, std::shared_ptr< option > option, std::string const & name = {} );
     void unregister_option( rs2_option id );
 
     rsutils::subscription subscribe( callback && cb );
 
+    // Sets the default interval, for options that do not have their own
     void set_update_interval( std::chrono::milliseconds update_interval ) { _update_interval = update_interval; }
+    // Zero to go back to the default interval
+    void set_update_interval( rs2_option id, std::chrono::milliseconds update_interval );
+
+    // Let the watcher know an option was just set, so it can pick up the new value without waiting
+    void notify_set( rs2_option id );
 
 protected:
     bool should_start() const;
@@ -56,13 +84,34 @@ protected:
     virtual options_and_values update_options();
     void notify( options_and_values const & updated_options );
 
-    options_and_values _options;
+    // Options due within this window of each other are updated together
+    static const std::chrono::milliseconds coalesce_window;
+
+    struct watched_option
+    {
+        option_and_value current;
+        rs2_option_type type = RS2_OPTION_TYPE_FLOAT;
+        std::chrono::milliseconds update_interval{ 0 };  // zero for the default
+        clock::time_point next_update;                   // default (epoch) means ASAP
+    };
+
+    std::chrono::milliseconds get_update_interval( watched_option const & ) const;
+    clock::time_point next_update_time() const;  // under lock
+
+    std::map< rs2_option, watched_option > _options;
+    std::map< std::string, std::chrono::milliseconds > _update_intervals_by_name;
     rsutils::signal< options_and_values const & > _on_values_changed;
     std::chrono::milliseconds _update_interval;
     std::thread _updater;
     std::mutex _mutex;
-    std::condition_variable _stopping;
+    std::condition_variable _wakeup;
     std::atomic_bool _destructing;
+
+    // notify_set() must not wait for an update in progress, so it does not take _mutex; the updater waits for it (and
+    // for stop) on _wakeup, under _pending_mutex
+    std::mutex _pending_mutex;
+    std::vector< rs2_option > _pending_sets;
+    std::atomic_bool _set_pending;
 };
 
 
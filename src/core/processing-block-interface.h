@@ -5,6 +5,7 @@
 #include "info-interface.h"
 #include "options-interface.h"
 #include <src/types.h>
+#include <rsutils/json-fwd.h>
 
 #include <vector>
 #include <memory>
@@ -28,6 +29,9 @@ public:
     virtual void set_output_callback( rs2_frame_callback_sptr callback ) = 0;
     virtual void invoke( frame_holder frame ) = 0;
     virtual synthetic_source_interface & get_source() = 0;
+
+    // Runtime counters and latencies, as a JSON object
+    virtual rsutils::json get_statistics() const = 0;
 };
 
 
@@ -58,6 +58,9 @@ public:
     virtual void set_frames_callback( rs2_frame_callback_sptr cb ) = 0;
 
     virtual rsutils::subscription register_options_changed_callback( options_watcher::callback && cb ) = 0;
+
+    // Runtime counters and latencies of the frames going through the sensor, as a JSON object
+    virtual rsutils::json get_statistics() const = 0;
 };
 
 
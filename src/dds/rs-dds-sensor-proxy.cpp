@@ -7,6 +7,7 @@
 #include <src/software-device.h>
 
 #include <realdds/dds-device.h>
+#include <realdds/dds-participant.h>
 #include <realdds/dds-time.h>
 #include <realdds/dds-sample.h>
 #include <realdds/dds-exceptions.h>
@@ -42,12 +43,13 @@ dds_sensor_proxy::dds_sensor_proxy( std::string const & sensor_name,
     , _name( sensor_name )
     , _md_enabled( dev->supports_metadata() )
 {
-    rsutils::json const & settings = owner->get_context()->get_settings();
-    if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
-    {
-        auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
-        _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
-    }
+    _options_watcher.configure( owner->get_context()->get_settings() );  // NOTE: can throw!
+
+    // Frames will not wait for their metadata beyond this; 0 (the default) to match inline with no time limit
+    double md_max_wait_seconds = 0;
+    dev->participant()->settings().nested( "device", "metadata", "max-wait" ).get_ex( md_max_wait_seconds );
+    _md_max_wait = std::chrono::duration_cast< syncer_type::clock::duration >(
+        std::chrono::duration< double >( md_max_wait_seconds ) );
 }
 
 
@@ -121,6 +123,13 @@ void dds_sensor_proxy::register_basic_converters()
             RS2_FORMAT_YUYV,
             { RS2_FORMAT_YUYV, RS2_FORMAT_RGB8, RS2_FORMAT_Y8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGR8, RS2_FORMAT_BGRA8 },
             RS2_STREAM_COLOR ) );
+    // Color may be JPEG-compressed for transport (see rs-dds-adapter); decoding is done on the CPU. The source may have
+    // been Y8, so it can be decoded to a single channel, too.
+    _formats_converter.register_converters(
+        processing_block_factory::create_pbf_vector< mjpeg_converter >(
+            RS2_FORMAT_MJPEG,
+            { RS2_FORMAT_MJPEG, RS2_FORMAT_RGB8, RS2_FORMAT_Y8 },
+            RS2_STREAM_COLOR ) );
 
     // Depth
     _formats_converter.register_converter(
@@ -163,6 +172,12 @@ rsutils::subscription dds_sensor_proxy::register_options_changed_callback( optio
     return _options_watcher.subscribe( std::move( cb ) );
 }
 
+
+void dds_sensor_proxy::notify_option_set( rs2_option option_id )
+{
+    _options_watcher.notify_set( option_id );
+}
+
 stream_profiles dds_sensor_proxy::get_active_streams() const 
 {
     return _active_converted_profiles;
@@ -360,6 +375,22 @@ void dds_sensor_proxy::handle_motion_data( realdds::topics::imu_msg && imu,
 }
 
 
+void dds_sensor_proxy::handle_motion_data( std::vector< realdds::topics::imu_msg > && imus,
+                                           realdds::dds_sample && sample,
+                                           const std::shared_ptr< stream_profile_interface > & profile,
+                                           streaming_impl & streaming )
+{
+    // All the samples were received together, so share the same arrival time
+    for( auto & imu : imus )
+    {
+        if( ! _is_streaming )
+            break;
+        realdds::dds_sample imu_sample( sample );
+        handle_motion_data( std::move( imu ), std::move( imu_sample ), profile, streaming );
+    }
+}
+
+
 void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
                                             std::shared_ptr< const json > const & dds_md )
 {
@@ -465,6 +496,8 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
         // Opening it will start streaming on the server side automatically
         dds_stream->open( "rt/" + _dev->device_info().topic_root() + '_' + dds_stream->name(), _dev->subscriber() );
         auto & streaming = _streaming_by_name[dds_stream->name()];
+        streaming.syncer.set_max_wait( _md_max_wait );
+        streaming.syncer.reset_statistics();
         streaming.syncer.on_frame_release( frame_releaser );
         streaming.syncer.on_frame_ready(
             [this, &streaming]( syncer_type::frame_holder && fh, std::shared_ptr< const json > const & md )
@@ -497,6 +530,12 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
                     if( _is_streaming )
                         handle_motion_data( std::move( imu ), std::move( sample ), profile, streaming );
                 } );
+            dds_motion_stream->on_batch_available(
+                [profile, this, &streaming]( std::vector< realdds::topics::imu_msg > && imus, realdds::dds_sample && sample )
+                {
+                    if( _is_streaming )
+                        handle_motion_data( std::move( imus ), std::move( sample ), profile, streaming );
+                } );
         }
         else
             throw std::runtime_error( "Unsupported stream type" );
@@ -531,7 +570,11 @@ void dds_sensor_proxy::stop()
         // Nullifing the lambda is commented out because we don't want to nullify in middle of user callback (that might
         // be long) instead we use start/stop.
         //_streaming_by_name[dds_stream->name()].syncer.on_frame_ready( nullptr );
-        _streaming_by_name[dds_stream->name()].syncer.stop();
+        auto & syncer = _streaming_by_name[dds_stream->name()].syncer;
+        syncer.stop();
+        if( _md_enabled )
+            LOG_DEBUG( "[" << get_name() << "] '" << dds_stream->name()
+                           << "' metadata syncer: " << syncer.get_statistics().to_json() );
 
         if( auto dds_video_stream = std::dynamic_pointer_cast< realdds::dds_video_stream >( dds_stream ) )
         {
@@ -540,6 +583,7 @@ void dds_sensor_proxy::stop()
         else if( auto dds_motion_stream = std::dynamic_pointer_cast< realdds::dds_motion_stream >( dds_stream ) )
         {
             dds_motion_stream->on_data_available( nullptr );
+            dds_motion_stream->on_batch_available( nullptr );
         }
         else
             throw std::runtime_error( "Unsupported stream type" );
@@ -622,7 +666,7 @@ void dds_sensor_proxy::add_option( std::shared_ptr< realdds::dds_option > option
             // Then we may have get a null even when is_enabled() returned true!
         } );
     register_option( option_id, opt );
-    _options_watcher.register_option( option_id, opt );
+    _options_watcher.register_option( option_id, opt, option->get_name() );
 
     if( std::dynamic_pointer_cast< realdds::dds_rect_option >( option ) && option->get_name() == "Region of Interest" )
     {
@@ -47,6 +47,7 @@ class dds_sensor_proxy : public software_sensor
 
     typedef realdds::dds_metadata_syncer syncer_type;
     static void frame_releaser( syncer_type::frame_type * f ) { static_cast< frame * >( f )->release(); }
+    syncer_type::clock::duration _md_max_wait;
 
     std::shared_ptr< roi_sensor_interface > _roi_support;
 
@@ -92,6 +93,7 @@ public:
     // sensor_interface
 public:
     rsutils::subscription register_options_changed_callback( options_watcher::callback && ) override;
+    void notify_option_set( rs2_option ) override;
     stream_profiles get_active_streams() const override;
 
 protected:
@@ -112,6 +114,11 @@ protected:
                              realdds::dds_sample &&,
                              const std::shared_ptr< stream_profile_interface > &,
                              streaming_impl & );
+    // Batched samples (see dds_motion_stream_server::is_batching) become individual frames
+    void handle_motion_data( std::vector< realdds::topics::imu_msg > &&,
+                             realdds::dds_sample &&,
+                             const std::shared_ptr< stream_profile_interface > &,
+                             streaming_impl & );
     void handle_new_metadata( std::string const & stream_name,
                               std::shared_ptr< const rsutils::json > const & metadata );
 
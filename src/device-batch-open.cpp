@@ -0,0 +1,147 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "device-batch-open.h"
+#include "device-info.h"
+#include "core/device-interface.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <thread>
+#include <atomic>
+#include <sstream>
+
+
+namespace librealsense {
+
+
+namespace {
+
+
+typedef std::chrono::steady_clock clock;
+
+
+// Tracks the current phase for the device being created on this thread
+struct phase_recorder
+{
+    std::shared_ptr< std::vector< device_open_phase > > phases;
+    std::string name;
+    clock::time_point start;
+
+    void next( std::string && next_name )
+    {
+        auto const now = clock::now();
+        phases->push_back( { std::move( name ), now - start } );
+        name = std::move( next_name );
+        start = now;
+    }
+};
+
+
+thread_local phase_recorder * this_thread_recorder = nullptr;
+
+
+void create_one( device_open_result & result, clock::time_point const queued )
+{
+    phase_recorder recorder{ std::make_shared< std::vector< device_open_phase > >(), "queued", queued };
+    recorder.next( "create" );
+    this_thread_recorder = &recorder;
+    try
+    {
+        result.device = result.info->create_device();
+    }
+    catch( ... )
+    {
+        result.exception = std::current_exception();
+    }
+    this_thread_recorder = nullptr;
+    recorder.next( {} );
+    result.phases = *recorder.phases;
+}
+
+
+void log_phases( device_open_result const & result )
+{
+    std::ostringstream ss;
+    for( auto & phase : result.phases )
+        ss << ' ' << phase.name << '='
+           << std::chrono::duration_cast< std::chrono::microseconds >( phase.duration ).count() / 1000. << "ms";
+    LOG_DEBUG( "    " << *result.info << ( result.device ? "" : " (FAILED)" ) << ":" << ss.str() );
+}
+
+
+}  // namespace
+
+
+void mark_device_open_phase( char const * name )
+{
+    if( auto recorder = this_thread_recorder )
+        recorder->next( name );
+}
+
+
+std::shared_ptr< const std::vector< device_open_phase > > get_device_open_phases()
+{
+    if( auto recorder = this_thread_recorder )
+        return recorder->phases;
+    return {};
+}
+
+
+std::shared_ptr< device_interface > create_device_with_phases( std::shared_ptr< device_info > const & info )
+{
+    device_open_result result;
+    result.info = info;
+    create_one( result, clock::now() );
+    log_phases( result );
+    if( result.exception )
+        std::rethrow_exception( result.exception );
+    return result.device;
+}
+
+
+std::vector< device_open_result > create_devices( std::vector< std::shared_ptr< device_info > > const & infos,
+                                                  size_t max_threads )
+{
+    std::vector< device_open_result > results( infos.size() );
+    for( size_t i = 0; i < infos.size(); ++i )
+        results[i].info = infos[i];
+
+    size_t n_threads = infos.size();
+    if( max_threads && n_threads > max_threads )
+        n_threads = max_threads;
+
+    auto const start = clock::now();
+    if( n_threads <= 1 )
+    {
+        for( auto & result : results )
+            create_one( result, start );
+    }
+    else
+    {
+        std::atomic< size_t > next_index( 0 );
+        auto worker = [&]()
+        {
+            size_t i;
+            while( ( i = next_index++ ) < results.size() )
+                create_one( results[i], start );
+        };
+        std::vector< std::thread > workers;
+        workers.reserve( n_threads );
+        for( size_t t = 0; t < n_threads; ++t )
+            workers.emplace_back( worker );
+        for( auto & t : workers )
+            t.join();
+    }
+
+    LOG_DEBUG( "created " << results.size() << " devices in "
+                          << std::chrono::duration_cast< std::chrono::milliseconds >( clock::now() - start ).count()
+                          << " ms using " << n_threads << " threads" );
+    for( auto & result : results )
+        log_phases( result );
+
+    return results;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,73 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <exception>
+
+
+namespace librealsense {
+
+
+class device_info;
+class device_interface;
+
+
+// How long one part of a device's creation took
+struct device_open_phase
+{
+    std::string name;
+    std::chrono::nanoseconds duration;
+};
+
+
+struct device_open_result
+{
+    std::shared_ptr< device_info > info;
+    std::shared_ptr< device_interface > device;  // null if creation failed
+    std::exception_ptr exception;                // set if creation failed
+    std::vector< device_open_phase > phases;     // in order; the first is the time spent waiting for a worker
+};
+
+
+// Create several devices at once. Most of the time to create a device is spent waiting on its (USB) control transfers,
+// so rather than creating devices one after the other, each is created on its own worker thread.
+//
+// A device failing to be created does not affect the others: its result will hold the exception instead.
+//
+// 'max_threads' limits the number of devices created concurrently; 0 for no limit (one thread per device).
+//
+// Creating different devices concurrently is safe because they share very little:
+//     - Each device has its own backend handles (UVC/HID/USB) and its own hw_monitor; the backends' static state (e.g.,
+//       the V4L named-mutex map) is guarded by its own locks, and libusb is thread-safe
+//     - The extrinsics graph in the environment singleton is guarded by its mutex
+//     - The context is only read (settings, backend)
+// The same device_info must not be in the list twice, as its device would then be opened twice.
+//
+std::vector< device_open_result > create_devices( std::vector< std::shared_ptr< device_info > > const &,
+                                                  size_t max_threads = 0 );
+
+
+// Same as device_info::create_device(), but recording the phases (see get_device_open_phases())
+//
+std::shared_ptr< device_interface > create_device_with_phases( std::shared_ptr< device_info > const & );
+
+
+// Device constructors can call this to mark the start of a new phase in their creation, e.g.:
+//     mark_device_open_phase( "depth-sensor" );
+// When the device is being created by create_devices() or create_device_with_phases(), the time spent in each phase is
+// recorded (and written to the debug log). Otherwise, this does nothing.
+//
+void mark_device_open_phase( char const * name );
+
+
+// Device constructors can call this to get the phases of the device being created on this thread. These are filled in
+// as creation proceeds, and are complete once the device is returned. Null if not recorded.
+//
+std::shared_ptr< const std::vector< device_open_phase > > get_device_open_phases();
+
+
+}  // namespace librealsense
@@ -0,0 +1,172 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "device-descriptor-cache.h"
+
+#include <rsutils/os/special-folder.h>
+#include <rsutils/string/hexarray.h>
+#include <rsutils/string/slice.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json-config.h>
+
+#include <fstream>
+#include <cstdio>
+#include <cctype>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+
+namespace librealsense {
+
+
+static void make_directory( std::string const & directory )
+{
+#ifdef _WIN32
+    _mkdir( directory.c_str() );
+#else
+    mkdir( directory.c_str(), 0755 );
+#endif
+    // Errors (it already exists, or cannot be created) will surface when we try to write
+}
+
+
+/*static*/ std::shared_ptr< device_descriptor_cache >
+device_descriptor_cache::open( rsutils::json const & context_settings, key const & k )
+{
+    auto const cache_settings = context_settings.nested( "descriptor-cache" );
+    if( ! cache_settings.nested( "enabled" ).default_value( false ) )
+        return {};
+    if( k.serial.empty() || k.firmware_version.empty() )
+        return {};
+
+    std::string directory = cache_settings.nested( "directory" ).default_value( std::string() );
+    if( directory.empty() )
+        directory = rsutils::os::get_special_folder( rsutils::os::special_folder::app_data ) + "realsense-cache";
+    make_directory( directory );
+
+    return std::make_shared< device_descriptor_cache >( directory, k );
+}
+
+
+device_descriptor_cache::device_descriptor_cache( std::string const & directory, key const & k )
+    : _key( k )
+    , _entries( rsutils::json::object() )
+{
+    // The serial number is used as the filename, so make sure it's safe
+    std::string filename;
+    for( char ch : k.serial )
+        if( std::isalnum( static_cast< unsigned char >( ch ) ) || ch == '-' || ch == '_' )
+            filename += ch;
+    _filename = directory;
+    if( ! _filename.empty() && _filename.back() != '/' && _filename.back() != '\\' )
+        _filename += '/';
+    _filename += filename + ".json";
+
+    load();
+}
+
+
+void device_descriptor_cache::load()
+{
+    auto j = rsutils::json_config::load_from_file( _filename );
+    if( ! j.is_object() )
+        return;  // no cache yet
+    if( j.nested( "serial" ).default_value( std::string() ) != _key.serial
+        || j.nested( "firmware-version" ).default_value( std::string() ) != _key.firmware_version
+        || j.nested( "path" ).default_value( std::string() ) != _key.path )
+    {
+        LOG_DEBUG( "descriptor cache " << _filename << " is stale; ignoring" );
+        return;
+    }
+    auto entries = j.nested( "entries" );
+    if( entries.is_object() )
+        _entries = entries;
+}
+
+
+void device_descriptor_cache::save() const
+{
+    rsutils::json j;
+    j["serial"] = _key.serial;
+    j["firmware-version"] = _key.firmware_version;
+    j["path"] = _key.path;
+    j["entries"] = _entries;
+
+    // Write to a temporary file first so another process never sees a partial file
+    auto const temp_filename = _filename + ".tmp";
+    {
+        std::ofstream f( temp_filename, std::ios::trunc );
+        if( ! f.good() )
+        {
+            LOG_DEBUG( "failed to write descriptor cache " << temp_filename );
+            return;
+        }
+        f << j.dump( 1 );
+        if( ! f.good() )
+        {
+            LOG_DEBUG( "failed to write descriptor cache " << temp_filename );
+            return;
+        }
+    }
+#ifdef _WIN32
+    std::remove( _filename.c_str() );  // rename() will not replace an existing file
+#endif
+    if( std::rename( temp_filename.c_str(), _filename.c_str() ) != 0 )
+    {
+        LOG_DEBUG( "failed to replace descriptor cache " << _filename );
+        std::remove( temp_filename.c_str() );
+    }
+}
+
+
+bool device_descriptor_cache::get( std::string const & name, std::vector< uint8_t > & data ) const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    auto it = _entries.find( name );
+    if( it == _entries.end() || ! it->is_string() )
+        return false;
+    try
+    {
+        data = rsutils::string::hexarray::from_string( it->string_ref() ).detach();
+    }
+    catch( std::exception const & e )
+    {
+        LOG_DEBUG( "invalid '" << name << "' in descriptor cache " << _filename << ": " << e.what() );
+        return false;
+    }
+    return true;
+}
+
+
+void device_descriptor_cache::set( std::string const & name, std::vector< uint8_t > const & data )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _entries[name] = rsutils::string::hexarray::to_string( data );
+    save();
+}
+
+
+void device_descriptor_cache::forget( std::string const & name )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( _entries.erase( name ) )
+        save();
+}
+
+
+void device_descriptor_cache::clear()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( ! _entries.empty() )
+    {
+        _entries = rsutils::json::object();
+        save();
+    }
+}
+
+
+}  // namespace librealsense
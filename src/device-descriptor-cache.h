@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <rsutils/json.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+// Reading what a device knows about itself (calibration tables, etc.) takes a round-trip to the firmware per item and
+// adds up when bringing up many devices. This keeps these descriptors on disk, one file per device, so the next
+// context can take them from there.
+//
+// Each device is identified by its serial number, firmware version and (USB) path: if any of these changed since the
+// file was written (e.g., firmware update or the device was moved to another port), the file is ignored and rewritten.
+// It is up to the device to keep the entries in sync when it changes them on the device (e.g., calibration writes).
+//
+// The cache is opt-in, through the context settings:
+//     "descriptor-cache": {
+//         "enabled": true,
+//         "directory": "/path/to/cache"       // optional; default is "realsense-cache" in the app-data folder
+//     }
+//
+class device_descriptor_cache
+{
+public:
+    struct key
+    {
+        std::string serial;
+        std::string firmware_version;
+        std::string path;
+    };
+
+    // Returns null if the cache is not enabled in the settings
+    static std::shared_ptr< device_descriptor_cache > open( rsutils::json const & context_settings, key const & );
+
+    device_descriptor_cache( std::string const & directory, key const & );
+
+    std::string const & get_filename() const { return _filename; }
+
+    // Returns false if not in the cache
+    bool get( std::string const & name, std::vector< uint8_t > & data ) const;
+
+    // Add or replace an entry; the file is rewritten immediately
+    void set( std::string const & name, std::vector< uint8_t > const & data );
+
+    // Remove an entry, so the next get() fails
+    void forget( std::string const & name );
+
+    // Remove all entries
+    void clear();
+
+private:
+    void load();
+    void save() const;  // under lock
+
+    key const _key;
+    std::string _filename;
+    rsutils::json _entries;  // name -> lower-case hex string
+    mutable std::mutex _mutex;
+};
+
+
+}  // namespace librealsense
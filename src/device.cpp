@@ -54,6 +54,7 @@ device::device( std::shared_ptr< const device_info > const & dev_info,
                   return format_conversion::raw;
               throw invalid_value_exception( "invalid " + format_conversion + " value '" + value + "'" );
           } )
+    , _open_phases( get_device_open_phases() )
 {
     if( device_changed_notifications )
     {
@@ -90,6 +91,22 @@ device::~device()
     _sensors.clear();
 }
 
+
+rsutils::json device::get_statistics() const
+{
+    rsutils::json j = rsutils::json::object();
+    if( _open_phases )
+    {
+        // In order, so an array rather than an object
+        auto & phases = j["open-phases"] = rsutils::json::array();
+        for( auto & phase : *_open_phases )
+            phases.push_back(
+                { { "name", phase.name },
+                  { "ms", std::chrono::duration_cast< std::chrono::microseconds >( phase.duration ).count() / 1000. } } );
+    }
+    return j;
+}
+
 int device::add_sensor(const std::shared_ptr<sensor_interface>& sensor_base)
 {
     _sensors.push_back(sensor_base);
@@ -9,9 +9,11 @@
 #include <src/core/features-container.h>
 
 #include "device-info.h"
+#include "device-batch-open.h"
 
 #include <rsutils/lazy.h>
 #include <rsutils/subscription.h>
+#include <rsutils/json-fwd.h>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -90,6 +92,9 @@ public:
 
     format_conversion get_format_conversion() const;
 
+    // Time spent in each phase of the device's creation (see mark_device_open_phase), if recorded
+    rsutils::json get_statistics() const;
+
 protected:
     int add_sensor(const std::shared_ptr<sensor_interface>& sensor_base);
     int assign_sensor(const std::shared_ptr<sensor_interface>& sensor_base, uint8_t idx);
@@ -107,6 +112,7 @@ private:
     rsutils::subscription _device_change_subscription;
     rsutils::lazy< std::vector< tagged_profile > > _profiles_tags;
     rsutils::lazy< format_conversion > _format_conversion;
+    std::shared_ptr< const std::vector< device_open_phase > > _open_phases;  // null if not recorded
 };
 
 
@@ -2,6 +2,7 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include "device_hub.h"
+#include "device-batch-open.h"
 
 #include <rsutils/easylogging/easyloggingpp.h>
 #include <librealsense2/rs.hpp>
@@ -61,7 +62,9 @@ namespace librealsense
             auto d = _device_list[ (_camera_index + i) % _device_list.size()];
             try
             {
-                auto dev = d->create_device();
+                // Devices are opened one at a time, stopping at the one we want: opening them all concurrently (see
+                // create_devices) would be faster, but would open devices the caller has no use for
+                auto dev = create_device_with_phases( d );
 
                 if(serial.size() > 0 )
                 {
@@ -9,6 +9,8 @@
 
 #include <src/ds/features/amplitude-factor-feature.h>
 #include <src/ds/features/remove-ir-pattern-feature.h>
+#include <src/context.h>
+#include <src/uvc-sensor.h>
 
 #include <rsutils/string/from.h>
 #include <rsutils/string/hexdump.h>
@@ -67,6 +69,14 @@ namespace librealsense
         _amplitude_factor_support = [this]() {
             return _depth_sensor.get_device().supports_feature( amplitude_factor_feature::ID );
         };
+
+        //     "advanced-mode": {
+        //         "shadow": false,                 // skip writing groups we last wrote/read with the same values
+        //         "apply-between-frames": false    // while streaming, write right after a depth frame arrives
+        //     }
+        auto const settings = _depth_sensor.get_device().get_context()->get_settings().nested( "advanced-mode" );
+        _use_shadow = settings.nested( "shadow" ).default_value( _use_shadow );
+        _apply_between_frames = settings.nested( "apply-between-frames" ).default_value( _apply_between_frames );
     }
 
     bool ds_advanced_mode_base::is_enabled() const
@@ -78,6 +88,7 @@ namespace librealsense
     {
         send_receive(encode_command(ds::fw_cmd::EN_ADV, enable));
         send_receive(encode_command(ds::fw_cmd::HWRST));
+        invalidate_shadow();
 
         // register / unregister visual preset option
         if (is_enabled())
@@ -788,20 +799,21 @@ namespace librealsense
     {
         rsutils::deferred depth_bulk = _depth_sensor.bulk_operation();
 
-        set(p.depth_controls, advanced_mode_traits<STDepthControlGroup>::group);
-        set(p.rsm           , advanced_mode_traits<STRsm>::group);
-        set(p.rsvc          , advanced_mode_traits<STRauSupportVectorControl>::group);
-        set(p.hdad          , advanced_mode_traits<STHdad>::group);
+        set_batch( { set_command( p.depth_controls, advanced_mode_traits< STDepthControlGroup >::group ),
+                     set_command( p.rsm           , advanced_mode_traits< STRsm >::group ),
+                     set_command( p.rsvc          , advanced_mode_traits< STRauSupportVectorControl >::group ),
+                     set_command( p.hdad          , advanced_mode_traits< STHdad >::group ) } );
 
         // Setting auto-white-balance control before colorCorrection parameters
         set_depth_auto_white_balance(p.depth_auto_white_balance);
-        set(p.cc            , advanced_mode_traits<STColorCorrection>::group);
 
-        set(p.depth_table   , advanced_mode_traits<STDepthTableControl>::group);
-        set(p.ae            , advanced_mode_traits<STAEControl>::group);
-        set(p.census        , advanced_mode_traits<STCensusRadius>::group);
+        std::vector< command > cmds{ set_command( p.cc         , advanced_mode_traits< STColorCorrection >::group ),
+                                     set_command( p.depth_table, advanced_mode_traits< STDepthTableControl >::group ),
+                                     set_command( p.ae         , advanced_mode_traits< STAEControl >::group ),
+                                     set_command( p.census     , advanced_mode_traits< STCensusRadius >::group ) };
         if (*_amplitude_factor_support)
-            set(p.amplitude_factor, advanced_mode_traits<STAFactor>::group);
+            cmds.push_back( set_command( p.amplitude_factor, advanced_mode_traits< STAFactor >::group ) );
+        set_batch( cmds );
 
         set_laser_state(p.laser_state);
         if (p.laser_state.was_set && p.laser_state.laser_state == 1) // 1 - on
@@ -815,10 +827,10 @@ namespace librealsense
         }
 
         // Depth sensor related even though they have color in the name. Probably color from left IR imager.
-        set( p.color_control, advanced_mode_traits< STColorControl >::group );
-        set( p.rctc         , advanced_mode_traits< STRauColorThresholdsControl >::group );
-        set( p.sctc         , advanced_mode_traits< STSloColorThresholdsControl >::group );
-        set( p.spc          , advanced_mode_traits< STSloPenaltyControl >::group );
+        set_batch( { set_command( p.color_control, advanced_mode_traits< STColorControl >::group ),
+                     set_command( p.rctc         , advanced_mode_traits< STRauColorThresholdsControl >::group ),
+                     set_command( p.sctc         , advanced_mode_traits< STSloColorThresholdsControl >::group ),
+                     set_command( p.spc          , advanced_mode_traits< STSloPenaltyControl >::group ) } );
     }
 
     void ds_advanced_mode_base::set_all_rgb( const preset & p )
@@ -867,6 +879,91 @@ namespace librealsense
         return res;
     }
 
+    void ds_advanced_mode_base::set_batch( std::vector< command > const & cmds ) const
+    {
+        if( _blocked )
+            throw std::runtime_error( _block_message );
+
+        // Only groups that differ from what the device already has need to be written
+        std::vector< command > changed;
+        {
+            std::lock_guard< std::mutex > lock( _shadow_mutex );
+            for( auto & cmd : cmds )
+            {
+                if( _use_shadow )
+                {
+                    auto it = _shadow.find( static_cast< EtAdvancedModeRegGroup >( cmd.param1 ) );
+                    if( it != _shadow.end() && it->second == cmd.data )
+                        continue;
+                }
+                changed.push_back( cmd );
+            }
+        }
+        LOG_DEBUG( "advanced-mode: writing " << changed.size() << " of " << cmds.size() << " groups" );
+        if( changed.empty() )
+            return;
+
+        if( _apply_between_frames )
+            wait_for_frame_boundary();
+
+        std::vector< command_result > results;
+        try
+        {
+            // Like set() always did, give the firmware time to apply each group before the next
+            results = _hw_monitor->send( changed, std::chrono::milliseconds( 20 ) );
+        }
+        catch( ... )
+        {
+            // We do not know what got written
+            std::lock_guard< std::mutex > lock( _shadow_mutex );
+            for( auto & cmd : changed )
+                _shadow.erase( static_cast< EtAdvancedModeRegGroup >( cmd.param1 ) );
+            throw;
+        }
+
+        hwmon_response_type failure = _hw_monitor->_hwmon_response->success_value();
+        {
+            std::lock_guard< std::mutex > lock( _shadow_mutex );
+            for( size_t i = 0; i < results.size(); ++i )
+            {
+                auto const group = static_cast< EtAdvancedModeRegGroup >( changed[i].param1 );
+                if( results[i].response == _hw_monitor->_hwmon_response->success_value() )
+                    _shadow[group] = changed[i].data;
+                else
+                {
+                    _shadow.erase( group );
+                    failure = results[i].response;
+                }
+            }
+        }
+        if( failure != _hw_monitor->_hwmon_response->success_value() )
+        {
+            std::stringstream ss;
+            ss << "Operation failed with error code=" << failure;
+            throw std::runtime_error(ss.str());
+        }
+    }
+
+    void ds_advanced_mode_base::wait_for_frame_boundary() const
+    {
+        // Writing right after a frame arrives gives the whole batch the most time to land before the next one
+        auto uvc = std::dynamic_pointer_cast< uvc_sensor >( _depth_sensor.get_raw_sensor() );
+        if( uvc && uvc->is_streaming() && ! uvc->wait_for_next_frame( std::chrono::milliseconds( 200 ) ) )
+            LOG_DEBUG( "advanced-mode: no depth frame arrived; writing anyway" );
+    }
+
+    void ds_advanced_mode_base::update_shadow( EtAdvancedModeRegGroup group, uint8_t const * data, size_t size ) const
+    {
+        std::lock_guard< std::mutex > lock( _shadow_mutex );
+        _shadow[group].assign( data, data + size );
+    }
+
+    void ds_advanced_mode_base::invalidate_shadow()
+    {
+        std::lock_guard< std::mutex > lock( _shadow_mutex );
+        _shadow.clear();
+    }
+
     uint32_t ds_advanced_mode_base::pack(uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3)
     {
         return (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
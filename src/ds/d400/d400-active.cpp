@@ -16,6 +16,7 @@
 #include "d400-options.h"
 #include "d400-info.h"
 #include "ds/ds-timestamp.h"
+#include <src/device-batch-open.h>
 
 namespace librealsense
 {
@@ -24,6 +25,7 @@ namespace librealsense
     {
         using namespace ds;
 
+        mark_device_open_phase( "active" );
         //Projector's capacity is established based on actual HW capabilities
         _ds_active_common = std::make_shared<ds_active_common>(get_raw_depth_sensor(), get_depth_sensor(), this, 
             _device_capabilities, _hw_monitor, _fw_version);
@@ -43,8 +45,13 @@ namespace librealsense
         }
         else
         {
+            // Share the reading with the ASIC temperature, if there
+            auto reader = _temperatures_reader;
+            if( ! reader )
+                reader = std::make_shared< asic_and_projector_temperatures_reader >( get_raw_depth_sensor() );
             depth_ep.register_option( RS2_OPTION_PROJECTOR_TEMPERATURE,
                                       std::make_shared< asic_and_projector_temperature_options >( get_raw_depth_sensor(),
+                                          reader,
                                           RS2_OPTION_PROJECTOR_TEMPERATURE ) );
         }
     }
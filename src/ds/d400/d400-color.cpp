@@ -17,6 +17,7 @@
 
 #include <rsutils/string/from.h>
 #include <rsutils/type/fourcc.h>
+#include <src/device-batch-open.h>
 using rs_fourcc = rsutils::type::fourcc;
 
 namespace librealsense
@@ -41,6 +42,7 @@ namespace librealsense
           _color_stream(new stream(RS2_STREAM_COLOR)),
           _separate_color(true)
     {
+        mark_device_open_phase( "color-sensor" );
         create_color_device( dev_info->get_context(), dev_info->get_group() );
         init();
     }
@@ -19,6 +19,7 @@
 #include "d400-color.h"
 #include "d400-nonmonochrome.h"
 #include <src/platform/platform-utils.h>
+#include <src/device-batch-open.h>
 
 #include <src/ds/features/amplitude-factor-feature.h>
 #include <src/ds/features/emitter-frequency-feature.h>
@@ -33,6 +34,8 @@
 #include <src/proc/color-formats-converter.h>
 
 #include <src/hdr-config.h>
+#include <src/device-descriptor-cache.h>
+#include <src/context.h>
 #include <src/ds/ds-thermal-monitor.h>
 #include <common/fw/firmware-version.h>
 #include <src/fw-update/fw-update-unsigned.h>
@@ -425,20 +428,53 @@ namespace librealsense
 
     std::vector<uint8_t> d400_device::get_d400_raw_calibration_table(ds::d400_calibration_table_id table_id) const
     {
-        command cmd(ds::GETINTCAL, static_cast<int>(table_id));
-        return _hw_monitor->send(cmd);
+        return read_descriptor( rsutils::string::from() << "calibration-table-" << static_cast< int >( table_id ),
+                                [&]()
+                                {
+                                    command cmd( ds::GETINTCAL, static_cast< int >( table_id ) );
+                                    return _hw_monitor->send( cmd );
+                                } );
     }
 
     std::vector<uint8_t> d400_device::get_new_calibration_table() const
     {
         if (_fw_version >= firmware_version("5.11.9.5"))
         {
-            command cmd(ds::RECPARAMSGET);
-            return _hw_monitor->send(cmd);
+            return read_descriptor( "new-calibration-table",
+                                    [&]()
+                                    {
+                                        command cmd( ds::RECPARAMSGET );
+                                        return _hw_monitor->send( cmd );
+                                    } );
         }
         return {};
     }
 
+    std::vector< uint8_t > d400_device::read_descriptor( std::string const & name,
+                                                         std::function< std::vector< uint8_t >() > const & read ) const
+    {
+        // Hold on to it: set_calibration_table() may turn the cache off from another thread
+        auto cache = std::atomic_load( &_descriptor_cache );
+        std::vector< uint8_t > data;
+        if( cache && cache->get( name, data ) )
+            return data;
+        data = read();
+        if( cache && ! data.empty() )
+            cache->set( name, data );
+        return data;
+    }
+
+    void d400_device::set_calibration_table( const std::vector< uint8_t > & calibration )
+    {
+        auto_calibrated::set_calibration_table( calibration );
+
+        // The table may now be loaded to RAM only: what we'd read back may not survive a power cycle, so stop caching
+        if( auto cache = std::atomic_exchange( &_descriptor_cache, std::shared_ptr< device_descriptor_cache >() ) )
+        {
+            cache->clear();
+        }
+    }
+
     ds::ds_caps d400_device::parse_device_capabilities( const std::vector<uint8_t> &gvd_buf ) const
     {
         using namespace ds;
@@ -555,7 +591,9 @@ namespace librealsense
           _right_ir_stream(new stream(RS2_STREAM_INFRARED, 2)),
           _color_stream(nullptr)
     {
+        mark_device_open_phase( "depth-sensor" );
         _depth_device_idx = add_sensor( create_depth_device( dev_info->get_context(), dev_info->get_group().uvc_devices ) );
+        mark_device_open_phase( "init" );
         init( dev_info->get_context(), dev_info->get_group() );
     }
 
@@ -639,6 +677,10 @@ namespace librealsense
 
             _fw_version = firmware_version(fwv);
 
+            std::atomic_store( &_descriptor_cache,
+                               device_descriptor_cache::open( ctx->get_settings(),
+                                                              { optic_serial, fwv, group.uvc_devices.front().device_path } ) );
+
             _recommended_fw_version = firmware_version(D4XX_RECOMMENDED_FIRMWARE_VERSION);
             if (_fw_version >= firmware_version("5.10.4.0"))
                 _device_capabilities = parse_device_capabilities( gvd_buff );
@@ -726,8 +768,10 @@ namespace librealsense
                         std::make_shared<uvc_xu_option<uint8_t>>( raw_depth_sensor, depth_xu, DS5_EXT_TRIGGER,
                             "Generate trigger from the camera to external device once per frame"));
 
+                    _temperatures_reader = std::make_shared< asic_and_projector_temperatures_reader >( raw_depth_sensor );
                     depth_sensor.register_option(RS2_OPTION_ASIC_TEMPERATURE,
                         std::make_shared< asic_and_projector_temperature_options >( raw_depth_sensor,
+                                                                                    _temperatures_reader,
                                                                                     RS2_OPTION_ASIC_TEMPERATURE ) );
 
                     // D457 dev - get_xu fails for D457 - error polling id not defined
@@ -1008,9 +1052,21 @@ namespace librealsense
 
         auto_calibrated::add_depth_write_observer( [this]()
         { 
+            if( auto cache = std::atomic_load( &_descriptor_cache ) )
+            {
+                cache->forget( rsutils::string::from() << "calibration-table-"
+                                                       << static_cast< int >( ds::d400_calibration_table_id::coefficients_table_id ) );
+                cache->forget( "new-calibration-table" );
+            }
             _coefficients_table_raw.reset();
             _new_calib_table_raw.reset();
         } );
+        auto_calibrated::add_color_write_observer( [this]()
+        {
+            if( auto cache = std::atomic_load( &_descriptor_cache ) )
+                cache->forget( rsutils::string::from() << "calibration-table-"
+                                                       << static_cast< int >( ds::d400_calibration_table_id::rgb_calibration_id ) );
+        } );
     }
 
     void d400_device::register_features()
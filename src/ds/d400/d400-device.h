@@ -22,6 +22,7 @@ namespace librealsense
 {
     class hdr_config;
     class d400_thermal_monitor;
+    class device_descriptor_cache;
 
     class d400_device
         : public virtual backend_device
@@ -68,12 +69,19 @@ namespace librealsense
         bool check_fw_compatibility(const std::vector<uint8_t>& image) const override;
         std::string get_opcode_string(int opcode) const override;
 
+        void set_calibration_table(const std::vector<uint8_t>& calibration) override;
+
     protected:
         std::shared_ptr<ds_device_common> _ds_device_common;
 
         std::vector<uint8_t> get_d400_raw_calibration_table(ds::d400_calibration_table_id table_id) const;
         std::vector<uint8_t> get_new_calibration_table() const;
 
+        // Returns the named descriptor from the descriptor cache if it's there; otherwise reads it from the device and
+        // stores it in the cache
+        std::vector< uint8_t > read_descriptor( std::string const & name,
+                                                std::function< std::vector< uint8_t >() > const & read ) const;
+
         bool is_camera_in_advanced_mode() const;
 
         float get_stereo_baseline_mm() const;
@@ -116,6 +124,9 @@ namespace librealsense
         std::shared_ptr< rsutils::lazy< rs2_extrinsics > > _color_extrinsic;
         bool _is_locked = true;
 
+        std::shared_ptr< device_descriptor_cache > _descriptor_cache;  // null if disabled; only via std::atomic_load/store
+        std::shared_ptr< asic_and_projector_temperatures_reader > _temperatures_reader;  // null if not applicable
+
         std::shared_ptr<auto_gain_limit_option> _gain_limit_value_control;
         std::shared_ptr<auto_exposure_limit_option> _ae_limit_value_control;
     };
@@ -21,6 +21,7 @@
 #include "proc/auto-exposure-processor.h"
 #include <src/metadata-parser.h>
 #include <src/hid-sensor.h>
+#include <src/device-batch-open.h>
 
 #include <rsutils/type/fourcc.h>
 using rsutils::type::fourcc;
@@ -133,6 +134,7 @@ namespace librealsense
     {
         using namespace ds;
 
+        mark_device_open_phase( "motion-sensor" );
         std::vector<platform::hid_device_info> hid_infos = dev_info->get_group().hid_devices;
 
         _ds_motion_common->init_motion(hid_infos.empty(), *_depth_stream);
@@ -38,39 +38,55 @@ namespace librealsense
                         "Emitter select, 0-disable all emitters, 1-enable laser, 2-enable laser auto (opt), 3-enable LED (opt)")
     {}
 
-    float asic_and_projector_temperature_options::query() const
+    /*static*/ const std::chrono::milliseconds asic_and_projector_temperatures_reader::max_age( 100 );
+
+    asic_and_projector_temperatures_reader::asic_and_projector_temperatures_reader( const std::weak_ptr< uvc_sensor > & ep )
+        : _ep( ep )
+        , _last{}
     {
-        if (!is_enabled())
-            throw wrong_api_call_sequence_exception("query is available during streaming only");
+    }
 
-        #pragma pack(push, 1)
-        struct temperature
-        {
-            uint8_t is_projector_valid;
-            uint8_t is_asic_valid;
-            int8_t projector_temperature;
-            int8_t asic_temperature;
-        };
-        #pragma pack(pop)
+    asic_and_projector_temperatures_reader::temperatures asic_and_projector_temperatures_reader::read()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        auto const now = std::chrono::steady_clock::now();
+        if( _last_time.time_since_epoch().count() && now - _last_time < max_age )
+            return _last;
 
         auto strong_ep = _ep.lock();
         if (!strong_ep)
             throw camera_disconnected_exception("asic and proj temperatures cannot access the sensor");
 
-        auto temperature_data = static_cast<temperature>(strong_ep->invoke_powered(
-            [this](platform::uvc_device& dev)
+        _last = strong_ep->invoke_powered(
+            [](platform::uvc_device& dev)
             {
-                temperature temp{};
+                temperatures temp{};
                 if (!dev.get_xu(ds::depth_xu,
                                 ds::DS5_ASIC_AND_PROJECTOR_TEMPERATURES,
                                 reinterpret_cast<uint8_t*>(&temp),
-                                sizeof(temperature)))
+                                sizeof(temperatures)))
                  {
                         throw invalid_value_exception(rsutils::string::from() << "get_xu(ctrl=DS5_ASIC_AND_PROJECTOR_TEMPERATURES) failed!" << " Last Error: " << strerror(errno));
                  }
 
                 return temp;
-            }));
+            });
+        _last_time = now;
+        return _last;
+    }
+
+    float asic_and_projector_temperature_options::query() const
+    {
+        if (!is_enabled())
+            throw wrong_api_call_sequence_exception("query is available during streaming only");
+
+        auto strong_ep = _ep.lock();
+        if (!strong_ep)
+            throw camera_disconnected_exception("asic and proj temperatures cannot access the sensor");
+
+        using temperature = asic_and_projector_temperatures_reader::temperatures;
+        auto temperature_data = _reader->read();
 
         int8_t temperature::* field;
         uint8_t temperature::* is_valid_field;
@@ -127,9 +143,19 @@ namespace librealsense
     }
 
     asic_and_projector_temperature_options::asic_and_projector_temperature_options( const std::weak_ptr<uvc_sensor> & ep, rs2_option opt)
-        : _option(opt), _ep(std::move(ep))
+        : asic_and_projector_temperature_options( ep, std::make_shared< asic_and_projector_temperatures_reader >( ep ), opt )
         {}
 
+    asic_and_projector_temperature_options::asic_and_projector_temperature_options(
+        const std::weak_ptr< uvc_sensor > & ep,
+        std::shared_ptr< asic_and_projector_temperatures_reader > reader,
+        rs2_option opt )
+        : _ep( ep )
+        , _reader( std::move( reader ) )
+        , _option( opt )
+    {
+    }
+
     float motion_module_temperature_option::query() const
     {
         if (!is_enabled())
@@ -11,6 +11,9 @@
 #include "../hdr-config.h"
 #include <rsutils/lazy.h>
 
+#include <mutex>
+#include <chrono>
+
 namespace librealsense
 {
     class emitter_option : public uvc_xu_option<uint8_t>
@@ -20,6 +23,35 @@ namespace librealsense
         explicit emitter_option( const std::weak_ptr< uvc_sensor > & ep );
     };
 
+    // Both the ASIC and projector temperatures come from the same XU control. The options can share one reader, which
+    // keeps the last reading for a short while: querying both together (as the options-watcher does) then takes a
+    // single control transfer.
+    class asic_and_projector_temperatures_reader
+    {
+    public:
+        #pragma pack(push, 1)
+        struct temperatures
+        {
+            uint8_t is_projector_valid;
+            uint8_t is_asic_valid;
+            int8_t projector_temperature;
+            int8_t asic_temperature;
+        };
+        #pragma pack(pop)
+
+        static const std::chrono::milliseconds max_age;
+
+        explicit asic_and_projector_temperatures_reader( const std::weak_ptr< uvc_sensor > & ep );
+
+        temperatures read();
+
+    private:
+        std::weak_ptr< uvc_sensor > _ep;
+        std::mutex _mutex;
+        temperatures _last;
+        std::chrono::steady_clock::time_point _last_time;
+    };
+
     class asic_and_projector_temperature_options : public readonly_option
     {
     public:
@@ -32,9 +64,13 @@ namespace librealsense
         const char* get_description() const override;
 
         explicit asic_and_projector_temperature_options( const std::weak_ptr< uvc_sensor > & ep, rs2_option opt );
+        asic_and_projector_temperature_options( const std::weak_ptr< uvc_sensor > & ep,
+                                                std::shared_ptr< asic_and_projector_temperatures_reader > reader,
+                                                rs2_option opt );
 
     private:
         std::weak_ptr<uvc_sensor>   _ep;
+        std::shared_ptr< asic_and_projector_temperatures_reader > _reader;
         rs2_option                  _option;
     };
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "pipeline-statistics.h"
 #include <src/core/frame-interface.h>
 
 #include <atomic>
@@ -20,6 +21,7 @@ namespace librealsense
         std::atomic<uint32_t> published_frames_count;
         small_heap<T, RS2_USER_QUEUE_SIZE> published_frames;
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
+        std::shared_ptr<frame_source_statistics> _statistics;  // optional
         callbacks_heap callback_inflight;
 
         std::vector<T> freelist; // return frames here
@@ -62,6 +64,13 @@ namespace librealsense
 
             if (requires_memory)
             {
+                if( _statistics )
+                {
+                    if( backbuffer.data.size() == size )
+                        ++_statistics->buffers_recycled;
+                    else
+                        ++_statistics->buffers_allocated;
+                }
                 backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
             }
             backbuffer.additional_data = std::move( additional_data );
@@ -72,13 +81,21 @@ namespace librealsense
         {
             std::unique_lock<std::recursive_mutex> lock(mutex);
 
+            auto const size = f.data.size();
             auto published_frame = f.publish(this->shared_from_this());
             if (published_frame)
             {
                 published_frame->acquire();
+                if( _statistics )
+                {
+                    ++_statistics->frames_produced;
+                    _statistics->bytes_produced += size;
+                }
                 return published_frame;
             }
 
+            if( _statistics )
+                ++_statistics->frames_dropped;
             LOG_DEBUG("publish(...) failed");
             return nullptr;
         }
@@ -142,14 +159,18 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        uint32_t get_published_count() const override { return published_frames_count; }
+
         friend class frame;
 
     public:
         explicit frame_archive( std::atomic< uint32_t > * in_max_frame_queue_size,
-                                std::shared_ptr< metadata_parser_map > const & parsers )
+                                std::shared_ptr< metadata_parser_map > const & parsers,
+                                std::shared_ptr< frame_source_statistics > const & statistics = nullptr )
             : max_frame_queue_size( in_max_frame_queue_size )
             , recycle_frames( true )
             , _metadata_parsers( parsers )
+            , _statistics( statistics )
         {
             published_frames_count = 0;
         }
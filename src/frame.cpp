@@ -112,14 +112,14 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 {
     if( ! metadata_parsers )
         return false;
-    auto parsers = metadata_parsers->equal_range( frame_metadata );
-
-    bool value_retrieved = false;
-    for( auto it = parsers.first; it != parsers.second; ++it )
-        if( it->second->find( *this, p_value ) )
-            value_retrieved = true;
+    return metadata_parsers->find( *this, frame_metadata, p_value );
+}
 
-    return value_retrieved;
+int frame::find_all_metadata( rs2_frame_metadata_entry * entries, int capacity ) const
+{
+    if( ! metadata_parsers )
+        return 0;
+    return metadata_parsers->find_all( *this, entries, capacity );
 }
 
 int frame::get_frame_data_size() const
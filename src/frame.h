@@ -64,6 +64,7 @@ public:
     virtual ~frame() { on_release.reset(); }
     frame_header const & get_header() const override { return additional_data; }
     bool find_metadata( rs2_frame_metadata_value, rs2_metadata_type * p_output_value ) const override;
+    int find_all_metadata( rs2_frame_metadata_entry * entries, int capacity ) const override;
     int get_frame_data_size() const override;
     const uint8_t * get_frame_data() const override;
     rs2_time_t get_frame_timestamp() const override;
@@ -109,6 +110,10 @@ public:
     void set_blocking( bool state ) override { additional_data.is_blocking = state; }
     bool is_blocking() const override { return additional_data.is_blocking; }
 
+    // True if a single reference is held on the frame and its data is its own (not a backend buffer lent to it
+    // through the continuation): whoever holds that reference can then modify the frame without anyone noticing
+    bool is_exclusive() const { return ref_count == 1 && ! _kept && ! on_release.get_data(); }
+
 private:
     // TODO: check boost::intrusive_ptr or an alternative
     std::atomic< int > ref_count;  // the reference count is on how many times this placeholder has
@@ -14,6 +14,7 @@
 #include "tiny-profiler.h"  // common/
 #include <glad/glad.h>
 
+#include <rsutils/json.h>
 #include <functional>
 #include <thread>
 #include <deque>
@@ -514,6 +515,11 @@ namespace librealsense
             {
                 return get().get_source();
             }
+            rsutils::json get_statistics() const override
+            {
+                // The block that was last selected does the work
+                return _blocks.empty() ? processing_block::get_statistics() : _blocks[index]->get_statistics();
+            }
         protected:
             std::vector<std::shared_ptr<processing_block>> _blocks;
             int index = 0;
@@ -2,11 +2,15 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 #include "global_timestamp_reader.h"
 #include <chrono>
+#include <cmath>
+#include <limits>
 
 using namespace std::chrono;
 
 namespace librealsense
 {
+    static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
+
     CSample& CSample::operator-=(const CSample& other)
     {
         _x -= other._x;
@@ -123,13 +127,45 @@ namespace librealsense
         }
     }
 
-    double CLinearCoefficients::calc_value(double x) const
+    CLinearCoefficientsSnapshot CLinearCoefficients::get_snapshot(bool is_ready) const
     {
-        double a, b;
-        get_a_b(x, a, b);
-        double y(a * (x - _base_sample._x) + b + _base_sample._y);
-        //LOG_DEBUG(__FUNCTION__ << ": " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << _base_sample._x << ", " << _base_sample._y);
-        return y;
+        CLinearCoefficientsSnapshot snapshot;
+        snapshot._is_ready = is_ready;
+        if (_last_values.empty())
+            return snapshot;
+        snapshot._has_samples = true;
+        snapshot._last_sample_x = _last_values.front()._x;
+        snapshot._base_x = _base_sample._x;
+        snapshot._base_y = _base_sample._y;
+        snapshot._prev_a = _prev_a;
+        snapshot._prev_b = _prev_b;
+        snapshot._dest_a = _dest_a;
+        snapshot._dest_b = _dest_b;
+        snapshot._prev_time = _prev_time;
+        snapshot._time_span_ms = _time_span_ms;
+        return snapshot;
+    }
+
+    // Also handles HW clock rewinds, like CLinearCoefficients::update_samples_base() but without changing anything:
+    // shifting all the samples by base_x is the same as looking up x + base_x instead
+    double CLinearCoefficientsSnapshot::calc_value(double x) const
+    {
+        if (_has_samples)
+        {
+            if ((_last_sample_x - x) > max_device_time / 2)
+                x += max_device_time;
+            else if ((x - _last_sample_x) > max_device_time / 2)
+                x -= max_device_time;
+        }
+        double a = _dest_a;
+        double b = _dest_b;
+        if (x - _prev_time < _time_span_ms)
+        {
+            double dt((x - _prev_time) / _time_span_ms);
+            a = _dest_a * dt + _prev_a * (1 - dt);
+            b = _dest_b * dt + _prev_b * (1 - dt);
+        }
+        return a * (x - _base_x) + b + _base_y;
     }
 
 
@@ -139,7 +175,6 @@ namespace librealsense
     // so that the global timestamp can be correctly computed
     bool CLinearCoefficients::update_samples_base(double x)
     {
-        static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
         double base_x;
         if (_last_values.empty())
             return false;
@@ -174,6 +209,7 @@ namespace librealsense
         _users_count(0),
         _is_ready(false),
         _min_command_delay(1000),
+        _last_request_time(std::numeric_limits<double>::quiet_NaN()),
         _active_object([this](dispatcher::cancellable_timer cancellable_timer)
             {
                 polling(cancellable_timer);
@@ -202,9 +238,10 @@ namespace librealsense
         {
             LOG_DEBUG("time_diff_keeper::stop: stop object.");
             _active_object.stop();
+            std::lock_guard< std::recursive_mutex > lock( _coefs_mtx );
             _is_ready = false;
-            std::lock_guard< std::recursive_mutex > lock( _read_mtx );
             _coefs.reset();
+            _published.store( CLinearCoefficientsSnapshot() );
         }
     }
 
@@ -224,7 +261,7 @@ namespace librealsense
             double system_time_finish = duration<double, std::milli>(system_clock::now().time_since_epoch()).count();
             double command_delay = (system_time_finish-system_time_start)/2;
 
-            std::lock_guard<std::recursive_mutex> lock(_read_mtx);
+            std::lock_guard<std::recursive_mutex> lock(_coefs_mtx);
             if (command_delay < _min_command_delay)
             {
                 _coefs.add_const_y_coefs(command_delay - _min_command_delay);
@@ -235,9 +272,14 @@ namespace librealsense
             {
                 _coefs.update_samples_base(sample_hw_time);
             }
+            // Frames no longer update the coefficients directly; pick up where they left off
+            double last_request_time = _last_request_time.load(std::memory_order_relaxed);
+            if (!std::isnan(last_request_time))
+                _coefs.update_last_sample_time(last_request_time);
             CSample crnt_sample(sample_hw_time, system_time);
             _coefs.add_value(crnt_sample);
             _is_ready = true;
+            _published.store(_coefs.get_snapshot(_is_ready));
             return true;
         }
         catch (const io_exception& ex)
@@ -269,15 +311,16 @@ namespace librealsense
         }
     }
 
+    // Called for every frame, possibly from several streams at once: works off the latest published coefficients and
+    // never waits for the polling thread
     double time_diff_keeper::get_system_hw_time(double crnt_hw_time, bool& is_ready)
     {
-        std::lock_guard<std::recursive_mutex> lock(_read_mtx);
-        is_ready = _is_ready;
-        if (_is_ready)
+        auto const coefs = _published.load();
+        is_ready = coefs._is_ready;
+        if (is_ready)
         {
-            _coefs.update_samples_base(crnt_hw_time);
-            _coefs.update_last_sample_time(crnt_hw_time);
-            return _coefs.calc_value(crnt_hw_time);
+            _last_request_time.store(crnt_hw_time, std::memory_order_relaxed);
+            return coefs.calc_value(crnt_hw_time);
         }
         else
             return crnt_hw_time;
@@ -301,7 +344,11 @@ namespace librealsense
         {
             auto sp = _time_diff_keeper.lock();
             if (sp)
-                frame_time = sp->get_system_hw_time(frame_time, _ts_is_ready);
+            {
+                bool is_ready;
+                frame_time = sp->get_system_hw_time(frame_time, is_ready);
+                _ts_is_ready = is_ready;
+            }
             else
                 LOG_DEBUG("Notification: global_timestamp_reader - time_diff_keeper is being shut-down");
         }
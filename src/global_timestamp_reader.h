@@ -6,7 +6,9 @@
 #include "sensor.h"
 #include "error-handling.h"
 #include "option.h"
+#include <rsutils/concurrency/seqlock.h>
 #include <deque>
+#include <atomic>
 
 namespace librealsense
 {
@@ -31,6 +33,21 @@ namespace librealsense
         double _y;
     };
 
+    // Everything needed to convert a HW time to system time, as published by the polling thread; frames are converted
+    // from this copy without taking any lock
+    struct CLinearCoefficientsSnapshot
+    {
+        bool _is_ready = false;
+        bool _has_samples = false;
+        double _last_sample_x = 0;  // Of the latest sample, to detect HW clock rewinds
+        double _base_x = 0, _base_y = 0;
+        double _prev_a = 0, _prev_b = 0;
+        double _dest_a = 0, _dest_b = 0;
+        double _prev_time = 0, _time_span_ms = 0;
+
+        double calc_value(double x) const;
+    };
+
     class CLinearCoefficients
     {
     public:
@@ -40,8 +57,8 @@ namespace librealsense
         void add_const_y_coefs(double dy);
         bool update_samples_base(double x);
         void update_last_sample_time(double x);
-        double calc_value(double x) const;
         bool is_full() const;
+        CLinearCoefficientsSnapshot get_snapshot(bool is_ready) const;
 
     private:
         void calc_linear_coefs();
@@ -81,11 +98,15 @@ namespace librealsense
         int             _users_count;
         std::shared_ptr<global_time_option> _option_is_enabled;
         active_object<> _active_object;
-        mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time.
+        mutable std::recursive_mutex _coefs_mtx; // Watch only 1 update of the coefficients at a time.
         mutable std::recursive_mutex _enable_mtx; // Watch only 1 start/stop operation at a time.
         CLinearCoefficients _coefs;
         double _min_command_delay;
         bool _is_ready;
+        // What readers see: published after every update of _coefs
+        rsutils::concurrency::seqlock< CLinearCoefficientsSnapshot > _published;
+        // Latest HW time converted, fed back into the coefficients on the next update (NaN until a frame arrives)
+        std::atomic< double > _last_request_time;
     };
 
     class global_timestamp_reader : public frame_timestamp_reader
@@ -103,9 +124,8 @@ namespace librealsense
     private:
         std::unique_ptr<frame_timestamp_reader> _device_timestamp_reader;
         std::weak_ptr<time_diff_keeper> _time_diff_keeper;
-        mutable std::recursive_mutex _mtx;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        bool _ts_is_ready;
+        std::atomic< bool > _ts_is_ready;
     };
 
     class global_time_interface
@@ -195,6 +195,39 @@ namespace librealsense
         return std::vector<uint8_t>( pb, pb + details.receivedCommandDataLength );
     }
 
+    std::vector< command_result > hw_monitor::send( std::vector< command > const & cmds,
+                                                    std::chrono::milliseconds settle ) const
+    {
+        std::vector< command_result > results( cmds.size() );
+        auto const batch_start = std::chrono::steady_clock::now();
+        _locked_transfer->batch( [&]()
+            {
+                for( size_t i = 0; i < cmds.size(); ++i )
+                {
+                    auto & result = results[i];
+                    auto const start = std::chrono::steady_clock::now();
+                    // Virtual, so subclasses that split commands (e.g., extended buffers) still work
+                    result.data = send( cmds[i], &result.response );
+                    result.latency = std::chrono::steady_clock::now() - start;
+                    if( settle.count() > 0 )
+                        std::this_thread::sleep_for( settle );
+                }
+            } );
+
+        if( ! cmds.empty() )
+        {
+            std::ostringstream ss;
+            for( auto & result : results )
+                ss << ' ' << std::chrono::duration_cast< std::chrono::microseconds >( result.latency ).count();
+            LOG_DEBUG( "hwmon batch of " << cmds.size() << " commands took "
+                                         << std::chrono::duration_cast< std::chrono::microseconds >(
+                                                std::chrono::steady_clock::now() - batch_start )
+                                                .count()
+                                         << " us; per command [us]:" << ss.str() );
+        }
+        return results;
+    }
+
     /*static*/ std::vector<uint8_t> hw_monitor::build_command(uint32_t opcode,
         uint32_t param1,
         uint32_t param2,
@@ -9,6 +9,7 @@
 #include <string>
 #include <algorithm>
 #include <vector>
+#include <chrono>
 
 
 namespace librealsense
@@ -79,6 +80,19 @@ namespace librealsense
                 });
         }
 
+        // Run several transfers back to back: the lock is taken and the device powered up only once for all of them,
+        // rather than for each send_receive() inside the action
+        template< class T >
+        void batch( T action )
+        {
+            std::lock_guard<std::recursive_mutex> lock(_local_mtx);
+            auto strong_uvc = _uvc_sensor_base.lock();
+            if( ! strong_uvc )
+                return action();
+
+            strong_uvc->invoke_powered( [&]( platform::uvc_device & ) { action(); } );
+        }
+
         ~locked_transfer()
         {
             try
@@ -120,6 +134,15 @@ namespace librealsense
     };
 
     typedef int32_t hwmon_response_type;
+
+    // The outcome of one command in a batch; see hw_monitor::send( std::vector< command > )
+    struct command_result
+    {
+        std::vector< uint8_t > data;       // the response, without the opcode
+        hwmon_response_type response = 0;  // success_value() or the hwmon error code
+        std::chrono::nanoseconds latency;  // the time it took to send this command and get its response
+    };
+
     class hwmon_response_interface { // base class for different product lines to implement responses
     public:
         virtual std::string hwmon_error2str(int e) const = 0;
@@ -168,6 +191,12 @@ namespace librealsense
 
         virtual std::vector<uint8_t> send( std::vector<uint8_t> const & data ) const;
         virtual std::vector<uint8_t> send( command const & cmd, hwmon_response_type * = nullptr, bool locked_transfer = false ) const;
+        // Send several commands, in order, as one batch: the transfer is locked and the device powered only once, so
+        // callers issuing dozens of commands (calibration reads, preset loads) do not pay for it on every command.
+        // hwmon errors do not stop the batch - they are returned in each result; transport errors throw.
+        // Commands the firmware needs time to apply can be given a settle time, waited after each of them.
+        std::vector< command_result > send( std::vector< command > const & cmds,
+                                            std::chrono::milliseconds settle = std::chrono::milliseconds( 0 ) ) const;
         static std::vector<uint8_t> build_command(uint32_t opcode,
             uint32_t param1 = 0,
             uint32_t param2 = 0,
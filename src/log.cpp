@@ -38,6 +38,16 @@ void librealsense::enable_rolling_log_file( unsigned max_size )
     logger.enable_rolling_log_file( max_size );
 }
 
+void librealsense::enable_async_logging( unsigned queue_size )
+{
+    logger.enable_async_logging( queue_size );
+}
+
+unsigned long long librealsense::get_log_drop_count()
+{
+    return logger.get_drop_count();
+}
+
 #else // BUILD_EASYLOGGINGPP
 
 void librealsense::log_to_console(rs2_log_severity min_severity)
@@ -64,5 +74,15 @@ void librealsense::enable_rolling_log_file( unsigned max_size )
 {
     throw std::runtime_error("enable_rolling_log_file is not supported without BUILD_EASYLOGGINGPP");
 }
+
+void librealsense::enable_async_logging( unsigned queue_size )
+{
+    throw std::runtime_error("enable_async_logging is not supported without BUILD_EASYLOGGINGPP");
+}
+
+unsigned long long librealsense::get_log_drop_count()
+{
+    return 0;  // nothing is logged, so nothing is dropped
+}
 #endif // BUILD_EASYLOGGINGPP
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "core/enum-helpers.h"
+#include "async-log-writer.h"
 #include <librealsense2/hpp/rs_types.hpp>
 
 #include <rsutils/string/from.h>
@@ -12,6 +13,8 @@
 #include <stdexcept>
 #include <mutex>
 #include <fstream>
+#include <iostream>
+#include <memory>
 
 
 namespace librealsense
@@ -21,6 +24,8 @@ namespace librealsense
     void log_to_callback( rs2_log_severity min_severity, rs2_log_callback_sptr callback );
     void reset_logger();
     void enable_rolling_log_file( unsigned max_size );
+    void enable_async_logging( unsigned queue_size );
+    unsigned long long get_log_drop_count();
 
 #if BUILD_EASYLOGGINGPP
     struct log_message
@@ -66,6 +71,14 @@ namespace librealsense
         std::string filename;
         const std::string log_id = NAME;
 
+        // When logging asynchronously, ELPP does not write to console or file; our dispatcher formats each line and
+        // hands it to the writer, whose thread writes it to log_file (and does the rolling, if enabled) or the console
+        std::unique_ptr< async_log_writer > async_writer;
+        std::string const async_dispatcher_name = "async_log_dispatcher";
+        size_t max_file_size = 0;  // in bytes, for rolling while async; 0 for none
+        size_t file_size = 0;
+        uint64_t n_dropped_before = 0;  // by previous writers
+
     public:
         static el::Level severity_to_level(rs2_log_severity severity)
         {
@@ -113,7 +126,7 @@ namespace librealsense
 
             // NOTE: you can only log to one file, so successive calls to log_to_file
             // will override one another!
-            if (minimum_file_severity != RS2_LOG_SEVERITY_NONE)
+            if( minimum_file_severity != RS2_LOG_SEVERITY_NONE && ! async_writer )
             {
                 // Configure filename for logging only if the severity requires it, which
                 // prevents creation of empty log files that are not required.
@@ -130,13 +143,14 @@ namespace librealsense
                 defaultConf.set( level, el::ConfigurationType::Enabled, severity >= min_severity ? "true" : "false" );
                 defaultConf.set( level,
                                  el::ConfigurationType::ToStandardOutput,
-                                 severity >= minimum_console_severity ? "true" : "false" );
+                                 severity >= minimum_console_severity && ! async_writer ? "true" : "false" );
                 defaultConf.set( level,
                                  el::ConfigurationType::ToFile,
-                                 severity >= minimum_file_severity ? "true" : "false" );
+                                 severity >= minimum_file_severity && ! async_writer ? "true" : "false" );
             }
 
             el::Loggers::reconfigureLogger(log_id, defaultConf);
+            rsutils::refresh_elpp_level_gate( log_id );
         }
 
         void open_def() const
@@ -150,6 +164,7 @@ namespace librealsense
             defaultConf.setGlobally( el::ConfigurationType::ToStandardOutput, "false" );
 
             el::Loggers::reconfigureLogger(log_id, defaultConf);
+            rsutils::refresh_elpp_level_gate( log_id );
         }
 
 
@@ -162,6 +177,11 @@ namespace librealsense
                 open_def();
         }
 
+        ~logger_type()
+        {
+            stop_async();
+        }
+
         static bool try_get_log_severity(rs2_log_severity& severity)
         {
             static const char* severity_var_name = "LRS_LOG_LEVEL";
@@ -201,8 +221,20 @@ namespace librealsense
             if (!try_get_log_severity(minimum_file_severity))
                 minimum_file_severity = min_severity;
 
-            if (file_path)
-                filename = file_path;
+            if( file_path )
+            {
+                if( async_writer )
+                {
+                    // Lines already queued go to the previous file
+                    async_writer->drain();
+                    std::lock_guard< std::mutex > lock( log_mutex );
+                    log_file.close();
+                    file_size = 0;
+                    filename = file_path;
+                }
+                else
+                    filename = file_path;
+            }
 
             open();
         }
@@ -230,6 +262,85 @@ namespace librealsense
             }
         };
 
+        // Formats our logger's lines, in place of ELPP's default dispatcher, and queues them for the async writer
+        class async_dispatcher : public el::LogDispatchCallback
+        {
+        public:
+            logger_type * owner = nullptr;
+
+        protected:
+            void handle( el::LogDispatchData const * data ) noexcept override
+            {
+                el::LogMessage const & msg = *data->logMessage();
+                if( ! owner || ! owner->async_writer || msg.logger()->id() != owner->log_id )
+                    return;
+                auto severity = level_to_severity( msg.level() );
+                uint8_t targets = 0;
+                if( severity >= owner->minimum_console_severity )
+                    targets |= async_log_writer::to_console;
+                if( severity >= owner->minimum_file_severity )
+                    targets |= async_log_writer::to_file;
+                if( ! targets )
+                    return;
+                try
+                {
+                    bool const append_new_line = true;
+                    std::string line = msg.logger()->logBuilder()->build( &msg, append_new_line );
+                    owner->async_writer->push( line, targets );
+                }
+                catch( ... )
+                {
+                }
+            }
+        };
+
+        // Called on the writer's thread only
+        void write_line( std::string const & line, uint8_t targets )
+        {
+            if( targets & async_log_writer::to_console )
+                std::cout << line;
+            if( targets & async_log_writer::to_file )
+            {
+                std::lock_guard< std::mutex > lock( log_mutex );
+                if( ! log_file.is_open() )
+                {
+                    log_file.open( filename, std::ios::out | std::ios::app );
+                    file_size = log_file.is_open() ? size_t( log_file.tellp() ) : 0;
+                }
+                log_file << line;
+                file_size += line.size();
+                if( max_file_size && file_size >= max_file_size )
+                {
+                    // Same as ELPP does it: hand the full file to rolloutHandler, then start a new one
+                    log_file.close();
+                    rolloutHandler( filename.c_str(), file_size );
+                    log_file.open( filename, std::ios::out | std::ios::trunc );
+                    file_size = 0;
+                }
+            }
+        }
+
+        void flush_lines()
+        {
+            std::cout.flush();
+            std::lock_guard< std::mutex > lock( log_mutex );
+            if( log_file.is_open() )
+                log_file.flush();
+        }
+
+        // Writes whatever is queued and goes back to synchronous logging
+        void stop_async()
+        {
+            if( ! async_writer )
+                return;
+            el::Helpers::uninstallLogDispatchCallback< async_dispatcher >( async_dispatcher_name );
+            n_dropped_before += async_writer->get_statistics().dropped;
+            async_writer.reset();  // drains
+            std::lock_guard< std::mutex > lock( log_mutex );
+            log_file.close();
+            file_size = 0;
+        }
+
     public:
         void remove_callbacks()
         {
@@ -274,7 +385,10 @@ namespace librealsense
             el::Loggers::reconfigureLogger( log_id, el::ConfigurationType::ToFile, "false" );
             el::Loggers::reconfigureLogger( log_id, el::ConfigurationType::ToStandardOutput, "false" );
             el::Loggers::reconfigureLogger( log_id, el::ConfigurationType::MaxLogFileSize, "0" );
+            rsutils::refresh_elpp_level_gate( log_id );
             remove_callbacks();
+            stop_async();
+            max_file_size = 0;
 
             minimum_console_severity = RS2_LOG_SEVERITY_NONE;
             minimum_file_severity = RS2_LOG_SEVERITY_NONE;
@@ -318,6 +432,36 @@ namespace librealsense
 
             el::Loggers::reconfigureLogger( log_id, el::ConfigurationType::MaxLogFileSize, size.c_str() );
             el::Helpers::installPreRollOutCallback( rolloutHandler );
+            rsutils::refresh_elpp_level_gate( log_id );
+            max_file_size = max_size_in_bytes / 2;
+        }
+
+        // Log lines are formatted by the thread that logs them, then queued and written to console/file by a
+        // background thread, so logging does not wait for I/O. When more than 'queue_size' lines are waiting, further
+        // lines are dropped (and counted) rather than blocking; callbacks are unaffected and are still called
+        // synchronously.
+        //
+        // @param queue_size max number of lines waiting to be written; 0 to go back to synchronous logging
+        //
+        void enable_async_logging( unsigned queue_size )
+        {
+            stop_async();
+            if( queue_size )
+            {
+                async_writer.reset( new async_log_writer(
+                    queue_size,
+                    [this]( std::string const & line, uint8_t targets ) { write_line( line, targets ); },
+                    [this]() { flush_lines(); } ) );
+                el::Helpers::installLogDispatchCallback< async_dispatcher >( async_dispatcher_name );
+                el::Helpers::logDispatchCallback< async_dispatcher >( async_dispatcher_name )->owner = this;
+            }
+            open();
+        }
+
+        // Number of lines dropped because the async queue was full, since the start
+        uint64_t get_drop_count() const
+        {
+            return n_dropped_before + ( async_writer ? async_writer->get_statistics().dropped : 0 );
         }
     };
 #else //BUILD_EASYLOGGINGPP
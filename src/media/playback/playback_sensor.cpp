@@ -10,6 +10,7 @@
 #include "media/ros/ros_reader.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 using namespace librealsense;
@@ -306,6 +307,11 @@ void playback_sensor::set_frames_callback( rs2_frame_callback_sptr callback )
 {
     m_user_callback = callback;
 }
+rsutils::json playback_sensor::get_statistics() const
+{
+    return rsutils::json::object();
+}
+
 stream_profiles playback_sensor::get_active_streams() const
 {
     std::lock_guard<std::mutex> lock(m_active_profile_mutex);
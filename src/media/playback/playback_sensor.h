@@ -82,6 +82,9 @@ namespace librealsense
             throw not_implemented_exception( "Registering options value changed callback is not implemented for playback sensor" );
         }
 
+        // Frames are dispatched straight from the file: there are no counters to report
+        rsutils::json get_statistics() const override;
+
     protected:
         void set_active_streams(const stream_profiles& requests);
 
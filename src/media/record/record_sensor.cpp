@@ -9,6 +9,7 @@
 #include <src/core/frame-callback.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 using namespace librealsense;
 
@@ -202,6 +203,11 @@ stream_profiles const & record_sensor::get_raw_stream_profiles() const
     return m_sensor.get_raw_stream_profiles();
 }
 
+rsutils::json record_sensor::get_statistics() const
+{
+    return m_sensor.get_statistics();
+}
+
 
 int record_sensor::register_before_streaming_changes_callback(std::function<void(bool)> callback)
 {
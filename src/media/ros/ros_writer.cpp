@@ -105,17 +105,14 @@ namespace librealsense
         timestamp_domain.value = librealsense::get_string(frame->get_frame_timestamp_domain());
         write_message(metadata_topic, timestamp, timestamp_domain);
 
-        for (int i = 0; i < static_cast<rs2_frame_metadata_value>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); i++)
+        rs2_frame_metadata_entry entries[RS2_FRAME_METADATA_COUNT];
+        int const n_entries = frame->find_all_metadata(entries, RS2_FRAME_METADATA_COUNT);
+        for (int i = 0; i < n_entries; i++)
         {
-            rs2_frame_metadata_value type = static_cast<rs2_frame_metadata_value>(i);
-            rs2_metadata_type md;
-            if (frame->find_metadata(type, &md))
-            {
-                diagnostic_msgs::KeyValue md_msg;
-                md_msg.key = librealsense::get_string(type);
-                md_msg.value = std::to_string(md);
-                write_message(metadata_topic, timestamp, md_msg);
-            }
+            diagnostic_msgs::KeyValue md_msg;
+            md_msg.key = librealsense::get_string(entries[i].key);
+            md_msg.value = std::to_string(entries[i].value);
+            write_message(metadata_topic, timestamp, md_msg);
         }
     }
 
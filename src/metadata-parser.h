@@ -8,6 +8,9 @@
 #include "metadata.h"
 
 #include <cmath>
+#include <array>
+#include <vector>
+#include <algorithm>
 #include <rsutils/number/crc32.h>
 #include <rsutils/string/from.h>
 #include <rsutils/easylogging/easyloggingpp.h>
@@ -24,6 +27,81 @@ namespace librealsense
         virtual ~md_attribute_parser_base() = default;
     };
 
+    // The metadata parsers of a sensor, shared by all its frames: a flat table indexed by metadata key, so finding the
+    // parsers of a key is a single index rather than a map lookup.
+    //
+    // A key can have more than one parser, as required for D405, in which exposure should be available from the same
+    // sensor both for depth and color frames. All of them are tried, and the last one to find a value wins.
+    //
+    class metadata_parser_map
+    {
+        struct entry
+        {
+            std::shared_ptr< md_attribute_parser_base > first;  // null if the key has no parsers
+            std::vector< std::shared_ptr< md_attribute_parser_base > > others;
+        };
+        std::array< entry, RS2_FRAME_METADATA_ACTUAL_COUNT > _entries;
+        std::vector< rs2_frame_metadata_value > _public_keys;  // the public keys we have parsers for, in order
+
+        entry const * get_entry( rs2_frame_metadata_value key ) const
+        {
+            return unsigned( key ) < _entries.size() ? &_entries[key] : nullptr;
+        }
+
+        bool find( const frame & frm, entry const & e, rs2_metadata_type * p_value ) const
+        {
+            bool value_retrieved = e.first->find( frm, p_value );
+            for( auto & parser : e.others )
+                if( parser->find( frm, p_value ) )
+                    value_retrieved = true;
+            return value_retrieved;
+        }
+
+    public:
+        // Parsers must all be added before frames start using the map
+        void insert( rs2_frame_metadata_value key, std::shared_ptr< md_attribute_parser_base > parser )
+        {
+            if( unsigned( key ) >= _entries.size() )
+                throw invalid_value_exception( rsutils::string::from() << "invalid metadata key " << int( key ) );
+            auto & e = _entries[key];
+            if( e.first )
+            {
+                e.others.push_back( std::move( parser ) );
+                return;
+            }
+            e.first = std::move( parser );
+            if( key < RS2_FRAME_METADATA_COUNT )
+                _public_keys.insert( std::upper_bound( _public_keys.begin(), _public_keys.end(), key ), key );
+        }
+
+        bool contains( rs2_frame_metadata_value key ) const
+        {
+            auto e = get_entry( key );
+            return e && e->first;
+        }
+
+        bool find( const frame & frm, rs2_frame_metadata_value key, rs2_metadata_type * p_value ) const
+        {
+            auto e = get_entry( key );
+            return e && e->first && find( frm, *e, p_value );
+        }
+
+        // One pass over all the keys we have parsers for
+        int find_all( const frame & frm, rs2_frame_metadata_entry * entries, int capacity ) const
+        {
+            int n = 0;
+            for( auto key : _public_keys )
+            {
+                if( n >= capacity )
+                    break;
+                rs2_metadata_type value;
+                if( find( frm, _entries[key], &value ) )
+                    entries[n++] = { key, value };
+            }
+            return n;
+        }
+    };
+
     /**\brief metadata parser class - support metadata in format: rs2_frame_metadata_value, rs2_metadata_type */
     class md_constant_parser : public md_attribute_parser_base
     {
@@ -55,7 +133,7 @@ namespace librealsense
             for (int i = 0; i < static_cast<int>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); ++i)
             {
                 auto frame_md_type = static_cast<rs2_frame_metadata_value>(i);
-                md_parser_map->insert(std::make_pair(frame_md_type, std::make_shared<md_constant_parser>(frame_md_type)));
+                md_parser_map->insert(frame_md_type, std::make_shared<md_constant_parser>(frame_md_type));
             }
             return md_parser_map;
         }
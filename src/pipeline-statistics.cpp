@@ -0,0 +1,135 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "pipeline-statistics.h"
+
+#include <rsutils/json.h>
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace librealsense {
+
+
+latency_histogram::latency_histogram()
+    : _sum( 0 )
+    , _max( 0 )
+{
+    for( auto & b : _buckets )
+        b.store( 0, std::memory_order_relaxed );
+}
+
+
+static int highest_bit( uint64_t value )  // value must not be 0
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64( &index, value );
+    return int( index );
+#else
+    return 63 - __builtin_clzll( value );
+#endif
+}
+
+
+// Values below 2^sub_bucket_bits each have their own bucket; above that, each power of 2 is split into 2^sub_bucket_bits
+// linear buckets
+/*static*/ int latency_histogram::bucket_of( uint64_t value )
+{
+    uint64_t const sub_buckets = uint64_t( 1 ) << sub_bucket_bits;
+    if( value < sub_buckets )
+        return int( value );
+    int shift = highest_bit( value ) - sub_bucket_bits;
+    if( shift > max_exponent - sub_bucket_bits )
+        return n_buckets - 1;
+    return int( ( shift + 1 ) * sub_buckets + ( ( value >> shift ) - sub_buckets ) );
+}
+
+
+/*static*/ uint64_t latency_histogram::bucket_upper_bound( int bucket )
+{
+    uint64_t const sub_buckets = uint64_t( 1 ) << sub_bucket_bits;
+    if( uint64_t( bucket ) < sub_buckets )
+        return uint64_t( bucket );
+    int const shift = int( bucket / sub_buckets ) - 1;
+    uint64_t const mantissa = sub_buckets + bucket % sub_buckets;
+    return ( ( mantissa + 1 ) << shift ) - 1;
+}
+
+
+void latency_histogram::record( int64_t nanoseconds )
+{
+    uint64_t const value = nanoseconds > 0 ? uint64_t( nanoseconds ) : 0;
+    _buckets[bucket_of( value )].fetch_add( 1, std::memory_order_relaxed );
+    _sum.fetch_add( value, std::memory_order_relaxed );
+    auto max = _max.load( std::memory_order_relaxed );
+    while( value > max && ! _max.compare_exchange_weak( max, value, std::memory_order_relaxed ) )
+        ;
+}
+
+
+rsutils::json latency_histogram::to_json() const
+{
+    uint64_t buckets[n_buckets];
+    uint64_t total = 0;
+    for( int i = 0; i < n_buckets; ++i )
+        total += buckets[i] = _buckets[i].load( std::memory_order_relaxed );
+    auto const max = _max.load( std::memory_order_relaxed );
+
+    auto const us = []( uint64_t ns ) { return double( ns ) / 1000.; };
+    auto percentile = [&]( double p ) -> double
+    {
+        if( ! total )
+            return 0.;
+        // Nearest rank: the smallest value that at least p of the values are not above
+        auto const rank = std::max( uint64_t( std::ceil( p * double( total ) ) ), uint64_t( 1 ) );
+        uint64_t seen = 0;
+        for( int i = 0; i < n_buckets; ++i )
+        {
+            seen += buckets[i];
+            if( seen >= rank )
+                return us( i == n_buckets - 1 ? max : std::min( bucket_upper_bound( i ), max ) );
+        }
+        return us( max );
+    };
+
+    rsutils::json j = rsutils::json::object();
+    j["count"] = total;
+    j["mean-us"] = total ? us( _sum.load( std::memory_order_relaxed ) ) / double( total ) : 0.;
+    j["p50-us"] = percentile( 0.5 );
+    j["p90-us"] = percentile( 0.9 );
+    j["p99-us"] = percentile( 0.99 );
+    j["max-us"] = us( max );
+    return j;
+}
+
+
+rsutils::json frame_source_statistics::to_json() const
+{
+    rsutils::json j = rsutils::json::object();
+    j["frames-produced"] = frames_produced.load();
+    j["bytes-produced"] = bytes_produced.load();
+    j["buffers-recycled"] = buffers_recycled.load();
+    j["buffers-allocated"] = buffers_allocated.load();
+    j["frames-dropped"] = frames_dropped.load();
+    j["callback"] = callback.to_json();
+    return j;
+}
+
+
+rsutils::json processing_block_statistics::to_json() const
+{
+    rsutils::json j = rsutils::json::object();
+    j["frames-processed"] = frames_processed.load();
+    j["bytes-processed"] = bytes_processed.load();
+    j["processing"] = processing.to_json();
+    return j;
+}
+
+
+}  // namespace librealsense
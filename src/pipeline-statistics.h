@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <rsutils/json-fwd.h>
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Distribution of durations, HDR-histogram style: buckets are linear within each power of 2, so every recorded value is
+// kept with ~6% precision from nanoseconds up to minutes, in fixed memory. Recording is a few relaxed atomic increments
+// and never blocks, so it can be done for every frame, always.
+//
+class latency_histogram
+{
+public:
+    latency_histogram();
+
+    void record( int64_t nanoseconds );
+
+    // { count, mean-us, p50-us, p90-us, p99-us, max-us }, in microseconds; percentiles are the upper bounds of their
+    // buckets. Values may be slightly inconsistent with each other if recording goes on at the same time.
+    rsutils::json to_json() const;
+
+private:
+    static constexpr int sub_bucket_bits = 4;  // 16 buckets per power of 2
+    static constexpr int max_exponent = 40;    // ~18 minutes; anything longer goes in the last bucket
+    static constexpr int n_buckets = ( max_exponent - sub_bucket_bits + 2 ) << sub_bucket_bits;
+
+    static int bucket_of( uint64_t value );
+    static uint64_t bucket_upper_bound( int bucket );
+
+    std::atomic< uint64_t > _buckets[n_buckets];  // the count is their sum
+    std::atomic< uint64_t > _sum;
+    std::atomic< uint64_t > _max;
+};
+
+
+// Counters for the frames a frame_source (a sensor, or the output of a processing block) produces. All are monotonic.
+//
+struct frame_source_statistics
+{
+    std::atomic< uint64_t > frames_produced{ 0 };
+    std::atomic< uint64_t > bytes_produced{ 0 };     // frame memory we provided (software frames bring their own)
+    std::atomic< uint64_t > buffers_recycled{ 0 };   // frame memory reused from a previous frame
+    std::atomic< uint64_t > buffers_allocated{ 0 };  // frame memory that had to be allocated
+    std::atomic< uint64_t > frames_dropped{ 0 };     // not published: too many frames were still held (frames-queue-size)
+    latency_histogram callback;                      // how long the callback took with each frame
+
+    rsutils::json to_json() const;
+};
+
+
+// What a processing block does with the frames it is given
+//
+struct processing_block_statistics
+{
+    std::atomic< uint64_t > frames_processed{ 0 };
+    std::atomic< uint64_t > bytes_processed{ 0 };
+    latency_histogram processing;  // including the output callback, when it's called inline
+
+    rsutils::json to_json() const;
+};
+
+
+}  // namespace librealsense
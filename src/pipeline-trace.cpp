@@ -0,0 +1,371 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "pipeline-trace.h"
+#include <librealsense2/hpp/rs_types.hpp>  // LOG_XXX need rs2_log_severity
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <fstream>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+
+namespace librealsense {
+
+
+namespace {
+
+
+enum : uint8_t
+{
+    span_event,         // value is the end time
+    async_begin_event,  // value is the id
+    async_end_event,
+};
+
+
+struct trace_event
+{
+    char const * name;
+    int64_t time;
+    uint64_t value;
+    unsigned long long frame_number;
+    uint8_t kind;
+};
+
+
+}  // namespace
+
+
+// One thread's events: only that thread adds to them, in chunks that are never moved, so the trace can read them at any
+// time up to the published count of each chunk
+struct pipeline_trace_thread
+{
+    static constexpr size_t chunk_size = 1024;
+    static constexpr size_t max_events = 256 * chunk_size;  // ~10MB
+
+    struct chunk
+    {
+        trace_event events[chunk_size];
+        std::atomic< size_t > count;
+        std::atomic< chunk * > next;
+
+        chunk() : count( 0 ), next( nullptr ) {}
+    };
+
+    unsigned const tid;
+    chunk * const head;
+    chunk * tail;         // writing thread only
+    size_t n_events = 0;  // writing thread only
+    std::atomic< uint64_t > n_dropped;
+
+    explicit pipeline_trace_thread( unsigned tid_ )
+        : tid( tid_ )
+        , head( new chunk )
+        , tail( head )
+        , n_dropped( 0 )
+    {
+    }
+
+    ~pipeline_trace_thread()
+    {
+        for( chunk * c = head; c; )
+        {
+            chunk * next = c->next.load();
+            delete c;
+            c = next;
+        }
+    }
+
+    void push( trace_event const & e )
+    {
+        auto n = tail->count.load( std::memory_order_relaxed );
+        if( n == chunk_size )
+        {
+            chunk * c = n_events < max_events ? new ( std::nothrow ) chunk : nullptr;
+            if( ! c )
+            {
+                ++n_dropped;
+                return;
+            }
+            tail->next.store( c, std::memory_order_release );
+            tail = c;
+            n = 0;
+        }
+        tail->events[n] = e;
+        tail->count.store( n + 1, std::memory_order_release );
+        ++n_events;
+    }
+
+    template< class F >
+    void for_each( F && f ) const
+    {
+        for( chunk const * c = head; c; c = c->next.load( std::memory_order_acquire ) )
+        {
+            auto const n = c->count.load( std::memory_order_acquire );
+            for( size_t i = 0; i < n; ++i )
+                f( c->events[i] );
+        }
+    }
+};
+
+
+std::atomic< unsigned > pipeline_trace::_active_generation( 0 );
+
+
+// The active trace: set while it's alive, so threads can register with it
+static std::mutex & active_trace_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+static pipeline_trace * active_trace = nullptr;
+static std::weak_ptr< pipeline_trace > active_trace_wp;
+static unsigned last_generation = 0;
+
+
+namespace {
+struct thread_slot
+{
+    std::shared_ptr< pipeline_trace_thread > buffer;
+    unsigned generation = 0;
+};
+}  // namespace
+static thread_local thread_slot this_thread_slot;
+
+
+pipeline_trace::pipeline_trace( std::string const & filename, unsigned generation )
+    : _filename( filename )
+    , _generation( generation )
+    , _start_time( now() )
+{
+}
+
+
+/*static*/ std::shared_ptr< pipeline_trace > pipeline_trace::start( std::string const & filename )
+{
+    std::shared_ptr< pipeline_trace > trace;
+    {
+        std::lock_guard< std::mutex > lock( active_trace_mutex() );
+        trace = active_trace_wp.lock();
+        if( ! trace )
+        {
+            // Generations tell threads that their buffer belongs to an older trace
+            if( ! ++last_generation )
+                ++last_generation;
+            trace.reset( new pipeline_trace( filename, last_generation ) );
+            active_trace = trace.get();
+            active_trace_wp = trace;
+            _active_generation.store( last_generation, std::memory_order_release );
+            LOG_INFO( "Pipeline trace started; will be written to " << filename );
+            return trace;
+        }
+    }
+    if( trace->get_filename() != filename )
+        LOG_WARNING( "Pipeline trace already active, writing to " << trace->get_filename() << "; ignoring " << filename );
+    return trace;
+}
+
+
+pipeline_trace::~pipeline_trace()
+{
+    {
+        std::lock_guard< std::mutex > lock( active_trace_mutex() );
+        if( active_trace == this )
+        {
+            active_trace = nullptr;
+            _active_generation.store( 0, std::memory_order_release );
+        }
+    }
+    try
+    {
+        write();
+    }
+    catch( std::exception const & e )
+    {
+        LOG_ERROR( "Failed to write pipeline trace " << _filename << ": " << e.what() );
+    }
+}
+
+
+/*static*/ int64_t pipeline_trace::now()
+{
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+               std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+
+/*static*/ char const * pipeline_trace::intern( std::string const & name )
+{
+    // Never cleared: the set only grows with distinct names, and the strings in it never move
+    static std::mutex m;
+    static std::unordered_set< std::string > names;
+    std::lock_guard< std::mutex > lock( m );
+    return names.insert( name ).first->c_str();
+}
+
+
+/*static*/ pipeline_trace_thread * pipeline_trace::this_thread_buffer( unsigned generation )
+{
+    auto & slot = this_thread_slot;
+    if( slot.generation == generation )
+        return slot.buffer.get();
+
+    std::lock_guard< std::mutex > lock( active_trace_mutex() );
+    if( ! active_trace || active_trace->_generation != generation )
+        return nullptr;  // ended since we checked
+    std::lock_guard< std::mutex > threads_lock( active_trace->_threads_mutex );
+    slot.buffer = std::make_shared< pipeline_trace_thread >( unsigned( active_trace->_threads.size() + 1 ) );
+    slot.generation = generation;
+    active_trace->_threads.push_back( slot.buffer );
+    return slot.buffer.get();
+}
+
+
+/*static*/ void pipeline_trace::add( char const * name,
+                                     uint8_t kind,
+                                     int64_t time,
+                                     uint64_t value,
+                                     unsigned long long frame_number )
+{
+    auto const generation = _active_generation.load( std::memory_order_acquire );
+    if( ! generation )
+        return;
+    if( auto buffer = this_thread_buffer( generation ) )
+        buffer->push( { name, time, value, frame_number, kind } );
+}
+
+
+/*static*/ void pipeline_trace::add_span( char const * name, int64_t start, int64_t end, unsigned long long frame_number )
+{
+    add( name, span_event, start, uint64_t( end ), frame_number );
+}
+
+
+/*static*/ void pipeline_trace::begin_async( char const * name, uint64_t id, unsigned long long frame_number )
+{
+    if( is_active() )
+        add( name, async_begin_event, now(), id, frame_number );
+}
+
+
+/*static*/ void pipeline_trace::end_async( char const * name, uint64_t id, unsigned long long frame_number )
+{
+    if( is_active() )
+        add( name, async_end_event, now(), id, frame_number );
+}
+
+
+void pipeline_trace::write() const
+{
+    struct thread_event
+    {
+        trace_event const * e;
+        unsigned tid;
+    };
+
+    std::vector< std::shared_ptr< pipeline_trace_thread > > threads;
+    {
+        std::lock_guard< std::mutex > lock( _threads_mutex );
+        threads = _threads;
+    }
+    std::vector< thread_event > events;
+    uint64_t n_dropped = 0;
+    for( auto & thread : threads )
+    {
+        thread->for_each( [&]( trace_event const & e ) { events.push_back( { &e, thread->tid } ); } );
+        n_dropped += thread->n_dropped.load();
+    }
+    std::stable_sort( events.begin(),
+                      events.end(),
+                      []( thread_event const & a, thread_event const & b ) { return a.e->time < b.e->time; } );
+
+    // Match async ends to the latest begin with the same name and id
+    std::vector< bool > matched( events.size(), false );
+    {
+        struct key_hash
+        {
+            size_t operator()( std::pair< char const *, uint64_t > const & k ) const
+            {
+                return std::hash< char const * >()( k.first ) ^ std::hash< uint64_t >()( k.second );
+            }
+        };
+        std::unordered_map< std::pair< char const *, uint64_t >, std::vector< size_t >, key_hash > open;
+        for( size_t i = 0; i < events.size(); ++i )
+        {
+            auto & e = *events[i].e;
+            if( e.kind == async_begin_event )
+                open[{ e.name, e.value }].push_back( i );
+            else if( e.kind == async_end_event )
+            {
+                auto it = open.find( { e.name, e.value } );
+                if( it != open.end() && ! it->second.empty() )
+                {
+                    matched[it->second.back()] = matched[i] = true;
+                    it->second.pop_back();
+                }
+            }
+        }
+    }
+
+    std::ofstream out( _filename );
+    if( ! out )
+        throw std::runtime_error( "cannot open file" );
+
+    std::unordered_map< char const *, std::string > quoted_names;
+    auto quoted = [&]( char const * name ) -> std::string const &
+    {
+        auto & q = quoted_names[name];
+        if( q.empty() )
+            q = rsutils::json( name ).dump();
+        return q;
+    };
+    auto micros = []( int64_t ns )
+    {
+        char buf[32];
+        snprintf( buf, sizeof( buf ), "%.3f", double( ns ) / 1000. );
+        return std::string( buf );
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped-events\":" << n_dropped << "},\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"librealsense\"}}";
+    for( auto & thread : threads )
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->tid
+            << ",\"args\":{\"name\":\"thread " << thread->tid << "\"}}";
+    size_t n_written = 0;
+    for( size_t i = 0; i < events.size(); ++i )
+    {
+        auto & e = *events[i].e;
+        if( e.kind != span_event && ! matched[i] )
+            continue;
+        out << ",\n{\"name\":" << quoted( e.name ) << ",\"cat\":\"frames\",\"pid\":1,\"tid\":" << events[i].tid
+            << ",\"ts\":" << micros( e.time - _start_time );
+        switch( e.kind )
+        {
+        case span_event:
+            out << ",\"ph\":\"X\",\"dur\":" << micros( int64_t( e.value ) - e.time );
+            break;
+        case async_begin_event:
+        case async_end_event:
+            char id[24];
+            snprintf( id, sizeof( id ), "0x%" PRIx64, uint64_t( e.value ) );
+            out << ",\"ph\":\"" << ( e.kind == async_begin_event ? 'b' : 'e' ) << "\",\"id\":\"" << id << "\"";
+            break;
+        }
+        if( e.frame_number )
+            out << ",\"args\":{\"frame\":" << e.frame_number << "}";
+        out << "}";
+        ++n_written;
+    }
+    out << "\n]}\n";
+    LOG_INFO( "Pipeline trace written to " << _filename << ": " << n_written << " events"
+                                           << ( n_dropped ? " (" + std::to_string( n_dropped ) + " dropped)" : "" ) );
+}
+
+
+}  // namespace librealsense
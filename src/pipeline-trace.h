@@ -0,0 +1,113 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <memory>
+#include <string>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+struct pipeline_trace_thread;
+
+
+// Records how long each stage of the frame pipeline takes (backend frame handling, metadata parsing, format conversion,
+// syncer waits, processing blocks, user callbacks), and writes it as a Chrome trace (JSON, also loaded by Perfetto)
+// when the trace ends.
+//
+// A trace is started by a context whose settings have a 'trace-file', and ends when the last such context is destroyed.
+// Recording is process-wide: every frame goes through the same stages, no matter which context it belongs to.
+//
+// Each thread records into its own buffer, so recording needs no locks. When no trace is active, recording costs a
+// single atomic load.
+//
+class pipeline_trace
+{
+public:
+    ~pipeline_trace();  // writes the file
+
+    // Returns the active trace, or starts one writing to 'filename' if there is none
+    static std::shared_ptr< pipeline_trace > start( std::string const & filename );
+
+    static bool is_active() { return _active_generation.load( std::memory_order_acquire ) != 0; }
+
+    // Monotonic, in nanoseconds
+    static int64_t now();
+
+    // Span names are kept as pointers: they must outlive the trace. Literals do; anything else should be interned.
+    static char const * intern( std::string const & name );
+
+    // A stage that started and ended on this thread
+    static void add_span( char const * name, int64_t start, int64_t end, unsigned long long frame_number = 0 );
+
+    // A stage that starts on one thread and may end on another (e.g., waiting in the syncer): the begin and end with
+    // the same name and id are matched when the trace is written. Ones without a match are left out.
+    static void begin_async( char const * name, uint64_t id, unsigned long long frame_number = 0 );
+    static void end_async( char const * name, uint64_t id, unsigned long long frame_number = 0 );
+
+    std::string const & get_filename() const { return _filename; }
+
+private:
+    pipeline_trace( std::string const & filename, unsigned generation );
+
+    static void add( char const * name, uint8_t kind, int64_t time, uint64_t value, unsigned long long frame_number );
+    static pipeline_trace_thread * this_thread_buffer( unsigned generation );
+
+    void write() const;
+
+    std::string const _filename;
+    unsigned const _generation;
+    int64_t const _start_time;
+
+    mutable std::mutex _threads_mutex;
+    std::vector< std::shared_ptr< pipeline_trace_thread > > _threads;
+
+    static std::atomic< unsigned > _active_generation;  // 0 when no trace is active
+};
+
+
+// Records a span from construction to destruction, if a trace is active at construction:
+//     pipeline_trace_span span( "metadata parse", frame_number );
+//
+class pipeline_trace_span
+{
+    char const * _name;
+    unsigned long long _frame_number;
+    int64_t _start;
+
+public:
+    pipeline_trace_span( char const * name, unsigned long long frame_number = 0 )
+        : _name( name )
+        , _frame_number( frame_number )
+        , _start( pipeline_trace::is_active() ? pipeline_trace::now() : 0 )
+    {
+    }
+
+    ~pipeline_trace_span()
+    {
+        if( _start )
+            pipeline_trace::add_span( _name, _start, pipeline_trace::now(), _frame_number );
+    }
+
+    // For when the frame number is only known later
+    void set_frame_number( unsigned long long frame_number ) { _frame_number = frame_number; }
+
+    // Records the span now rather than on destruction
+    void end()
+    {
+        if( _start )
+            pipeline_trace::add_span( _name, _start, pipeline_trace::now(), _frame_number );
+        _start = 0;
+    }
+
+    pipeline_trace_span( pipeline_trace_span const & ) = delete;
+    pipeline_trace_span & operator=( pipeline_trace_span const & ) = delete;
+};
+
+
+}  // namespace librealsense
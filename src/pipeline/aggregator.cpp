@@ -6,6 +6,7 @@
 #include "aggregator.h"
 #include <src/composite-frame.h>
 #include <src/core/frame-processor-callback.h>
+#include <rsutils/json.h>
 
 namespace librealsense
 {
@@ -13,7 +14,7 @@ namespace librealsense
     {
         aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
             processing_block("aggregator"),
-            _queue(new single_consumer_frame_queue<frame_holder>(1)),
+            _queue(new single_consumer_frame_queue<frame_holder>(1, [this](frame_holder const &) { ++_framesets_dropped; })),
             _streams_to_aggregate_ids(streams_to_aggregate),
             _streams_to_sync_ids(streams_to_sync),
             _accepting(true)
@@ -120,5 +121,13 @@ namespace librealsense
             _accepting = false;
             _queue->stop();
         }
+
+        rsutils::json aggregator::get_statistics() const
+        {
+            auto j = processing_block::get_statistics();
+            j["queue-size"] = _queue->size();
+            j["framesets-dropped"] = _framesets_dropped.load();
+            return j;
+        }
     }
 }
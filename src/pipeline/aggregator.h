@@ -26,6 +26,7 @@ namespace librealsense
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
             std::atomic<bool> _accepting;
+            std::atomic<uint64_t> _framesets_dropped{ 0 };  // replaced in the queue before they were dequeued
             void handle_frame(frame_holder frame, synthetic_source_interface* source);
         public:
             aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync);
@@ -33,6 +34,7 @@ namespace librealsense
             bool try_dequeue(frame_holder* item);
             void start();
             void stop();
+            rsutils::json get_statistics() const override;
         };
     }
 }
@@ -14,6 +14,7 @@
 #endif
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 
 namespace librealsense
@@ -65,6 +66,34 @@ namespace librealsense
             return unsafe_get_active_profile();
         }
 
+        rsutils::json pipeline::get_statistics() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto profile = unsafe_get_active_profile();
+
+            rsutils::json j = rsutils::json::object();
+            if (_syncer)
+                j["syncer"] = _syncer->get_statistics();
+            if (_aggregator)
+                j["aggregator"] = _aggregator->get_statistics();
+            rsutils::json sensors = rsutils::json::array();
+            if (auto dev = profile->get_device())
+            {
+                for (size_t i = 0; i < dev->get_sensors_count(); ++i)
+                {
+                    auto & sensor = dev->get_sensor(i);
+                    if (sensor.get_active_streams().empty())
+                        continue;
+                    auto stats = sensor.get_statistics();
+                    if (sensor.supports_info(RS2_CAMERA_INFO_NAME))
+                        stats["name"] = sensor.get_info(RS2_CAMERA_INFO_NAME);
+                    sensors.push_back(std::move(stats));
+                }
+            }
+            j["sensors"] = std::move(sensors);
+            return j;
+        }
+
         std::shared_ptr<profile> pipeline::unsafe_get_active_profile() const
         {
             if (!_active_profile)
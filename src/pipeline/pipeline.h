@@ -39,6 +39,9 @@ namespace librealsense
             void set_device( std::shared_ptr< librealsense::device_interface >  dev );
             std::shared_ptr< librealsense::device_interface >  get_device();
 
+            // Statistics of the syncer, the aggregator and the streaming sensors, as a JSON object
+            rsutils::json get_statistics() const;
+
         protected:
             rs2_frame_callback_sptr get_callback(std::vector<int> unique_ids);
             std::vector<int> on_start(std::shared_ptr<profile> profile);
@@ -1086,15 +1086,20 @@ namespace librealsense
     /////////////////////////////
     // MJPEG unpacking routines //
     /////////////////////////////
-    void unpack_mjpeg( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
+    void unpack_mjpeg( rs2_format dst_format, uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
+        // Decode to the channels we were asked for, whatever the JPEG has: grayscale JPEGs are expanded to RGB8, and
+        // color JPEGs reduced to Y8
+        int const channels = dst_format == RS2_FORMAT_Y8 ? 1 : 3;
         int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
+        auto uncompressed = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, channels);
+        if (uncompressed)
         {
-            auto uncompressed_size = w * h * bpp;
-            std::memcpy( dest[0], uncompressed_rgb, uncompressed_size );
-            stbi_image_free(uncompressed_rgb);
+            if (w == width && h == height)
+                std::memcpy( dest[0], uncompressed, size_t( w ) * h * channels );
+            else
+                LOG_ERROR("jpeg is " << w << "x" << h << "; expected " << width << "x" << height);
+            stbi_image_free(uncompressed);
         }
         else
             LOG_ERROR("jpeg decode failed");
@@ -1128,7 +1133,7 @@ namespace librealsense
 
     void mjpeg_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        unpack_mjpeg(_target_format, dest, source, width, height, actual_size, input_size);
     }
 
     void bgr_to_rgb::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+
+namespace librealsense {
+
+
+// Kernels that need more than the compiler flags allow are built with per-function target attributes, and must only
+// be called once the CPU is known to support them.
+#if defined( __SSSE3__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define RS2_HAS_AVX2_KERNELS
+#endif
+
+
+inline bool cpu_has_avx2()
+{
+#ifdef RS2_HAS_AVX2_KERNELS
+    return __builtin_cpu_supports( "avx2" );
+#else
+    return false;
+#endif
+}
+
+
+}  // namespace librealsense
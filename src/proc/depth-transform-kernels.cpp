@@ -0,0 +1,267 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "depth-transform-kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef __SSSE3__
+#include <emmintrin.h>  // SSE2 is all we need
+#endif
+
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+#include <arm_neon.h>
+#endif
+
+
+namespace librealsense {
+
+
+// Scalar versions, which also take care of whatever the vector code leaves over at the end
+
+static void z16_to_meters_scalar( float * out, const uint16_t * in, int count, float depth_units )
+{
+    for( int i = 0; i < count; ++i )
+        out[i] = depth_units * in[i];
+}
+
+static void z16_to_disparity_scalar( float * out, const uint16_t * in, int count, float factor )
+{
+    for( int i = 0; i < count; ++i )
+        out[i] = in[i] ? factor / in[i] : 0.f;
+}
+
+static void disparity_to_z16_scalar( uint16_t * out, const float * in, int count, float factor )
+{
+    for( int i = 0; i < count; ++i )
+    {
+        if( std::isnormal( in[i] ) )
+            out[i] = static_cast< uint16_t >( std::min( std::max( factor / in[i] + 0.5f, 0.f ), 65535.f ) );
+        else
+            out[i] = 0;
+    }
+}
+
+static void disparity_to_meters_scalar( float * out, const float * in, int count, float factor_in_meters )
+{
+    for( int i = 0; i < count; ++i )
+        out[i] = std::isnormal( in[i] ) ? factor_in_meters / in[i] : 0.f;
+}
+
+
+#ifdef __SSSE3__
+
+// Loads 8 Z16 pixels as two vectors of 4 floats
+static inline void load_z16( const uint16_t * in, __m128 & lo, __m128 & hi )
+{
+    __m128i z = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in ) );
+    lo = _mm_cvtepi32_ps( _mm_unpacklo_epi16( z, _mm_setzero_si128() ) );
+    hi = _mm_cvtepi32_ps( _mm_unpackhi_epi16( z, _mm_setzero_si128() ) );
+}
+
+// All bits set where x is a normal float, i.e., its exponent is neither all 0s (0, denormals) nor all 1s (inf, NaN)
+static inline __m128 is_normal( __m128 x )
+{
+    __m128i const exponent_mask = _mm_set1_epi32( 0x7f800000 );
+    __m128i exponent = _mm_and_si128( _mm_castps_si128( x ), exponent_mask );
+    __m128i bad = _mm_or_si128( _mm_cmpeq_epi32( exponent, _mm_setzero_si128() ), _mm_cmpeq_epi32( exponent, exponent_mask ) );
+    return _mm_castsi128_ps( _mm_xor_si128( bad, _mm_set1_epi32( -1 ) ) );
+}
+
+static int z16_to_meters_sse( float * out, const uint16_t * in, int count, float depth_units )
+{
+    __m128 const units = _mm_set1_ps( depth_units );
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128 lo, hi;
+        load_z16( in + i, lo, hi );
+        _mm_storeu_ps( out + i, _mm_mul_ps( lo, units ) );
+        _mm_storeu_ps( out + i + 4, _mm_mul_ps( hi, units ) );
+    }
+    return i;
+}
+
+static int z16_to_disparity_sse( float * out, const uint16_t * in, int count, float factor )
+{
+    __m128 const f = _mm_set1_ps( factor );
+    __m128 const zero = _mm_setzero_ps();
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128 lo, hi;
+        load_z16( in + i, lo, hi );
+        // Division by 0 gives inf, which is then masked out
+        _mm_storeu_ps( out + i, _mm_andnot_ps( _mm_cmpeq_ps( lo, zero ), _mm_div_ps( f, lo ) ) );
+        _mm_storeu_ps( out + i + 4, _mm_andnot_ps( _mm_cmpeq_ps( hi, zero ), _mm_div_ps( f, hi ) ) );
+    }
+    return i;
+}
+
+static inline __m128i disparity_to_z16_sse( __m128 d, __m128 f )
+{
+    __m128 v = _mm_add_ps( _mm_div_ps( f, d ), _mm_set1_ps( 0.5f ) );
+    v = _mm_min_ps( _mm_max_ps( v, _mm_setzero_ps() ), _mm_set1_ps( 65535.f ) );
+    return _mm_and_si128( _mm_cvttps_epi32( v ), _mm_castps_si128( is_normal( d ) ) );
+}
+
+static int disparity_to_z16_sse( uint16_t * out, const float * in, int count, float factor )
+{
+    __m128 const f = _mm_set1_ps( factor );
+    __m128i const bias = _mm_set1_epi32( 0x8000 );
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128i lo = disparity_to_z16_sse( _mm_loadu_ps( in + i ), f );
+        __m128i hi = disparity_to_z16_sse( _mm_loadu_ps( in + i + 4 ), f );
+        // SSE2 can only pack to signed 16 bits: shift the range down and back up again after packing
+        __m128i packed = _mm_packs_epi32( _mm_sub_epi32( lo, bias ), _mm_sub_epi32( hi, bias ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_xor_si128( packed, _mm_set1_epi16( -0x8000 ) ) );
+    }
+    return i;
+}
+
+static int disparity_to_meters_sse( float * out, const float * in, int count, float factor_in_meters )
+{
+    __m128 const f = _mm_set1_ps( factor_in_meters );
+    int i = 0;
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128 d = _mm_loadu_ps( in + i );
+        _mm_storeu_ps( out + i, _mm_and_ps( is_normal( d ), _mm_div_ps( f, d ) ) );
+    }
+    return i;
+}
+
+#endif  // __SSSE3__
+
+
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+
+static int z16_to_meters_neon( float * out, const uint16_t * in, int count, float depth_units )
+{
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint16x8_t z = vld1q_u16( in + i );
+        vst1q_f32( out + i, vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_low_u16( z ) ) ), depth_units ) );
+        vst1q_f32( out + i + 4, vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_high_u16( z ) ) ), depth_units ) );
+    }
+    return i;
+}
+
+// ARMv7 NEON has no division, only a reciprocal estimate that would not give the exact same results
+#ifdef __aarch64__
+
+static inline uint32x4_t is_normal( float32x4_t x )
+{
+    uint32x4_t const exponent_mask = vdupq_n_u32( 0x7f800000 );
+    uint32x4_t exponent = vandq_u32( vreinterpretq_u32_f32( x ), exponent_mask );
+    return vandq_u32( vtstq_u32( exponent, exponent ), vmvnq_u32( vceqq_u32( exponent, exponent_mask ) ) );
+}
+
+static inline float32x4_t masked( uint32x4_t mask, float32x4_t x )
+{
+    return vreinterpretq_f32_u32( vandq_u32( mask, vreinterpretq_u32_f32( x ) ) );
+}
+
+static int z16_to_disparity_neon( float * out, const uint16_t * in, int count, float factor )
+{
+    float32x4_t const f = vdupq_n_f32( factor );
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint16x8_t z = vld1q_u16( in + i );
+        uint32x4_t lo = vmovl_u16( vget_low_u16( z ) );
+        uint32x4_t hi = vmovl_u16( vget_high_u16( z ) );
+        vst1q_f32( out + i, masked( vtstq_u32( lo, lo ), vdivq_f32( f, vcvtq_f32_u32( lo ) ) ) );
+        vst1q_f32( out + i + 4, masked( vtstq_u32( hi, hi ), vdivq_f32( f, vcvtq_f32_u32( hi ) ) ) );
+    }
+    return i;
+}
+
+static inline uint16x4_t disparity_to_z16_neon( float32x4_t d, float32x4_t f )
+{
+    float32x4_t v = vaddq_f32( vdivq_f32( f, d ), vdupq_n_f32( 0.5f ) );
+    v = vminq_f32( vmaxq_f32( v, vdupq_n_f32( 0.f ) ), vdupq_n_f32( 65535.f ) );
+    return vmovn_u32( vandq_u32( vcvtq_u32_f32( v ), is_normal( d ) ) );
+}
+
+static int disparity_to_z16_neon( uint16_t * out, const float * in, int count, float factor )
+{
+    float32x4_t const f = vdupq_n_f32( factor );
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+        vst1q_u16( out + i, vcombine_u16( disparity_to_z16_neon( vld1q_f32( in + i ), f ),
+                                          disparity_to_z16_neon( vld1q_f32( in + i + 4 ), f ) ) );
+    return i;
+}
+
+static int disparity_to_meters_neon( float * out, const float * in, int count, float factor_in_meters )
+{
+    float32x4_t const f = vdupq_n_f32( factor_in_meters );
+    int i = 0;
+    for( ; i + 4 <= count; i += 4 )
+    {
+        float32x4_t d = vld1q_f32( in + i );
+        vst1q_f32( out + i, masked( is_normal( d ), vdivq_f32( f, d ) ) );
+    }
+    return i;
+}
+
+#endif  // __aarch64__
+
+#endif  // __ARM_NEON
+
+
+void z16_to_meters( float * out, const uint16_t * in, int count, float depth_units )
+{
+    int i = 0;
+#ifdef __SSSE3__
+    i = z16_to_meters_sse( out, in, count, depth_units );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID )
+    i = z16_to_meters_neon( out, in, count, depth_units );
+#endif
+    z16_to_meters_scalar( out + i, in + i, count - i, depth_units );
+}
+
+
+void z16_to_disparity( float * out, const uint16_t * in, int count, float factor )
+{
+    int i = 0;
+#ifdef __SSSE3__
+    i = z16_to_disparity_sse( out, in, count, factor );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID ) && defined( __aarch64__ )
+    i = z16_to_disparity_neon( out, in, count, factor );
+#endif
+    z16_to_disparity_scalar( out + i, in + i, count - i, factor );
+}
+
+
+void disparity_to_z16( uint16_t * out, const float * in, int count, float factor )
+{
+    int i = 0;
+#ifdef __SSSE3__
+    i = disparity_to_z16_sse( out, in, count, factor );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID ) && defined( __aarch64__ )
+    i = disparity_to_z16_neon( out, in, count, factor );
+#endif
+    disparity_to_z16_scalar( out + i, in + i, count - i, factor );
+}
+
+
+void disparity_to_meters( float * out, const float * in, int count, float factor, float depth_units )
+{
+    float const factor_in_meters = factor * depth_units;
+    int i = 0;
+#ifdef __SSSE3__
+    i = disparity_to_meters_sse( out, in, count, factor_in_meters );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID ) && defined( __aarch64__ )
+    i = disparity_to_meters_neon( out, in, count, factor_in_meters );
+#endif
+    disparity_to_meters_scalar( out + i, in + i, count - i, factor_in_meters );
+}
+
+
+}  // namespace librealsense
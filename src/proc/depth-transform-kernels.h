@@ -0,0 +1,34 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Per-pixel conversions between depth representations, for units_transform and disparity_transform.
+//
+// Each uses SSE or NEON where available, for as many pixels as it can, and scalar code for the rest. The vector code
+// divides rather than multiplying by an approximate reciprocal, so its results are exactly those of the scalar code.
+//
+// 'count' is the number of pixels; 'factor' is the depth<->disparity conversion factor (see disparity_info), in depth
+// units.
+
+
+// Z16 -> meters, as float
+void z16_to_meters( float * out, const uint16_t * in, int count, float depth_units );
+
+// Z16 -> 32-bit float disparity; 0 stays 0
+void z16_to_disparity( float * out, const uint16_t * in, int count, float factor );
+
+// 32-bit float disparity -> Z16, rounded; disparities that are not normal numbers (0, inf, NaN...) give 0
+void disparity_to_z16( uint16_t * out, const float * in, int count, float factor );
+
+// 32-bit float disparity -> meters, as float, without going through Z16 (and its rounding) first
+void disparity_to_meters( float * out, const float * in, int count, float factor, float depth_units );
+
+
+}  // namespace librealsense
@@ -10,6 +10,7 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/disparity-transform.h"
+#include "proc/depth-transform-kernels.h"
 #include "software-device.h"
 #include "environment.h"
 
@@ -18,11 +19,25 @@ namespace librealsense
     disparity_transform::disparity_transform(bool transform_to_disparity):
         generic_processing_block(transform_to_disparity ? "Depth to Disparity" : "Disparity to Depth"),
         _transform_to_disparity(transform_to_disparity),
+        _output_distance(false),
         _update_target(false),
+        _depth_units(0.001f),
         _width(0), _height(0), _bpp(0)
     {
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
 
+        if (!_transform_to_disparity)
+        {
+            // Produce meters directly, rather than following with a units transform
+            auto output_distance = std::make_shared<ptr_option<bool>>(false, true, true, false, &_output_distance, "Output distance in meters rather than Z16");
+            output_distance->on_set([this](float val)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                on_set_output_distance(val != 0.f);
+            });
+            register_option(RS2_OPTION_OUTPUT_DISTANCE, output_distance);
+        }
+
         on_set_mode(_transform_to_disparity);
     }
 
@@ -55,12 +70,16 @@ namespace librealsense
 
         if (_stereoscopic_depth && (tgt = prepare_target_frame(f, source)))
         {
-            auto src = f.as<rs2::video_frame>();
+            auto in = f.get_data();
+            auto out = const_cast<void*>(tgt.get_data());
+            int count = int(_width * _height);
 
             if (_transform_to_disparity)
-                convert<uint16_t, float>(src.get_data(), const_cast<void*>(tgt.get_data()));
+                z16_to_disparity((float*)out, (const uint16_t*)in, count, _d2d_convert_factor);
+            else if (_output_distance)
+                disparity_to_meters((float*)out, (const float*)in, count, _d2d_convert_factor, _depth_units);
             else
-                convert<float, uint16_t>(src.get_data(), const_cast<void*>(tgt.get_data()));
+                disparity_to_z16((uint16_t*)out, (const float*)in, count, _d2d_convert_factor);
         }
 
         return tgt;
@@ -69,10 +88,16 @@ namespace librealsense
     void disparity_transform::on_set_mode(bool to_disparity)
     {
         _transform_to_disparity = to_disparity;
-        _bpp = _transform_to_disparity ? sizeof(float) : sizeof(uint16_t);
+        _bpp = (_transform_to_disparity || _output_distance) ? sizeof(float) : sizeof(uint16_t);
         _update_target = true;
     }
 
+    void disparity_transform::on_set_output_distance(bool output_distance)
+    {
+        _output_distance = output_distance;
+        on_set_mode(_transform_to_disparity);
+    }
+
     void disparity_transform::update_transformation_profile(const rs2::frame& f)
     {
         if(f.get_profile().get() != _source_stream_profile.get())
@@ -82,6 +107,7 @@ namespace librealsense
             auto info = disparity_info::update_info_from_frame(f);
             _stereoscopic_depth = info.stereoscopic_depth;
             _d2d_convert_factor = info.d2d_convert_factor;
+            _depth_units = info.depth_units;
 
             auto vp = _source_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
@@ -92,7 +118,9 @@ namespace librealsense
         // Adjust the target profile
         if (_update_target)
         {
-            auto tgt_format = _transform_to_disparity ? RS2_FORMAT_DISPARITY32 : RS2_FORMAT_Z16;
+            auto tgt_format = _transform_to_disparity ? RS2_FORMAT_DISPARITY32
+                            : _output_distance        ? RS2_FORMAT_DISTANCE
+                                                      : RS2_FORMAT_Z16;
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, tgt_format);
 
             auto src_vspi = dynamic_cast<video_stream_profile_interface*>(_source_stream_profile.get()->profile);
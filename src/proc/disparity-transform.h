@@ -24,44 +24,21 @@ namespace librealsense
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename Tin, typename Tout>
-        void convert(const void* in_data, void* out_data)
-        {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
-        }
-
     private:
         void    update_transformation_profile(const rs2::frame& f);
 
         void    on_set_mode(bool to_disparity);
+        void    on_set_output_distance(bool output_distance);
 
         bool                    _transform_to_disparity;
+        bool                    _output_distance;   // disparity to depth only: float meters rather than Z16
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         bool                    _update_target;
         bool                    _stereoscopic_depth;
         float                   _stereo_baseline_meter; // in meters
         float                   _d2d_convert_factor;
+        float                   _depth_units;
         size_t                  _width, _height;
         size_t                  _bpp;
     };
@@ -73,6 +50,7 @@ namespace librealsense
         struct info {
             bool stereoscopic_depth = false;
             float d2d_convert_factor = 0;
+            float depth_units = 0.001f;
         };
 
         static info update_info_from_frame(const rs2::frame& f)
@@ -114,6 +92,7 @@ namespace librealsense
                 if (f.as<rs2::depth_frame>())
                     depth_units = ((depth_frame*)f.get())->get_units();
                 info.d2d_convert_factor = (stereo_baseline_meter * focal_lenght_mm * fractions) / depth_units;
+                info.depth_units = depth_units;
             }
 
             return info;
@@ -5,9 +5,11 @@
 #include "stream.h"
 #include <src/composite-frame.h>
 #include <src/core/frame-callback.h>
+#include <src/pipeline-trace.h>
 
 #include <rsutils/string/from.h>
 #include <ostream>
+#include <chrono>
 
 namespace librealsense
 {
@@ -428,7 +430,13 @@ void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
 
                 fr->acquire();
                 if( _converted_frames_callback )
+                {
+                    pipeline_trace_span span( "user callback", fr->get_frame_number() );
+                    auto const start = std::chrono::steady_clock::now();
                     _converted_frames_callback->on_frame( (rs2_frame *)fr );
+                    _callback_latency.record( std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                                  std::chrono::steady_clock::now() - start ).count() );
+                }
             }
         }
     } );
@@ -450,6 +458,7 @@ void formats_converter::convert_frame( frame_holder & f )
     if( ! f )
         return;
 
+    pipeline_trace_span span( "format conversion", f->get_frame_number() );
     auto & converters = _raw_profile_to_converters[f->get_stream()];
     for( auto & converter : converters )
     {
@@ -0,0 +1,398 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "hdr-merge-kernels.h"
+#include "cpu-features.h"
+
+#include <rsutils/concurrency/concurrency.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifdef __SSSE3__
+#include <emmintrin.h>  // SSE2 is all we need
+#ifdef RS2_HAS_AVX2_KERNELS
+#include <immintrin.h>  // AVX2
+#define AVX2_TARGET __attribute__( ( target( "avx2" ) ) )
+#endif
+#endif
+
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+#include <arm_neon.h>
+#endif
+
+
+namespace librealsense {
+
+
+// Scalar versions, which also take care of whatever the vector code leaves over at the end
+
+static void merge_depth_only_scalar( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+{
+    for( int i = 0; i < count; ++i )
+        out[i] = d0[i] ? d0[i] : d1[i];
+}
+
+template< class T >
+static void merge_using_ir_scalar( uint16_t * out,
+                                   const uint16_t * d0,
+                                   const uint16_t * d1,
+                                   const T * ir0,
+                                   const T * ir1,
+                                   int count,
+                                   T low,
+                                   T high )
+{
+    for( int i = 0; i < count; ++i )
+    {
+        if( d0[i] && ir0[i] > low && ir0[i] < high )
+            out[i] = d0[i];
+        else if( d1[i] && ir1[i] > low && ir1[i] < high )
+            out[i] = d1[i];
+        else
+            out[i] = 0;
+    }
+}
+
+
+#ifdef __SSSE3__
+
+// SSE has only signed 16-bit comparisons; flipping the top bit makes them work for unsigned values
+static inline __m128i flip_sign( __m128i x )
+{
+    return _mm_xor_si128( x, _mm_set1_epi16( -0x8000 ) );
+}
+
+static inline __m128i load_ir_sse( const uint8_t * ir )
+{
+    return _mm_unpacklo_epi8( _mm_loadl_epi64( reinterpret_cast< const __m128i * >( ir ) ), _mm_setzero_si128() );
+}
+
+static inline __m128i load_ir_sse( const uint16_t * ir )
+{
+    return _mm_loadu_si128( reinterpret_cast< const __m128i * >( ir ) );
+}
+
+static int merge_depth_only_sse( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+{
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128i a = _mm_loadu_si128( reinterpret_cast< const __m128i * >( d0 + i ) );
+        __m128i b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( d1 + i ) );
+        // a | ( a == 0 ? b : 0 )
+        __m128i a_is_0 = _mm_cmpeq_epi16( a, _mm_setzero_si128() );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_or_si128( a, _mm_and_si128( a_is_0, b ) ) );
+    }
+    return i;
+}
+
+template< class T >
+static int merge_using_ir_sse( uint16_t * out,
+                               const uint16_t * d0,
+                               const uint16_t * d1,
+                               const T * ir0,
+                               const T * ir1,
+                               int count,
+                               T low,
+                               T high )
+{
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const lo = flip_sign( _mm_set1_epi16( short( low ) ) );
+    __m128i const hi = flip_sign( _mm_set1_epi16( short( high ) ) );
+    auto good = [&]( __m128i d, __m128i ir )
+    {
+        ir = flip_sign( ir );
+        __m128i in_range = _mm_and_si128( _mm_cmpgt_epi16( ir, lo ), _mm_cmpgt_epi16( hi, ir ) );
+        return _mm_andnot_si128( _mm_cmpeq_epi16( d, zero ), in_range );
+    };
+
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128i a = _mm_loadu_si128( reinterpret_cast< const __m128i * >( d0 + i ) );
+        __m128i b = _mm_loadu_si128( reinterpret_cast< const __m128i * >( d1 + i ) );
+        __m128i a_good = good( a, load_ir_sse( ir0 + i ) );
+        __m128i b_good = good( b, load_ir_sse( ir1 + i ) );
+        // a_good ? a : ( b_good ? b : 0 )
+        __m128i res = _mm_or_si128( _mm_and_si128( a_good, a ), _mm_andnot_si128( a_good, _mm_and_si128( b_good, b ) ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), res );
+    }
+    return i;
+}
+
+
+#ifdef RS2_HAS_AVX2_KERNELS
+
+AVX2_TARGET static inline __m256i flip_sign( __m256i x )
+{
+    return _mm256_xor_si256( x, _mm256_set1_epi16( -0x8000 ) );
+}
+
+AVX2_TARGET static inline __m256i load_ir_avx2( const uint8_t * ir )
+{
+    return _mm256_cvtepu8_epi16( _mm_loadu_si128( reinterpret_cast< const __m128i * >( ir ) ) );
+}
+
+AVX2_TARGET static inline __m256i load_ir_avx2( const uint16_t * ir )
+{
+    return _mm256_loadu_si256( reinterpret_cast< const __m256i * >( ir ) );
+}
+
+AVX2_TARGET static int merge_depth_only_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+{
+    int i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( d0 + i ) );
+        __m256i b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( d1 + i ) );
+        __m256i a_is_0 = _mm256_cmpeq_epi16( a, _mm256_setzero_si256() );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i ), _mm256_or_si256( a, _mm256_and_si256( a_is_0, b ) ) );
+    }
+    return i;
+}
+
+template< class T >
+AVX2_TARGET static int merge_using_ir_avx2( uint16_t * out,
+                                            const uint16_t * d0,
+                                            const uint16_t * d1,
+                                            const T * ir0,
+                                            const T * ir1,
+                                            int count,
+                                            T low,
+                                            T high )
+{
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i const lo = flip_sign( _mm256_set1_epi16( short( low ) ) );
+    __m256i const hi = flip_sign( _mm256_set1_epi16( short( high ) ) );
+
+    int i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        __m256i a = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( d0 + i ) );
+        __m256i b = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( d1 + i ) );
+        __m256i i0 = flip_sign( load_ir_avx2( ir0 + i ) );
+        __m256i i1 = flip_sign( load_ir_avx2( ir1 + i ) );
+        __m256i a_good = _mm256_andnot_si256( _mm256_cmpeq_epi16( a, zero ),
+                                              _mm256_and_si256( _mm256_cmpgt_epi16( i0, lo ), _mm256_cmpgt_epi16( hi, i0 ) ) );
+        __m256i b_good = _mm256_andnot_si256( _mm256_cmpeq_epi16( b, zero ),
+                                              _mm256_and_si256( _mm256_cmpgt_epi16( i1, lo ), _mm256_cmpgt_epi16( hi, i1 ) ) );
+        __m256i res = _mm256_or_si256( _mm256_and_si256( a_good, a ),
+                                       _mm256_andnot_si256( a_good, _mm256_and_si256( b_good, b ) ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i ), res );
+    }
+    return i;
+}
+
+static bool use_avx2()
+{
+    static bool const avx2 = cpu_has_avx2();
+    return avx2;
+}
+
+#endif  // RS2_HAS_AVX2_KERNELS
+
+#endif  // __SSSE3__
+
+
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+
+static inline uint16x8_t load_ir_neon( const uint8_t * ir )
+{
+    return vmovl_u8( vld1_u8( ir ) );
+}
+
+static inline uint16x8_t load_ir_neon( const uint16_t * ir )
+{
+    return vld1q_u16( ir );
+}
+
+static int merge_depth_only_neon( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+{
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint16x8_t a = vld1q_u16( d0 + i );
+        uint16x8_t b = vld1q_u16( d1 + i );
+        // a == 0 ? b : a
+        vst1q_u16( out + i, vbslq_u16( vceqq_u16( a, vdupq_n_u16( 0 ) ), b, a ) );
+    }
+    return i;
+}
+
+template< class T >
+static int merge_using_ir_neon( uint16_t * out,
+                                const uint16_t * d0,
+                                const uint16_t * d1,
+                                const T * ir0,
+                                const T * ir1,
+                                int count,
+                                T low,
+                                T high )
+{
+    uint16x8_t const lo = vdupq_n_u16( low );
+    uint16x8_t const hi = vdupq_n_u16( high );
+    auto good = [&]( uint16x8_t d, uint16x8_t ir )
+    {
+        // d != 0: vtstq( d, d ) sets lanes where d has any bit set
+        return vandq_u16( vtstq_u16( d, d ), vandq_u16( vcgtq_u16( ir, lo ), vcltq_u16( ir, hi ) ) );
+    };
+
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint16x8_t a = vld1q_u16( d0 + i );
+        uint16x8_t b = vld1q_u16( d1 + i );
+        uint16x8_t a_good = good( a, load_ir_neon( ir0 + i ) );
+        uint16x8_t b_good = good( b, load_ir_neon( ir1 + i ) );
+        vst1q_u16( out + i, vbslq_u16( a_good, a, vandq_u16( b_good, b ) ) );
+    }
+    return i;
+}
+
+#endif  // __ARM_NEON
+
+
+void hdr_merge_depth_only( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+{
+    int i = 0;
+#ifdef __SSSE3__
+#ifdef RS2_HAS_AVX2_KERNELS
+    if( use_avx2() )
+        i = merge_depth_only_avx2( out, d0, d1, count );
+#endif
+    i += merge_depth_only_sse( out + i, d0 + i, d1 + i, count - i );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID )
+    i = merge_depth_only_neon( out, d0, d1, count );
+#endif
+    merge_depth_only_scalar( out + i, d0 + i, d1 + i, count - i );
+}
+
+
+template< class T >
+static void merge_using_ir( uint16_t * out,
+                            const uint16_t * d0,
+                            const uint16_t * d1,
+                            const T * ir0,
+                            const T * ir1,
+                            int count,
+                            T low,
+                            T high )
+{
+    int i = 0;
+#ifdef __SSSE3__
+#ifdef RS2_HAS_AVX2_KERNELS
+    if( use_avx2() )
+        i = merge_using_ir_avx2( out, d0, d1, ir0, ir1, count, low, high );
+#endif
+    i += merge_using_ir_sse( out + i, d0 + i, d1 + i, ir0 + i, ir1 + i, count - i, low, high );
+#elif defined( __ARM_NEON ) && ! defined( ANDROID )
+    i = merge_using_ir_neon( out, d0, d1, ir0, ir1, count, low, high );
+#endif
+    merge_using_ir_scalar( out + i, d0 + i, d1 + i, ir0 + i, ir1 + i, count - i, low, high );
+}
+
+
+void hdr_merge_using_ir( uint16_t * out,
+                         const uint16_t * d0,
+                         const uint16_t * d1,
+                         const uint8_t * ir0,
+                         const uint8_t * ir1,
+                         int count,
+                         uint8_t low,
+                         uint8_t high )
+{
+    merge_using_ir( out, d0, d1, ir0, ir1, count, low, high );
+}
+
+
+void hdr_merge_using_ir( uint16_t * out,
+                         const uint16_t * d0,
+                         const uint16_t * d1,
+                         const uint16_t * ir0,
+                         const uint16_t * ir1,
+                         int count,
+                         uint16_t low,
+                         uint16_t high )
+{
+    merge_using_ir( out, d0, d1, ir0, ir1, count, low, high );
+}
+
+
+int hdr_merge_bands::default_max_bands()
+{
+    static int const n_cpus = std::max( 1, int( std::thread::hardware_concurrency() ) );
+    return std::min( 4, n_cpus );
+}
+
+
+hdr_merge_bands::hdr_merge_bands( int max_bands )
+    : _max_bands( std::max( 1, max_bands ) )
+{
+}
+
+
+hdr_merge_bands::~hdr_merge_bands()
+{
+    for( auto & worker : _workers )
+        worker->stop();
+}
+
+
+void hdr_merge_bands::run( int width, int height, std::function< void( int first, int count ) > const & merge )
+{
+    int const n_bands = std::max( 1, std::min( { _max_bands, height, width * height / MIN_PIXELS_PER_BAND } ) );
+    int const band_rows = height / n_bands;
+
+    while( int( _workers.size() ) < n_bands - 1 )
+    {
+        _workers.emplace_back( new dispatcher( 1 ) );
+        _workers.back()->start();  // dispatchers start out stopped, and would drop whatever we give them
+    }
+
+    std::mutex mutex;
+    std::condition_variable done;
+    int remaining = n_bands - 1;
+    std::exception_ptr error;
+    for( int b = 1; b < n_bands; ++b )
+    {
+        int const first_row = b * band_rows;
+        int const n_rows = ( b == n_bands - 1 ) ? height - first_row : band_rows;
+        _workers[b - 1]->invoke( [&, first_row, n_rows]( dispatcher::cancellable_timer )
+        {
+            std::exception_ptr e;
+            try
+            {
+                merge( first_row * width, n_rows * width );
+            }
+            catch( ... )
+            {
+                e = std::current_exception();
+            }
+            std::lock_guard< std::mutex > lock( mutex );
+            if( e )
+                error = e;
+            if( ! --remaining )
+                done.notify_one();
+        } );
+    }
+    try
+    {
+        merge( 0, band_rows * width );
+    }
+    catch( ... )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        error = std::current_exception();
+    }
+    std::unique_lock< std::mutex > lock( mutex );
+    done.wait( lock, [&]() { return ! remaining; } );
+    if( error )
+        std::rethrow_exception( error );
+}
+
+
+}  // namespace librealsense
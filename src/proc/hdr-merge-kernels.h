@@ -0,0 +1,72 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+class dispatcher;
+
+
+namespace librealsense {
+
+
+// The per-pixel work of the HDR merge: each output pixel is taken from the first depth frame if it is good, otherwise
+// from the second if it is good, otherwise 0. A depth pixel is good if it is not 0 and, when merging with IR, the IR
+// pixel matching it is neither under- nor over-saturated (i.e., low < ir < high).
+//
+// The fastest implementation available on the CPU is used (SSE/AVX2/NEON, chosen once, at runtime), without branches
+// per pixel. The functions work on any range of 'count' pixels, so callers can split a frame between threads.
+//
+void hdr_merge_depth_only( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count );
+
+void hdr_merge_using_ir( uint16_t * out,
+                         const uint16_t * d0,
+                         const uint16_t * d1,
+                         const uint8_t * ir0,
+                         const uint8_t * ir1,
+                         int count,
+                         uint8_t low,
+                         uint8_t high );
+
+void hdr_merge_using_ir( uint16_t * out,
+                         const uint16_t * d0,
+                         const uint16_t * d1,
+                         const uint16_t * ir0,
+                         const uint16_t * ir1,
+                         int count,
+                         uint16_t low,
+                         uint16_t high );
+
+
+// Large frames are split into bands of whole rows that are merged in parallel: the calling thread does the first band,
+// and persistent workers (created when first needed) do the others. Below MIN_PIXELS_PER_BAND per band, handing the
+// work to another thread costs more than it saves.
+//
+class hdr_merge_bands
+{
+public:
+    static const int MIN_PIXELS_PER_BAND = 256 * 1024;
+
+    // By default, as many bands as there are CPUs, up to 4
+    explicit hdr_merge_bands( int max_bands = default_max_bands() );
+    ~hdr_merge_bands();
+
+    // Calls merge(first_pixel, n_pixels) for each band, and returns once all are done. Not reentrant.
+    void run( int width, int height, std::function< void( int first, int count ) > const & merge );
+
+    size_t n_workers() const { return _workers.size(); }
+
+    static int default_max_bands();
+
+private:
+    int const _max_bands;
+    std::vector< std::unique_ptr< dispatcher > > _workers;
+};
+
+
+}  // namespace librealsense
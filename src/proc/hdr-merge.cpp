@@ -4,6 +4,8 @@
 #include "hdr-merge.h"
 #include <src/core/depth-frame.h>
 
+#include <algorithm>
+
 namespace librealsense
 {
     hdr_merge::hdr_merge()
@@ -83,21 +85,21 @@ namespace librealsense
         // saving frame of sequence id 0
         // so that the merging with be deterministic - always done with frame n and n+1
         // with frame n as basis
-        if (_framesets.size() == depth_seq_id)
+        if (depth_seq_id == rs2_metadata_type(_n_framesets) && _n_framesets < _framesets.size())
         {
-            _framesets[(int)depth_seq_id] = fs;
+            _framesets[_n_framesets++] = fs;
         }
 
         // discard merged frame if not relevant
         discard_depth_merged_frame_if_needed(depth_frame);
 
         // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        if (_framesets.size() >= 2)
+        if (_n_framesets >= 2)
         {
             // 4. pop out both framesets from the vector
-            rs2::frameset fs_0 = _framesets[0];
-            rs2::frameset fs_1 = _framesets[1];
-            _framesets.clear();
+            rs2::frameset fs_0 = std::move(_framesets[0]);
+            rs2::frameset fs_1 = std::move(_framesets[1]);
+            _n_framesets = 0;
 
             bool use_ir = false;
             if (check_frames_mergeability(fs_0, fs_1, use_ir))
@@ -204,45 +206,52 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-
-            int width_height_product = width * height;
-
+            // Every pixel is written by the merge
             if (use_ir)
-            {
-                if (first_ir.get_profile().format() == RS2_FORMAT_Y8)
-                {
-                    merge_frames_using_ir<uint8_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else if (first_ir.get_profile().format() == RS2_FORMAT_Y16)
-                {
-                    merge_frames_using_ir<uint16_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else
-                {
-                    merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-                }
-            }
+                merge_frames_using_ir(new_data, d0, d1, first_ir, second_ir, width, height);
             else
-            {
-                merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-            }
+                merge_frames_using_only_depth(new_data, d0, d1, width, height);
 
             return new_f;
         }
         return first_fs;
     }
 
-    void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
+    void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, const uint16_t* d0, const uint16_t* d1, int width, int height) const
     {
-        for (int i = 0; i < width_height_prod; i++)
+        _bands.run(width, height, [&](int first, int count)
         {
-            if (d0[i])
-                new_data[i] = d0[i];
-            else if (d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
+            hdr_merge_depth_only(new_data + first, d0 + first, d1 + first, count);
+        });
+    }
+
+    void hdr_merge::merge_frames_using_ir(uint16_t* new_data, const uint16_t* d0, const uint16_t* d1,
+        const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width, int height) const
+    {
+        auto format = first_ir.get_profile().format();
+        if (format == RS2_FORMAT_Y8)
+        {
+            auto i0 = (const uint8_t*)first_ir.get_data();
+            auto i1 = (const uint8_t*)second_ir.get_data();
+            _bands.run(width, height, [&](int first, int count)
+            {
+                hdr_merge_using_ir(new_data + first, d0 + first, d1 + first, i0 + first, i1 + first, count,
+                    uint8_t(IR_UNDER_SATURATED_VALUE_Y8), uint8_t(IR_OVER_SATURATED_VALUE_Y8));
+            });
+        }
+        else if (format == RS2_FORMAT_Y16)
+        {
+            auto i0 = (const uint16_t*)first_ir.get_data();
+            auto i1 = (const uint16_t*)second_ir.get_data();
+            _bands.run(width, height, [&](int first, int count)
+            {
+                hdr_merge_using_ir(new_data + first, d0 + first, d1 + first, i0 + first, i1 + first, count,
+                    uint16_t(IR_UNDER_SATURATED_VALUE_Y16), uint16_t(IR_OVER_SATURATED_VALUE_Y16));
+            });
+        }
+        else
+        {
+            merge_frames_using_only_depth(new_data, d0, d1, width, height);
         }
     }
 
@@ -30,6 +30,7 @@ namespace librealsense
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
+        enable_in_place_processing();
 
         auto hole_filling_mode = std::make_shared<ptr_option<uint8_t>>(
             hole_fill_min,
@@ -93,7 +94,11 @@ namespace librealsense
 
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
-        // Allocate and copy the content of the input data to the target
+        // Modify the input in place if we can; otherwise allocate and copy its content to the target
+        if (f.is<rs2::depth_frame>() && f.as<rs2::video_frame>().get_stride_in_bytes() == int(_stride))
+            if (auto tgt = reuse_input_frame(f, _target_stream_profile))
+                return tgt;
+
         rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
 
         memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
@@ -0,0 +1,223 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "interleaved-unpack.h"
+#include "cpu-features.h"
+#include "sse/sse-interleaved.h"
+#include "neon/neon-interleaved.h"
+
+#include <cstring>
+#include <initializer_list>
+
+
+namespace librealsense {
+
+
+bool is_available( interleaved_impl impl )
+{
+    switch( impl )
+    {
+    case interleaved_impl::best:
+    case interleaved_impl::scalar:
+        return true;
+#ifdef __SSSE3__
+    case interleaved_impl::ssse3:
+        return true;
+#ifdef RS2_HAS_AVX2_KERNELS
+    case interleaved_impl::avx2:
+        return cpu_has_avx2();
+#endif
+#endif
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+    case interleaved_impl::neon:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+
+static interleaved_impl resolve( interleaved_impl impl )
+{
+    if( impl != interleaved_impl::best )
+        return impl;
+
+    static interleaved_impl const best = []()
+    {
+        for( auto impl : { interleaved_impl::avx2, interleaved_impl::ssse3, interleaved_impl::neon } )
+            if( is_available( impl ) )
+                return impl;
+        return interleaved_impl::scalar;
+    }();
+    return best;
+}
+
+
+// Scalar versions, which also take care of whatever the vector code leaves over at the end
+
+// x << 6 | x >> 4: approximates x * 65535 / 1023, converting 10-bit data to 16 bits
+static inline uint16_t expand_10_to_16( int x )
+{
+    return uint16_t( x << 6 | x >> 4 );
+}
+
+static void split_y8i_scalar( uint8_t * left, uint8_t * right, const uint8_t * source, int count )
+{
+    for( int i = 0; i < count; ++i )
+    {
+        left[i] = source[2 * i];
+        right[i] = source[2 * i + 1];
+    }
+}
+
+static void split_y8i_mipi_scalar( uint8_t * left, uint8_t * right, const uint8_t * source, int count )
+{
+    // The left pixels of every pair are swapped
+    int i = 0;
+    for( ; i + 2 <= count; i += 2 )
+    {
+        left[i] = source[2 * i + 2];
+        left[i + 1] = source[2 * i];
+        right[i] = source[2 * i + 1];
+        right[i + 1] = source[2 * i + 3];
+    }
+    if( i < count )
+        split_y8i_scalar( left + i, right + i, source + 2 * i, count - i );
+}
+
+static void split_y12i_scalar( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride )
+{
+    for( int i = 0; i < count; ++i, source += stride )
+    {
+        // Bytes: [ right 0-7 ] [ left 0-3 | right 8-11 ] [ left 4-11 ]
+        left[i] = expand_10_to_16( source[2] << 4 | source[1] >> 4 );
+        right[i] = expand_10_to_16( ( source[1] & 0x0f ) << 8 | source[0] );
+    }
+}
+
+static void split_y16i_10msb_scalar( uint16_t * left, uint16_t * right, const uint8_t * source, int count )
+{
+    for( int i = 0; i < count; ++i, source += 4 )
+    {
+        uint16_t l, r;
+        std::memcpy( &l, source, sizeof( l ) );
+        std::memcpy( &r, source + 2, sizeof( r ) );
+        left[i] = expand_10_to_16( l );
+        right[i] = expand_10_to_16( r );
+    }
+}
+
+
+static int split_y8i_simd( interleaved_impl impl, uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi )
+{
+    switch( resolve( impl ) )
+    {
+#ifdef __SSSE3__
+    case interleaved_impl::ssse3:
+        return split_y8i_ssse3( left, right, source, count, mipi );
+#ifdef RS2_HAS_AVX2_KERNELS
+    case interleaved_impl::avx2:
+        return split_y8i_avx2( left, right, source, count, mipi );
+#endif
+#endif
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+    case interleaved_impl::neon:
+        return split_y8i_neon( left, right, source, count, mipi );
+#endif
+    default:
+        return 0;
+    }
+}
+
+static int split_y12i_simd( interleaved_impl impl, uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride )
+{
+    switch( resolve( impl ) )
+    {
+#ifdef __SSSE3__
+    case interleaved_impl::ssse3:
+        return split_y12i_ssse3( left, right, source, count, stride );
+#ifdef RS2_HAS_AVX2_KERNELS
+    case interleaved_impl::avx2:
+        return split_y12i_avx2( left, right, source, count, stride );
+#endif
+#endif
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+    case interleaved_impl::neon:
+        return split_y12i_neon( left, right, source, count, stride );
+#endif
+    default:
+        return 0;
+    }
+}
+
+static int split_y16i_10msb_simd( interleaved_impl impl, uint16_t * left, uint16_t * right, const uint8_t * source, int count )
+{
+    switch( resolve( impl ) )
+    {
+#ifdef __SSSE3__
+    case interleaved_impl::ssse3:
+        return split_y16i_10msb_ssse3( left, right, source, count );
+#ifdef RS2_HAS_AVX2_KERNELS
+    case interleaved_impl::avx2:
+        return split_y16i_10msb_avx2( left, right, source, count );
+#endif
+#endif
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+    case interleaved_impl::neon:
+        return split_y16i_10msb_neon( left, right, source, count );
+#endif
+    default:
+        return 0;
+    }
+}
+
+
+void split_y8i( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl impl )
+{
+    if( ! dest )
+        return;
+    int i = split_y8i_simd( impl, dest[0], dest[1], source, count, false );
+    split_y8i_scalar( dest[0] + i, dest[1] + i, source + 2 * i, count - i );
+}
+
+void split_y8i_mipi( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl impl )
+{
+    if( ! dest )
+        return;
+    int i = split_y8i_simd( impl, dest[0], dest[1], source, count, true );
+    split_y8i_mipi_scalar( dest[0] + i, dest[1] + i, source + 2 * i, count - i );
+}
+
+static void split_y12i( uint8_t * const dest[], const uint8_t * source, int count, int stride, interleaved_impl impl )
+{
+    if( ! dest )
+        return;
+    auto left = reinterpret_cast< uint16_t * >( dest[0] );
+    auto right = reinterpret_cast< uint16_t * >( dest[1] );
+    int i = split_y12i_simd( impl, left, right, source, count, stride );
+    split_y12i_scalar( left + i, right + i, source + stride * i, count - i, stride );
+}
+
+void split_y12i( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl impl )
+{
+    split_y12i( dest, source, count, 3, impl );
+}
+
+void split_y12i_mipi( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl impl )
+{
+    split_y12i( dest, source, count, 4, impl );
+}
+
+void split_y16i_10msb( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl impl )
+{
+    if( ! dest )
+        return;
+    auto left = reinterpret_cast< uint16_t * >( dest[0] );
+    auto right = reinterpret_cast< uint16_t * >( dest[1] );
+    int i = split_y16i_10msb_simd( impl, left, right, source, count );
+    split_y16i_10msb_scalar( left + i, right + i, source + 4 * i, count - i );
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,48 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Splitting of interleaved left/right IR images into two separate images, for the Y8I/Y12I/Y16I converters.
+//
+// Each has a scalar implementation and, depending on the CPU, SIMD ones. By default the fastest available is used
+// (chosen once, at runtime); the others can be asked for explicitly, if is_available(), e.g. to check they all give the
+// exact same output.
+//
+// 'count' is the number of pixels (width * height); dest[0] receives the left image and dest[1] the right.
+//
+enum class interleaved_impl
+{
+    best,    // whichever of the below is fastest on this CPU
+    scalar,
+    ssse3,
+    avx2,
+    neon,
+};
+
+bool is_available( interleaved_impl );
+
+
+// 8-bit left, 8-bit right
+void split_y8i( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl = interleaved_impl::best );
+
+// Same as Y8I, but the left pixels of every pair arrive swapped (a MIPI workaround)
+void split_y8i_mipi( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl = interleaved_impl::best );
+
+// 3 bytes per pixel, 12 bits each for left and right, holding 10-bit data that is expanded to 16 bits
+void split_y12i( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl = interleaved_impl::best );
+
+// Same as Y12I, but with a padding byte after each pixel (a MIPI workaround)
+void split_y12i_mipi( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl = interleaved_impl::best );
+
+// 16-bit left, 16-bit right, holding 10-bit data that is expanded to 16 bits
+void split_y16i_10msb( uint8_t * const dest[], const uint8_t * source, int count, interleaved_impl = interleaved_impl::best );
+
+
+}  // namespace librealsense
@@ -0,0 +1,322 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "multi-device-syncer.h"
+#include "composite-frame.h"
+#include "option.h"
+#include "core/device-interface.h"
+#include "core/sensor-interface.h"
+#include "core/stream-profile-interface.h"
+#include <src/core/frame-processor-callback.h>
+
+#include <algorithm>
+
+
+namespace librealsense
+{
+    // A device that delivered nothing for this long is no longer waited for
+    static std::chrono::milliseconds const inactive_device_timeout( 1000 );
+
+    // Each device holds at most this many framesets while waiting for the others; past it, we release without waiting
+    // for the deadline, rather than starve the device of frames
+    static size_t const max_pending_per_device = QUEUE_MAX_SIZE;
+
+
+    struct multi_device_syncer::device_syncer
+    {
+        explicit device_syncer( std::shared_ptr< device_interface > const & dev )
+            : device( dev )
+            , key( dev.get() )
+            , frames_matcher( std::make_shared< composite_identity_matcher >( std::vector< std::shared_ptr< matcher > >() ) )
+            , last_arrival( clock::now() )
+            , thread( QUEUE_MAX_SIZE )
+        {
+            // Called from within dispatch(), on our thread
+            frames_matcher->set_callback( []( frame_holder f, syncronization_environment const & env ) {
+                env.matches.enqueue( std::move( f ) );
+            } );
+            thread.start();  // a dispatcher starts out stopped, and would drop all our frames
+        }
+
+        std::weak_ptr< device_interface > device;
+        device_interface const * key;  // null for frames whose device we cannot tell
+
+        // Only used from our thread
+        std::shared_ptr< matcher > frames_matcher;
+        single_consumer_frame_queue< frame_holder > matches;
+
+        // Under the syncer's mutex
+        std::deque< pending_frames > pending;
+        clock::time_point last_arrival;
+
+        // Last, so it is stopped before anything it uses is destroyed
+        dispatcher thread;
+    };
+
+
+    static std::shared_ptr< device_interface > get_device( frame_interface const * f )
+    {
+        if( auto composite = dynamic_cast< composite_frame const * >( f ) )
+            if( composite->get_embedded_frames_count() )
+                f = composite->first();
+        auto sensor = f->get_sensor();
+        if( sensor )
+        {
+            try
+            {
+                return sensor->get_device().shared_from_this();
+            }
+            catch( const std::bad_weak_ptr & )
+            {
+                LOG_WARNING( "Device destroyed" );
+            }
+        }
+        return nullptr;
+    }
+
+
+    // Timestamps of different devices can only be compared in a domain they share
+    static double get_sync_timestamp( frame_interface const * f )
+    {
+        switch( f->get_frame_timestamp_domain() )
+        {
+        case RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME:
+        case RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME:
+            return f->get_frame_timestamp();
+        default:
+            return f->get_frame_system_time();
+        }
+    }
+
+
+    multi_device_syncer::multi_device_syncer()
+        : processing_block( "Multi-Device Syncer" )
+        , _tolerance_ms( 0.f )
+        , _deadline_ms( 100.f )
+        , _tolerance_option_ms( 0.f )
+        , _deadline_option_ms( 100.f )
+        , _stopped( false )
+        , _watchdog( [this]( dispatcher::cancellable_timer timer ) {
+            float deadline_ms;
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                deadline_ms = _deadline_ms;
+            }
+            if( ! timer.try_sleep( std::chrono::microseconds( int64_t( deadline_ms * 250 ) ) ) )
+                return;
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                if( _stopped )
+                    return;
+                release_framesets( clock::now() );
+            }
+            deliver_framesets();
+        } )
+    {
+        auto tolerance = std::make_shared< ptr_option< float > >(
+            0.f, 1000.f, 0.5f, 0.f,
+            &_tolerance_option_ms,
+            "Largest difference, in milliseconds, between timestamps in the same frameset; 0 for half a frame" );
+        tolerance->on_set( [this]( float value ) {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _tolerance_ms = value;
+        } );
+        register_option( RS2_OPTION_SYNC_TOLERANCE, tolerance );
+
+        auto deadline = std::make_shared< ptr_option< float > >(
+            1.f, 5000.f, 1.f, 100.f,
+            &_deadline_option_ms,
+            "Longest time, in milliseconds, a frameset waits for missing devices before it is released without them" );
+        deadline->on_set( [this]( float value ) {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _deadline_ms = value;
+        } );
+        register_option( RS2_OPTION_SYNC_DEADLINE, deadline );
+
+        // Called by the previous processing block (usually a sensor) with each frame, from any thread. Each device has a
+        // thread of its own where its frames are matched, so a device never waits for another.
+        auto f = [this]( frame_holder && frame, synthetic_source_interface * source )
+        {
+            auto device = get_device_syncer( frame.frame );
+            if( ! device )
+                return;  // stopped
+
+            auto dev = device.get();
+            auto holder = std::make_shared< frame_holder >( std::move( frame ) );
+            dev->thread.invoke( [this, dev, holder, source]( dispatcher::cancellable_timer ) {
+                // A frameset is already synchronized (e.g., by a pipeline): nothing to match within the device
+                if( dynamic_cast< composite_frame * >( holder->frame ) )
+                {
+                    on_device_frames( *dev, std::move( *holder ) );
+                    return;
+                }
+                dev->frames_matcher->dispatch( std::move( *holder ), { source, dev->matches, false } );
+                frame_holder matched;
+                while( dev->matches.try_dequeue( &matched ) )
+                    on_device_frames( *dev, std::move( matched ) );
+            } );
+        };
+
+        set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
+
+        _watchdog.start();
+    }
+
+
+    multi_device_syncer::~multi_device_syncer()
+    {
+        stop();
+    }
+
+
+    void multi_device_syncer::stop()
+    {
+        std::vector< std::shared_ptr< device_syncer > > devices;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _stopped )
+                return;
+            _stopped = true;
+            devices = std::move( _devices );
+            _devices.clear();
+        }
+
+        // Device threads may be waiting on our mutex, so we must not hold it here
+        _watchdog.stop();
+        for( auto & device : devices )
+        {
+            device->thread.stop();
+            device->frames_matcher->stop();
+        }
+    }
+
+
+    std::shared_ptr< multi_device_syncer::device_syncer >
+    multi_device_syncer::get_device_syncer( frame_interface const * f )
+    {
+        auto const device = get_device( f );
+
+        // A syncer we replace must be destroyed outside the lock: its thread may be waiting on it
+        std::shared_ptr< device_syncer > replaced;
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( _stopped )
+            return nullptr;
+        for( auto & d : _devices )
+        {
+            if( d->key != device.get() )
+                continue;
+            if( ! device || ! d->device.expired() )
+                return d;
+            // A new device, where one that is gone used to be
+            replaced = std::move( d );
+            d = std::make_shared< device_syncer >( device );
+            return d;
+        }
+        _devices.push_back( std::make_shared< device_syncer >( device ) );
+        return _devices.back();
+    }
+
+
+    void multi_device_syncer::on_device_frames( device_syncer & device, frame_holder frames )
+    {
+        pending_frames pending;
+        pending.timestamp = get_sync_timestamp( frames.frame );
+        pending.fps = frames->get_stream()->get_framerate();
+        pending.arrived = clock::now();
+        pending.frames = std::move( frames );
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _stopped )
+                return;
+            device.last_arrival = pending.arrived;
+            device.pending.push_back( std::move( pending ) );
+            release_framesets( device.last_arrival );
+        }
+        deliver_framesets();
+    }
+
+
+    bool multi_device_syncer::are_equivalent( pending_frames const & a, pending_frames const & b ) const
+    {
+        double tolerance = _tolerance_ms;
+        if( tolerance <= 0 )
+        {
+            auto const fps = std::min( a.fps, b.fps );
+            tolerance = fps > 0 ? 500. / fps : 0.;
+        }
+        return std::abs( a.timestamp - b.timestamp ) <= tolerance;
+    }
+
+
+    // Must be called under _mutex
+    void multi_device_syncer::release_framesets( clock::time_point now )
+    {
+        auto const deadline = std::chrono::duration< double, std::milli >( _deadline_ms );
+        std::vector< device_syncer * > matched;
+        while( true )
+        {
+            // The next frameset is formed around the earliest frames we have
+            device_syncer * earliest = nullptr;
+            bool overflow = false;
+            for( auto & d : _devices )
+            {
+                if( d->pending.empty() )
+                    continue;
+                if( ! earliest || d->pending.front().timestamp < earliest->pending.front().timestamp )
+                    earliest = d.get();
+                if( d->pending.size() > max_pending_per_device )
+                    overflow = true;
+            }
+            if( ! earliest )
+                break;
+
+            auto const & first = earliest->pending.front();
+            auto first_arrived = first.arrived;
+            bool complete = true;
+            matched.clear();
+            for( auto & d : _devices )
+            {
+                if( d->pending.empty() )
+                {
+                    if( now - d->last_arrival < inactive_device_timeout )
+                        complete = false;  // its frames may still arrive
+                }
+                else if( are_equivalent( first, d->pending.front() ) )
+                {
+                    matched.push_back( d.get() );
+                    first_arrived = std::min( first_arrived, d->pending.front().arrived );
+                }
+                // Otherwise the device is already past this frameset, and has nothing to add to it
+            }
+            if( ! complete && ! overflow && now - first_arrived < deadline )
+                break;
+
+            std::vector< frame_holder > frames;
+            frames.reserve( matched.size() );
+            for( auto d : matched )
+            {
+                frames.push_back( std::move( d->pending.front().frames ) );
+                d->pending.pop_front();
+            }
+            frame_holder frameset = get_source().allocate_composite_frame( std::move( frames ) );
+            if( frameset )
+                _framesets.enqueue( std::move( frameset ) );
+        }
+    }
+
+
+    void multi_device_syncer::deliver_framesets()
+    {
+        // Framesets are released from several threads, but must be delivered one at a time and in order
+        while( ! _framesets.empty() )
+        {
+            std::unique_lock< std::mutex > lock( _callback_mutex, std::try_to_lock );
+            if( ! lock.owns_lock() )
+                return;  // whoever has it will deliver ours, too
+
+            frame_holder f;
+            while( _framesets.try_dequeue( &f ) )
+                get_source().frame_ready( std::move( f ) );
+        }
+    }
+}
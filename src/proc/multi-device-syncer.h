@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "sync.h"
+
+#include <rsutils/concurrency/concurrency.h>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+
+namespace librealsense
+{
+    class device_interface;
+
+    // Synchronizes frames from several devices into framesets containing the frames of all of them.
+    //
+    // The frames of each device are first matched among themselves, on a thread of their own, by the same matcher the
+    // regular syncer would use for that device; devices therefore do not wait on each other. The resulting per-device
+    // framesets are then matched across devices by timestamp, which is only meaningful if all devices stream in the
+    // same domain: RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME (or system time). Hardware-clock timestamps of different devices
+    // cannot be compared, so the arrival time is used for these instead.
+    //
+    // A frameset still missing some device when its deadline passes is released without it: the deadline is measured
+    // from the arrival of the frameset's first frame, so it bounds the latency the syncer adds.
+    //
+    class multi_device_syncer : public processing_block
+    {
+    public:
+        multi_device_syncer();
+        ~multi_device_syncer();
+
+        // Stopping the syncer means no more frames will be synchronized, and any frames pending a match will be lost!
+        void stop();
+
+    private:
+        typedef std::chrono::steady_clock clock;
+
+        // The frames of one device waiting to be matched with those of the others
+        struct pending_frames
+        {
+            frame_holder frames;
+            double timestamp;
+            double fps;
+            clock::time_point arrived;
+        };
+
+        struct device_syncer;
+
+        std::shared_ptr< device_syncer > get_device_syncer( frame_interface const * );
+        void on_device_frames( device_syncer &, frame_holder );
+        void release_framesets( clock::time_point now );
+        void deliver_framesets();
+        bool are_equivalent( pending_frames const &, pending_frames const & ) const;
+
+        // Both in milliseconds, under _mutex; a tolerance of 0 means half a frame
+        float _tolerance_ms;
+        float _deadline_ms;
+        // What the options write, unsynchronized; copied into the above, under the lock, when they change
+        float _tolerance_option_ms;
+        float _deadline_option_ms;
+
+        std::vector< std::shared_ptr< device_syncer > > _devices;  // in order of first arrival
+        bool _stopped;
+
+        single_consumer_frame_queue< frame_holder > _framesets;
+        std::mutex _callback_mutex;
+
+        // Releases framesets whose deadline passed, when no new frames arrive to do it
+        active_object<> _watchdog;
+    };
+}
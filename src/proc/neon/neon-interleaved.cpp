@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "neon-interleaved.h"
+
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+
+#include <arm_neon.h>
+
+
+namespace librealsense {
+
+
+// x << 6 | x >> 4: approximates x * 65535 / 1023, converting 10-bit data to 16 bits
+static inline uint16x8_t expand_10_to_16( uint16x8_t x )
+{
+    return vorrq_u16( vshlq_n_u16( x, 6 ), vshrq_n_u16( x, 4 ) );
+}
+
+
+int split_y8i_neon( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi )
+{
+    int i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        uint8x16x2_t px = vld2q_u8( source + 2 * i );
+        // With MIPI, the left pixels of every pair are swapped
+        vst1q_u8( left + i, mipi ? vrev16q_u8( px.val[0] ) : px.val[0] );
+        vst1q_u8( right + i, px.val[1] );
+    }
+    return i;
+}
+
+
+int split_y12i_neon( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride )
+{
+    uint8x8_t const low_nibble = vdup_n_u8( 0x0f );
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint8x8_t b0, b1, b2;
+        if( stride == 4 )
+        {
+            uint8x8x4_t px = vld4_u8( source + 4 * i );
+            b0 = px.val[0], b1 = px.val[1], b2 = px.val[2];
+        }
+        else
+        {
+            uint8x8x3_t px = vld3_u8( source + 3 * i );
+            b0 = px.val[0], b1 = px.val[1], b2 = px.val[2];
+        }
+        // right = (b1 & 0xf) << 8 | b0; left = b2 << 4 | b1 >> 4
+        uint16x8_t r = vorrq_u16( vshll_n_u8( vand_u8( b1, low_nibble ), 8 ), vmovl_u8( b0 ) );
+        uint16x8_t l = vorrq_u16( vshll_n_u8( b2, 4 ), vmovl_u8( vshr_n_u8( b1, 4 ) ) );
+        vst1q_u16( left + i, expand_10_to_16( l ) );
+        vst1q_u16( right + i, expand_10_to_16( r ) );
+    }
+    return i;
+}
+
+
+int split_y16i_10msb_neon( uint16_t * left, uint16_t * right, const uint8_t * source, int count )
+{
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        uint16x8x2_t px = vld2q_u16( reinterpret_cast< const uint16_t * >( source + 4 * i ) );
+        vst1q_u16( left + i, expand_10_to_16( px.val[0] ) );
+        vst1q_u16( right + i, expand_10_to_16( px.val[1] ) );
+    }
+    return i;
+}
+
+
+}  // namespace librealsense
+
+#endif
@@ -0,0 +1,23 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// NEON kernels for the interleaved-IR splitters in interleaved-unpack.h.
+// Each handles as many whole vectors as it can and returns the number of pixels it did; the caller does the rest.
+#if defined( __ARM_NEON ) && ! defined( ANDROID )
+
+int split_y8i_neon( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi );
+int split_y12i_neon( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride );
+int split_y16i_10msb_neon( uint16_t * left, uint16_t * right, const uint8_t * source, int count );
+
+#endif
+
+
+}  // namespace librealsense
@@ -0,0 +1,289 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rotate-image.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __SSSE3__
+#include <emmintrin.h>  // SSE2 is all we need
+#endif
+
+
+namespace librealsense {
+
+
+namespace {
+
+
+struct pixel24
+{
+    uint8_t bytes[3];
+};
+
+
+// Transposes an N x N block: cols[c][r] = rows[r][c]
+// This works for any pixel type; simd_block_transpose does it in registers, where it can.
+template< class T, int N >
+struct block_transpose
+{
+    static void transpose( const T * const rows[N], T * const cols[N] )
+    {
+        for( int r = 0; r < N; ++r )
+            for( int c = 0; c < N; ++c )
+                cols[c][r] = rows[r][c];
+    }
+};
+
+
+template< class T, int N >
+struct simd_block_transpose : block_transpose< T, N >
+{
+};
+
+
+#ifdef __SSSE3__
+
+template<>
+struct simd_block_transpose< uint8_t, 8 >
+{
+    static void transpose( const uint8_t * const rows[8], uint8_t * const cols[8] )
+    {
+        __m128i r[8];
+        for( int i = 0; i < 8; ++i )
+            r[i] = _mm_loadl_epi64( reinterpret_cast< const __m128i * >( rows[i] ) );
+
+        __m128i a0 = _mm_unpacklo_epi8( r[0], r[1] );
+        __m128i a1 = _mm_unpacklo_epi8( r[2], r[3] );
+        __m128i a2 = _mm_unpacklo_epi8( r[4], r[5] );
+        __m128i a3 = _mm_unpacklo_epi8( r[6], r[7] );
+
+        __m128i b0 = _mm_unpacklo_epi16( a0, a1 );  // columns 0-3, rows 0-3
+        __m128i b1 = _mm_unpackhi_epi16( a0, a1 );  // columns 4-7, rows 0-3
+        __m128i b2 = _mm_unpacklo_epi16( a2, a3 );  // columns 0-3, rows 4-7
+        __m128i b3 = _mm_unpackhi_epi16( a2, a3 );  // columns 4-7, rows 4-7
+
+        __m128i c[4] = { _mm_unpacklo_epi32( b0, b2 ),    // columns 0, 1
+                         _mm_unpackhi_epi32( b0, b2 ),    // columns 2, 3
+                         _mm_unpacklo_epi32( b1, b3 ),    // columns 4, 5
+                         _mm_unpackhi_epi32( b1, b3 ) };  // columns 6, 7
+        for( int i = 0; i < 4; ++i )
+        {
+            _mm_storel_epi64( reinterpret_cast< __m128i * >( cols[2 * i] ), c[i] );
+            _mm_storel_epi64( reinterpret_cast< __m128i * >( cols[2 * i + 1] ), _mm_unpackhi_epi64( c[i], c[i] ) );
+        }
+    }
+};
+
+template<>
+struct simd_block_transpose< uint16_t, 8 >
+{
+    static void transpose( const uint16_t * const rows[8], uint16_t * const cols[8] )
+    {
+        __m128i r[8];
+        for( int i = 0; i < 8; ++i )
+            r[i] = _mm_loadu_si128( reinterpret_cast< const __m128i * >( rows[i] ) );
+
+        __m128i a[8];
+        for( int i = 0; i < 4; ++i )
+        {
+            a[2 * i] = _mm_unpacklo_epi16( r[2 * i], r[2 * i + 1] );      // columns 0-3
+            a[2 * i + 1] = _mm_unpackhi_epi16( r[2 * i], r[2 * i + 1] );  // columns 4-7
+        }
+
+        __m128i b[8];
+        for( int i = 0; i < 2; ++i )  // rows 0-3, then rows 4-7
+        {
+            b[4 * i + 0] = _mm_unpacklo_epi32( a[4 * i + 0], a[4 * i + 2] );  // columns 0, 1
+            b[4 * i + 1] = _mm_unpackhi_epi32( a[4 * i + 0], a[4 * i + 2] );  // columns 2, 3
+            b[4 * i + 2] = _mm_unpacklo_epi32( a[4 * i + 1], a[4 * i + 3] );  // columns 4, 5
+            b[4 * i + 3] = _mm_unpackhi_epi32( a[4 * i + 1], a[4 * i + 3] );  // columns 6, 7
+        }
+
+        for( int i = 0; i < 4; ++i )
+        {
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[2 * i] ), _mm_unpacklo_epi64( b[i], b[i + 4] ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[2 * i + 1] ), _mm_unpackhi_epi64( b[i], b[i + 4] ) );
+        }
+    }
+};
+
+template<>
+struct simd_block_transpose< uint32_t, 4 >
+{
+    static void transpose( const uint32_t * const rows[4], uint32_t * const cols[4] )
+    {
+        __m128i r0 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( rows[0] ) );
+        __m128i r1 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( rows[1] ) );
+        __m128i r2 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( rows[2] ) );
+        __m128i r3 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( rows[3] ) );
+
+        __m128i a0 = _mm_unpacklo_epi32( r0, r1 );  // columns 0, 1 of rows 0, 1
+        __m128i a1 = _mm_unpackhi_epi32( r0, r1 );  // columns 2, 3
+        __m128i a2 = _mm_unpacklo_epi32( r2, r3 );
+        __m128i a3 = _mm_unpackhi_epi32( r2, r3 );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[0] ), _mm_unpacklo_epi64( a0, a2 ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[1] ), _mm_unpackhi_epi64( a0, a2 ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[2] ), _mm_unpacklo_epi64( a1, a3 ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( cols[3] ), _mm_unpackhi_epi64( a1, a3 ) );
+    }
+};
+
+#endif  // __SSSE3__
+
+
+// Blocks are grouped into tiles of about this many pixels on a side, so that the source rows and destination rows a
+// tile touches stay in cache while it is processed
+const int tile_size = 64;
+
+
+// 90 degrees clockwise:  out[j][height-1-i] = source[i][j]
+// 90 counter-clockwise:  out[width-1-j][i] = source[i][j]
+template< class T, int N, class TRANSPOSE >
+void rotate_90( T * out, const T * source, int width, int height, bool clockwise )
+{
+    auto out_index = [&]( int i, int j ) -> size_t
+    {
+        return clockwise ? size_t( j ) * height + ( height - 1 - i ) : size_t( width - 1 - j ) * height + i;
+    };
+
+    int const full_height = height - height % N;
+    int const full_width = width - width % N;
+
+    for( int ti = 0; ti < full_height; ti += tile_size )
+    {
+        int const ti_end = std::min( ti + tile_size, full_height );
+        for( int tj = 0; tj < full_width; tj += tile_size )
+        {
+            int const tj_end = std::min( tj + tile_size, full_width );
+            for( int i = ti; i < ti_end; i += N )
+            {
+                for( int j = tj; j < tj_end; j += N )
+                {
+                    // Order the rows so that each transposed column comes out in destination order
+                    const T * rows[N];
+                    T * cols[N];
+                    for( int k = 0; k < N; ++k )
+                    {
+                        if( clockwise )
+                        {
+                            rows[k] = source + size_t( i + N - 1 - k ) * width + j;
+                            cols[k] = out + out_index( i + N - 1, j + k );
+                        }
+                        else
+                        {
+                            rows[k] = source + size_t( i + k ) * width + j;
+                            cols[k] = out + out_index( i, j + k );
+                        }
+                    }
+                    TRANSPOSE::transpose( rows, cols );
+                }
+            }
+        }
+    }
+
+    // Whatever is left over at the right and bottom edges
+    for( int i = 0; i < height; ++i )
+        for( int j = ( i < full_height ? full_width : 0 ); j < width; ++j )
+            out[out_index( i, j )] = source[size_t( i ) * width + j];
+}
+
+
+template< class T, int N >
+void rotate( uint8_t * out, const uint8_t * source, int width, int height, int angle, bool simd )
+{
+    auto const src = reinterpret_cast< const T * >( source );
+    auto const dst = reinterpret_cast< T * >( out );
+    switch( angle )
+    {
+    case 90:
+    case -90:
+        if( simd )
+            rotate_90< T, N, simd_block_transpose< T, N > >( dst, src, width, height, angle == 90 );
+        else
+            rotate_90< T, N, block_transpose< T, N > >( dst, src, width, height, angle == 90 );
+        break;
+    case 180:
+        // Reversing the whole image reverses both the rows and the pixels in them
+        std::reverse_copy( src, src + size_t( width ) * height, dst );
+        break;
+    default:
+        throw std::invalid_argument( "Invalid rotation angle. Only 90, -90, and 180 degrees are supported." );
+    }
+}
+
+
+}  // namespace
+
+
+void rotate_image( uint8_t * out, const uint8_t * source, int width, int height, int bpp, int angle, bool simd )
+{
+    switch( bpp )
+    {
+    case 1:
+        rotate< uint8_t, 8 >( out, source, width, height, angle, simd );
+        break;
+    case 2:
+        rotate< uint16_t, 8 >( out, source, width, height, angle, simd );
+        break;
+    case 3:
+        rotate< pixel24, 8 >( out, source, width, height, angle, simd );
+        break;
+    case 4:
+        rotate< uint32_t, 4 >( out, source, width, height, angle, simd );
+        break;
+    default:
+        throw std::invalid_argument( "Unsupported bytes-per-pixel for rotation" );
+    }
+}
+
+
+void rotate_yuyv( uint8_t * out, const uint8_t * source, int width, int height, int angle, std::vector< uint32_t > & scratch )
+{
+    if( angle == 180 )
+    {
+        // Each Y-U-Y-V pair stays together
+        rotate_image( out, source, width / 2, height, 4, angle );
+        return;
+    }
+    if( angle != 90 && angle != -90 )
+        throw std::invalid_argument( "Invalid rotation angle. Only 90, -90, and 180 degrees are supported." );
+    if( height % 2 )
+        throw std::invalid_argument( "YUYV can only be rotated by 90 degrees when its height is even" );
+
+    size_t const n_pixels = size_t( width ) * height;
+    scratch.resize( 2 * n_pixels );
+    uint32_t * const expanded = scratch.data();
+    uint32_t * const rotated = expanded + n_pixels;
+
+    // Y0 U Y1 V  ->  [Y0 U V] [Y1 U V]
+    for( size_t i = 0; i < n_pixels; i += 2, source += 4 )
+    {
+        uint32_t const uv = uint32_t( source[1] ) << 8 | uint32_t( source[3] ) << 16;
+        expanded[i] = source[0] | uv;
+        expanded[i + 1] = source[2] | uv;
+    }
+
+    rotate_image( reinterpret_cast< uint8_t * >( rotated ),
+                  reinterpret_cast< const uint8_t * >( expanded ),
+                  width,
+                  height,
+                  sizeof( uint32_t ),
+                  angle );
+
+    // Back to pairs, now along the new rows, averaging their U and V
+    for( size_t i = 0; i < n_pixels; i += 2, out += 4 )
+    {
+        uint32_t const p0 = rotated[i];
+        uint32_t const p1 = rotated[i + 1];
+        out[0] = uint8_t( p0 );
+        out[1] = uint8_t( ( ( p0 >> 8 & 0xff ) + ( p1 >> 8 & 0xff ) + 1 ) / 2 );
+        out[2] = uint8_t( p1 );
+        out[3] = uint8_t( ( ( p0 >> 16 & 0xff ) + ( p1 >> 16 & 0xff ) + 1 ) / 2 );
+    }
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,31 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// Rotate an image of 'width' x 'height' pixels of 'bpp' (1-4) bytes each by 90 (clockwise), -90 or 180 degrees.
+// For +/-90, 'out' is 'height' pixels wide.
+//
+// The +/-90 rotations are done as blocked transposes: the image is walked in cache-sized tiles, each made of small
+// square blocks that are transposed in registers (SSE where available), so neither image is walked column-wise.
+// With 'simd' false, the blocks are transposed pixel by pixel even where SSE is available, e.g. to check that both give
+// the exact same output.
+//
+void rotate_image( uint8_t * out, const uint8_t * source, int width, int height, int bpp, int angle, bool simd = true );
+
+
+// YUYV cannot be rotated by +/-90 as-is: each pair of pixels shares its U and V. So it is expanded to one YUV pixel
+// per 4 bytes, rotated, and each new horizontal pair then gets the average of its U and V values.
+// The rotated width ('height') must be even for +/-90. 'scratch' is reused between calls to avoid allocations.
+//
+void rotate_yuyv( uint8_t * out, const uint8_t * source, int width, int height, int angle, std::vector< uint32_t > & scratch );
+
+
+}  // namespace librealsense
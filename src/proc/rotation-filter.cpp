@@ -6,6 +6,7 @@
 #include "stream.h"
 #include "core/video.h"
 #include "proc/rotation-filter.h"
+#include "proc/rotate-image.h"
 #include <rsutils/easylogging/easyloggingpp.h>
 
 namespace librealsense {
@@ -85,9 +86,9 @@ namespace librealsense {
         if (auto tgt = prepare_target_frame( f, source, target_profile, tgt_type ))
         {
             auto format = profile.format();
-            if( format == RS2_FORMAT_YUYV && ( local_value == 90 || local_value == -90 ) )
+            if( format == RS2_FORMAT_YUYV && ( local_value == 90 || local_value == -90 ) && src.get_height() % 2 )
             {
-                LOG_ERROR( "Rotating YUYV format is disabled for 90 or -90 degrees" );
+                LOG_ERROR( "Rotating YUYV by 90 or -90 degrees requires an even height" );
                 return f;
             }
 
@@ -96,7 +97,8 @@ namespace librealsense {
                 rotate_YUYV_frame( static_cast< uint8_t * >( const_cast< void * >( tgt.get_data() ) ),
                                    static_cast< const uint8_t * >( src.get_data() ),
                                    src.get_width(),
-                                   src.get_height() );
+                                   src.get_height(),
+                                   local_value );
             }
             else
             {
@@ -225,59 +227,13 @@ namespace librealsense {
 
     void rotation_filter::rotate_frame( uint8_t * const out, const uint8_t * source, int width, int height, int bpp, float & value )
     {
-        if( value != 90 && value != -90 && value != 180 )
-        {
-            throw std::invalid_argument( "Invalid rotation angle. Only 90, -90, and 180 degrees are supported." );
-        }
-
-        // Define output dimensions
-        int width_out = ( value == 90 || value == -90 ) ? height : width;    // rotate by 180 will keep the values as is
-        int height_out = ( value == 90 || value == -90 ) ? width : height;  // rotate by 180 will keep the values as is
-
-        // Perform rotation
-        for( int i = 0; i < height; ++i )
-        {
-            for( int j = 0; j < width; ++j )
-            {
-                // Calculate source index
-                size_t src_index = ( i * width + j ) * bpp;
-
-                // Determine output index based on rotation angle
-                size_t out_index;
-                if( value == 90 )
-                {
-                    out_index = ( j * height + ( height - i - 1 ) ) * bpp;
-                }
-                else if( value == -90 )
-                {
-                    out_index = ( ( width - j - 1 ) * height + i ) * bpp;
-                }
-                else  // 180 degrees
-                {
-                    out_index = ( ( height - i - 1 ) * width + ( width - j - 1 ) ) * bpp;
-                }
-
-                // Copy pixel data from source to destination
-                std::memcpy( &out[out_index], &source[src_index], bpp );
-            }
-        }
+        rotate_image( out, source, width, height, bpp, static_cast< int >( value ) );
     }
 
 
-    void rotation_filter::rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height ) 
+    void rotation_filter::rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height, float & value )
     {
-        int frame_size = width * height * 2;  // YUYV has 2 bytes per pixel
-        for( int i = 0; i < frame_size; i += 4 )
-        {
-            // Find the corresponding flipped position in the output
-            int flipped_index = frame_size - 4 - i;
-
-            // Copy YUYV pixels in reverse order to rotate 180 degrees
-            out[flipped_index] = source[i];          // Y1
-            out[flipped_index + 1] = source[i + 1];  // U
-            out[flipped_index + 2] = source[i + 2];  // Y2
-            out[flipped_index + 3] = source[i + 3];  // V
-        }
+        rotate_yuyv( out, source, width, height, static_cast< int >( value ), _yuyv_scratch );
     }
 
 
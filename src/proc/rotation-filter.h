@@ -22,7 +22,7 @@ namespace librealsense
                                          const rs2::stream_profile & target_profile,
                                          rs2_extension tgt_type );
         void rotate_frame( uint8_t * const out, const uint8_t * source, int width, int height, int bpp, float & value );
-        void rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height );
+        void rotate_YUYV_frame( uint8_t * const out, const uint8_t * source, int width, int height, float & value );
 
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
         bool should_process( const rs2::frame & frame ) override;
@@ -37,6 +37,7 @@ namespace librealsense
         uint16_t                  _rotated_width;     
         uint16_t                  _rotated_height;
         float _value;
+        std::vector< uint32_t > _yuyv_scratch;  // for YUYV +/-90, reused between frames
         std::map< std::pair< rs2_stream, int >, float > _last_rotation_values;
         std::map< std::pair< rs2_stream, int >, rs2::stream_profile > _target_stream_profiles;
         std::map< std::pair< rs2_stream, int >, rs2::stream_profile > _source_stream_profiles;
@@ -0,0 +1,192 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "sse-interleaved.h"
+
+#ifdef __SSSE3__
+
+#include <tmmintrin.h>  // SSSE3
+#ifdef RS2_HAS_AVX2_KERNELS
+#include <immintrin.h>  // AVX2
+#define AVX2_TARGET __attribute__( ( target( "avx2" ) ) )
+#endif
+
+
+namespace librealsense {
+
+
+// Shuffles that gather, within each 16 bytes, all the left values into the low 8 bytes and the right into the high 8
+static __m128i y8i_shuffle( bool mipi )
+{
+    // With MIPI, the left pixels of every pair are swapped
+    return mipi ? _mm_setr_epi8( 2, 0, 6, 4, 10, 8, 14, 12, 1, 3, 5, 7, 9, 11, 13, 15 )
+                : _mm_setr_epi8( 0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15 );
+}
+
+static __m128i y12i_shuffle( int stride )
+{
+    // 4 pixels: the right words are bytes 0-1 of each pixel (masked to 12 bits), the left words bytes 1-2 (shifted >> 4)
+    return stride == 4 ? _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, 1, 2, 5, 6, 9, 10, 13, 14 )
+                       : _mm_setr_epi8( 0, 1, 3, 4, 6, 7, 9, 10, 1, 2, 4, 5, 7, 8, 10, 11 );
+}
+
+static __m128i y16i_shuffle()
+{
+    return _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15 );
+}
+
+
+// x << 6 | x >> 4: approximates x * 65535 / 1023, converting 10-bit data to 16 bits
+static inline __m128i expand_10_to_16( __m128i x )
+{
+    return _mm_or_si128( _mm_slli_epi16( x, 6 ), _mm_srli_epi16( x, 4 ) );
+}
+
+
+int split_y8i_ssse3( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi )
+{
+    __m128i const shuffle = y8i_shuffle( mipi );
+    int i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        auto src = reinterpret_cast< const __m128i * >( source + 2 * i );
+        __m128i a = _mm_shuffle_epi8( _mm_loadu_si128( src ), shuffle );
+        __m128i b = _mm_shuffle_epi8( _mm_loadu_si128( src + 1 ), shuffle );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( left + i ), _mm_unpacklo_epi64( a, b ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( right + i ), _mm_unpackhi_epi64( a, b ) );
+    }
+    return i;
+}
+
+
+int split_y12i_ssse3( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride )
+{
+    __m128i const shuffle = y12i_shuffle( stride );
+    __m128i const mask12 = _mm_set1_epi16( 0x0fff );
+    // Each 8 pixels are read as two 16-byte loads 4 pixels apart, which may read past the pixels themselves
+    int const bytes_read = 4 * stride + 16;
+    int i = 0;
+    for( ; stride * i + bytes_read <= stride * count; i += 8 )
+    {
+        auto src = source + stride * i;
+        __m128i a = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( src ) ), shuffle );
+        __m128i b = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( src + 4 * stride ) ),
+                                      shuffle );
+        __m128i r = _mm_and_si128( _mm_unpacklo_epi64( a, b ), mask12 );
+        __m128i l = _mm_srli_epi16( _mm_unpackhi_epi64( a, b ), 4 );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( left + i ), expand_10_to_16( l ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( right + i ), expand_10_to_16( r ) );
+    }
+    return i;
+}
+
+
+int split_y16i_10msb_ssse3( uint16_t * left, uint16_t * right, const uint8_t * source, int count )
+{
+    __m128i const shuffle = y16i_shuffle();
+    int i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        auto src = reinterpret_cast< const __m128i * >( source + 4 * i );
+        __m128i a = _mm_shuffle_epi8( _mm_loadu_si128( src ), shuffle );
+        __m128i b = _mm_shuffle_epi8( _mm_loadu_si128( src + 1 ), shuffle );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( left + i ), expand_10_to_16( _mm_unpacklo_epi64( a, b ) ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( right + i ), expand_10_to_16( _mm_unpackhi_epi64( a, b ) ) );
+    }
+    return i;
+}
+
+
+#ifdef RS2_HAS_AVX2_KERNELS
+
+
+// The AVX2 versions use the same in-lane shuffles: each 128-bit lane ends up with [left | right] halves. Two such
+// registers are then combined so all the lefts, and all the rights, come out in order.
+AVX2_TARGET static inline void gather_halves( __m256i a, __m256i b, __m256i & left, __m256i & right )
+{
+    left = _mm256_permute4x64_epi64( _mm256_unpacklo_epi64( a, b ), 0xD8 );   // 0, 2, 1, 3
+    right = _mm256_permute4x64_epi64( _mm256_unpackhi_epi64( a, b ), 0xD8 );
+}
+
+AVX2_TARGET static inline __m256i expand_10_to_16( __m256i x )
+{
+    return _mm256_or_si256( _mm256_slli_epi16( x, 6 ), _mm256_srli_epi16( x, 4 ) );
+}
+
+AVX2_TARGET static inline __m256i load_two( const uint8_t * lo, const uint8_t * hi )
+{
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( lo ) ) ),
+        _mm_loadu_si128( reinterpret_cast< const __m128i * >( hi ) ),
+        1 );
+}
+
+
+AVX2_TARGET int split_y8i_avx2( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi )
+{
+    __m128i const shuffle128 = y8i_shuffle( mipi );
+    __m256i const shuffle = _mm256_inserti128_si256( _mm256_castsi128_si256( shuffle128 ), shuffle128, 1 );
+    int i = 0;
+    for( ; i + 32 <= count; i += 32 )
+    {
+        auto src = reinterpret_cast< const __m256i * >( source + 2 * i );
+        __m256i a = _mm256_shuffle_epi8( _mm256_loadu_si256( src ), shuffle );
+        __m256i b = _mm256_shuffle_epi8( _mm256_loadu_si256( src + 1 ), shuffle );
+        __m256i l, r;
+        gather_halves( a, b, l, r );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( left + i ), l );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( right + i ), r );
+    }
+    return i;
+}
+
+
+AVX2_TARGET int split_y12i_avx2( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride )
+{
+    __m128i const shuffle128 = y12i_shuffle( stride );
+    __m256i const shuffle = _mm256_inserti128_si256( _mm256_castsi128_si256( shuffle128 ), shuffle128, 1 );
+    __m256i const mask12 = _mm256_set1_epi16( 0x0fff );
+    // Each 16 pixels are read as four 16-byte loads 4 pixels apart, which may read past the pixels themselves
+    int const bytes_read = 12 * stride + 16;
+    int i = 0;
+    for( ; stride * i + bytes_read <= stride * count; i += 16 )
+    {
+        auto src = source + stride * i;
+        __m256i a = _mm256_shuffle_epi8( load_two( src, src + 4 * stride ), shuffle );
+        __m256i b = _mm256_shuffle_epi8( load_two( src + 8 * stride, src + 12 * stride ), shuffle );
+        __m256i l, r;
+        gather_halves( a, b, r, l );  // right words come first in each lane
+        r = _mm256_and_si256( r, mask12 );
+        l = _mm256_srli_epi16( l, 4 );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( left + i ), expand_10_to_16( l ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( right + i ), expand_10_to_16( r ) );
+    }
+    return i;
+}
+
+
+AVX2_TARGET int split_y16i_10msb_avx2( uint16_t * left, uint16_t * right, const uint8_t * source, int count )
+{
+    __m128i const shuffle128 = y16i_shuffle();
+    __m256i const shuffle = _mm256_inserti128_si256( _mm256_castsi128_si256( shuffle128 ), shuffle128, 1 );
+    int i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        auto src = reinterpret_cast< const __m256i * >( source + 4 * i );
+        __m256i a = _mm256_shuffle_epi8( _mm256_loadu_si256( src ), shuffle );
+        __m256i b = _mm256_shuffle_epi8( _mm256_loadu_si256( src + 1 ), shuffle );
+        __m256i l, r;
+        gather_halves( a, b, l, r );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( left + i ), expand_10_to_16( l ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( right + i ), expand_10_to_16( r ) );
+    }
+    return i;
+}
+
+
+#endif  // RS2_HAS_AVX2_KERNELS
+
+
+}  // namespace librealsense
+
+#endif  // __SSSE3__
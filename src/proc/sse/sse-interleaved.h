@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../cpu-features.h"  // RS2_HAS_AVX2_KERNELS
+
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// x86 kernels for the interleaved-IR splitters in interleaved-unpack.h.
+// Each handles as many whole vectors as it can and returns the number of pixels it did; the caller does the rest.
+#ifdef __SSSE3__
+
+int split_y8i_ssse3( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi );
+int split_y12i_ssse3( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride );
+int split_y16i_10msb_ssse3( uint16_t * left, uint16_t * right, const uint8_t * source, int count );
+
+// Built for AVX2 regardless of the compiler flags; only call these if the CPU has it
+#ifdef RS2_HAS_AVX2_KERNELS
+int split_y8i_avx2( uint8_t * left, uint8_t * right, const uint8_t * source, int count, bool mipi );
+int split_y12i_avx2( uint16_t * left, uint16_t * right, const uint8_t * source, int count, int stride );
+int split_y16i_10msb_avx2( uint16_t * left, uint16_t * right, const uint8_t * source, int count );
+#endif
+
+#endif  // __SSSE3__
+
+
+}  // namespace librealsense
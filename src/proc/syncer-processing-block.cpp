@@ -7,6 +7,7 @@
 #include "proc/synthetic-stream.h"
 #include "proc/syncer-processing-block.h"
 #include <src/core/frame-processor-callback.h>
+#include <rsutils/json.h>
 
 
 namespace librealsense
@@ -14,6 +15,22 @@ namespace librealsense
     syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
         : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
         , _enable_opts(enable_opts.begin(), enable_opts.end())
+        , _deadline_option_ms( 0.f )
+        , _deadline_ms( 0.f )
+        , _deadline_watchdog( [this, log]( dispatcher::cancellable_timer timer ) {
+            float const deadline_ms = _deadline_ms.load();
+            auto const interval = deadline_ms > 0 ? std::chrono::microseconds( int64_t( deadline_ms * 250 ) )
+                                                  : std::chrono::microseconds( 100000 );
+            if( ! timer.try_sleep( interval ) || deadline_ms <= 0 )
+                return;
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                if( ! _matcher->get_active() )
+                    return;
+                _matcher->check_deadline( { &get_source(), _matches, log, deadline_ms, &_sync_statistics } );
+            }
+            deliver_matches();
+        } )
     {
         _matcher->set_callback( []( frame_holder f, syncronization_environment const & env ) {
             if( env.log )
@@ -61,33 +78,65 @@ namespace librealsense
                     LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
                     return;
                 }
-                _matcher->dispatch(std::move(frame), { source, _matches, log });
+                _matcher->dispatch( std::move( frame ), { source, _matches, log, _deadline_ms.load(), &_sync_statistics } );
             }
 
-            frame_holder f;
-            {
-                // Another thread has the lock, meaning will get into the following loop and dequeue all
-                // the frames. So there's nothing for us to do...
-                std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
-                if (!lock.owns_lock())
-                    return;
+            deliver_matches();
+        };
 
-                while (_matches.try_dequeue(&f))
-                {
-                    LOG_DEBUG( "--> frame ready: " << *f.frame );
-                    get_source().frame_ready(std::move(f));
-                }
+        set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
+
+        auto deadline = std::make_shared< ptr_option< float > >(
+            0.f, 5000.f, 1.f, 0.f,
+            &_deadline_option_ms,
+            "Longest time, in milliseconds, a frameset waits for missing streams before it is released without them; "
+            "0 to wait as long as the streams are expected" );
+        deadline->on_set( [this]( float value ) {
+            _deadline_ms = value;
+            if( value > 0 )
+            {
+                if( ! _deadline_watchdog.is_active() )
+                    _deadline_watchdog.start();
             }
+            else
+                _deadline_watchdog.stop();
+        } );
+        register_option( RS2_OPTION_SYNC_DEADLINE, deadline );
+    }
 
-        };
+    void syncer_process_unit::deliver_matches()
+    {
+        // Matches are also released by the deadline watchdog, so we check again after letting go of the lock, in case
+        // something was queued after the other thread was done
+        frame_holder f;
+        while( ! _matches.empty() )
+        {
+            // Another thread has the lock, meaning will get into the following loop and dequeue all
+            // the frames. So there's nothing for us to do...
+            std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+                return;
 
-        set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
+            while (_matches.try_dequeue(&f))
+            {
+                LOG_DEBUG( "--> frame ready: " << *f.frame );
+                get_source().frame_ready(std::move(f));
+            }
+        }
+    }
+
+    rsutils::json syncer_process_unit::get_statistics() const
+    {
+        auto j = processing_block::get_statistics();
+        j["sync"] = _sync_statistics.to_json();
+        return j;
     }
 
     // Stopping the syncer means no more frames will be enqueued, and any existing frames
     // pending dispatch will be lost!
     void syncer_process_unit::stop()
     {
+        _deadline_watchdog.stop();
         _matcher->stop();
     }
 }
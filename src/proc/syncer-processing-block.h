@@ -8,11 +8,13 @@
 #include <stdint.h>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <memory>
 
 #include "types.h"
 #include "archive.h"
 #include "option.h"
+#include "sync.h"
 
 namespace librealsense
 {
@@ -35,15 +37,28 @@ namespace librealsense
         // pending dispatch will be lost!
         void stop();
 
+        rsutils::json get_statistics() const override;
+
         ~syncer_process_unit()
         {
+            _deadline_watchdog.stop();
             _matcher.reset();
         }
     private:
+        void deliver_matches();
+
         std::shared_ptr<matcher> _matcher;
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
 
         single_consumer_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
+
+        // RS2_OPTION_SYNC_DEADLINE: when positive, framesets are released without missing streams once they've waited
+        // this many milliseconds; the watchdog makes sure that happens even if no more frames arrive.
+        // The option writes its own copy, unsynchronized; the value we read, from any thread, is set when it changes.
+        float _deadline_option_ms;
+        std::atomic< float > _deadline_ms;
+        active_object<> _deadline_watchdog;
+        syncer_statistics _sync_statistics;
     };
 }
@@ -14,8 +14,11 @@
 #include "types.h"
 #include <src/image.h>
 #include <src/core/time-service.h>
+#include <src/pipeline-trace.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
+#include <chrono>
 
 
 namespace librealsense
@@ -32,7 +35,8 @@ namespace librealsense
     }
 
     processing_block::processing_block(const char* name) :
-        _source_wrapper(_source)
+        _source_wrapper(_source),
+        _trace_name( pipeline_trace::intern( name ) )
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
@@ -44,6 +48,10 @@ namespace librealsense
         frame_source::archive_id id
             = { f->get_stream()->get_stream_type(), f->get_stream()->get_stream_index(), RS2_EXTENSION_VIDEO_FRAME };
         auto callback = _source.begin_callback( id );
+        pipeline_trace_span span( _trace_name, f->get_frame_number() );
+        ++_statistics.frames_processed;
+        _statistics.bytes_processed += f->get_frame_data_size();
+        auto const start = std::chrono::steady_clock::now();
         try
         {
             if (_callback)
@@ -62,6 +70,22 @@ namespace librealsense
         {
             LOG_ERROR( "Exception was thrown during callback!" );
         }
+        _statistics.processing.record(
+            std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ).count() );
+    }
+
+    rsutils::json processing_block::get_statistics() const
+    {
+        auto j = _statistics.to_json();
+        j["output"] = _source.get_statistics();
+        return j;
+    }
+
+    rsutils::json generic_processing_block::get_statistics() const
+    {
+        auto j = processing_block::get_statistics();
+        j["frames-in-place"] = get_in_place_count();
+        return j;
     }
 
     generic_processing_block::generic_processing_block(const char* name)
@@ -71,6 +95,11 @@ namespace librealsense
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // Must be done before we add our own references below
+            _in_place_candidates.clear();
+            if (_in_place_enabled)
+                find_in_place_candidates((frame_interface*)f.get());
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -110,6 +139,38 @@ namespace librealsense
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
     }
 
+    void generic_processing_block::find_in_place_candidates(frame_interface* f)
+    {
+        // Our caller's reference must be the only one; frameset members must be held only by their frameset
+        auto owned = dynamic_cast<frame*>(f);
+        if (!owned || !owned->is_exclusive())
+            return;
+
+        if (auto composite = dynamic_cast<composite_frame*>(f))
+        {
+            for (size_t i = 0; i < composite->get_embedded_frames_count(); i++)
+                find_in_place_candidates(composite->get_frame(int(i)));
+        }
+        else
+        {
+            _in_place_candidates.push_back(f);
+        }
+    }
+
+    rs2::frame generic_processing_block::reuse_input_frame(const rs2::frame& f, const rs2::stream_profile& target_profile)
+    {
+        auto fi = (frame_interface*)f.get();
+        auto it = std::find(_in_place_candidates.begin(), _in_place_candidates.end(), fi);
+        if (it == _in_place_candidates.end())
+            return {};
+        _in_place_candidates.erase(it);  // can only be handed out once
+
+        if (f.get_profile().get() != target_profile.get())
+            fi->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(target_profile.get()->profile->shared_from_this()));
+        ++_in_place_count;
+        return f;
+    }
+
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
     {
         // this function prepares the processing block output frame(s) by the following heuristic:
@@ -118,7 +179,7 @@ namespace librealsense
         // if one of the input frames has the same stream type and format as the processed frame,
         //     remove the input frame from the output frameset (i.e. temporal filter), otherwise keep the input frame (i.e. colorizer).
         // the exception is in case one of the input frames is z16/z16h or disparity and the result frame is disparity or z16 respectively,
-        // in this case the input frame will be removed.
+        // in this case the input frame will be removed. a distance (meters) result frame counts as z16 here.
 
         if (results.empty())
         {
@@ -133,7 +194,7 @@ namespace librealsense
             auto format = f.get_profile().format();
             if (format == RS2_FORMAT_DISPARITY32 || format == RS2_FORMAT_DISPARITY16)
                 disparity_result_frame = true;
-            if (format == RS2_FORMAT_Z16)
+            if (format == RS2_FORMAT_Z16 || format == RS2_FORMAT_DISTANCE)
                 depth_result_frame = true;
         }
 
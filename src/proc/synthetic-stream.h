@@ -13,6 +13,8 @@
 #include <librealsense2/hpp/rs_frame.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
 
+#include <atomic>
+
 namespace librealsense
 {
 
@@ -59,6 +61,7 @@ namespace librealsense
         void set_output_callback( rs2_frame_callback_sptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        rsutils::json get_statistics() const override;
 
         virtual ~processing_block() { _source.flush(); }
     protected:
@@ -66,6 +69,8 @@ namespace librealsense
         std::mutex _mutex;
         rs2_frame_processor_callback_sptr _callback;
         synthetic_source _source_wrapper;
+        char const * _trace_name;  // see pipeline_trace
+        processing_block_statistics _statistics;
     };
 
     class LRS_EXTENSION_API generic_processing_block : public processing_block
@@ -74,11 +79,33 @@ namespace librealsense
         generic_processing_block(const char* name);
         virtual ~generic_processing_block() { _source.flush(); }
 
+        // Number of frames that were modified in place rather than copied into a new output frame
+        uint64_t get_in_place_count() const { return _in_place_count; }
+
+        rsutils::json get_statistics() const override;
+
     protected:
         virtual rs2::frame prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results);
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // Blocks whose output has the same size and frame type as their input can opt in to modifying the input in
+        // place, instead of allocating an output frame and copying the input into it. This only happens when the
+        // caller gave up the input frame (e.g., rs2_process_frame, or filter.process(std::move(f))) and nobody else
+        // holds it.
+        void enable_in_place_processing() { _in_place_enabled = true; }
+
+        // Returns the input frame 'f', now with 'target_profile', if it can be modified in place; an empty frame
+        // otherwise, in which case a new output frame should be allocated. Only valid within process_frame().
+        rs2::frame reuse_input_frame(const rs2::frame& f, const rs2::stream_profile& target_profile);
+
+    private:
+        void find_in_place_candidates(frame_interface* f);
+
+        bool _in_place_enabled = false;
+        std::vector<frame_interface*> _in_place_candidates;  // for the frame being processed; reused between frames
+        std::atomic<uint64_t> _in_place_count{ 0 };
     };
 
     struct stream_filter
@@ -18,7 +18,8 @@ namespace librealsense
     {
         _stream_filter.format = RS2_FORMAT_Z16;
         _stream_filter.stream = RS2_STREAM_DEPTH;
-        
+        enable_in_place_processing();
+
         auto min_opt = std::make_shared<ptr_option<float>>(0.f, 16.f, 0.1f, 0.1f, &_min, "Min range in meters");
 
         auto max_opt = std::make_shared<ptr_option<float>>(0.f, 16.f, 0.1f, 4.f, &_max, "Max range in meters");
@@ -47,8 +48,13 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
-        auto new_f = source.allocate_video_frame(_target_stream_profile, f,
-            vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
+        // A disparity frame is also a depth frame, but our output must not be one
+        rs2::frame new_f;
+        if (!f.is<rs2::disparity_frame>())
+            new_f = reuse_input_frame(f, _target_stream_profile);
+        if (!new_f)
+            new_f = source.allocate_video_frame(_target_stream_profile, f,
+                vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
         if (new_f)
         {
@@ -66,11 +72,11 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
+            // Written so the input and output may be the same frame
             for (int i = 0; i < width * height; i++)
             {
                 auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
+                new_data[i] = (dist >= _min && dist <= _max) ? depth_data[i] : 0;
             }
 
             return new_f;
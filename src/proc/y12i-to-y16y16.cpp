@@ -3,6 +3,7 @@
 
 #include "y12i-to-y16y16.h"
 #include "stream.h"
+#include "interleaved-unpack.h"
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
 #include "rsutils/accelerators/gpu.h"
@@ -22,9 +23,7 @@ namespace librealsense
             return;
         }
 #endif
-        split_frame(dest, count, reinterpret_cast<const y12i_pixel*>(source),
-            [](const y12i_pixel & p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
-            [](const y12i_pixel & p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+        split_y12i( dest, source, count );
     }
 
     y12i_to_y16y16::y12i_to_y16y16(int left_idx, int right_idx)
@@ -3,6 +3,7 @@
 
 #include "y16i-10msb-to-y16y16.h"
 #include "stream.h"
+#include "interleaved-unpack.h"
 // CUDA TODO
 //#ifdef RS2_USE_CUDA
 //#include "cuda/cuda-conversion.cuh"
@@ -27,9 +28,7 @@ namespace librealsense
 //#ifdef RS2_USE_CUDA
 //        rscuda::split_frame_y16_16_from_y16i_10msb_cuda(dest, count, reinterpret_cast<const y16i_pixel*>(source));
 //#else
-        split_frame(dest, count, reinterpret_cast<const y16i_pixel*>(source),
-            [](const y16i_pixel& p) -> uint16_t { return (p.l()); },
-            [](const y16i_pixel& p) -> uint16_t { return (p.r()); });
+        split_y16i_10msb( dest, source, count );
 //#endif
     }
 
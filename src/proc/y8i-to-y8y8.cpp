@@ -5,6 +5,7 @@
 
 #include <src/stream.h>
 #include <src/image.h>
+#include "interleaved-unpack.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -24,9 +25,7 @@ namespace librealsense
             return;
         }
 #endif
-        split_frame(dest, count, reinterpret_cast<const y8i_pixel*>(source),
-            [](const y8i_pixel & p) -> uint8_t { return p.l; },
-            [](const y8i_pixel & p) -> uint8_t { return p.r; });
+        split_y8i( dest, source, count );
     }
 
     y8i_to_y8y8::y8i_to_y8y8(int left_idx, int right_idx) :
@@ -29,6 +29,7 @@
 #include "proc/units-transform.h"
 #include "proc/disparity-transform.h"
 #include "proc/syncer-processing-block.h"
+#include "proc/multi-device-syncer.h"
 #include "proc/decimation-filter.h"
 #include "proc/rotation-filter.h"
 #include "proc/spatial-filter.h"
@@ -46,6 +47,7 @@
 #include "proc/temporal-filter.h"
 #include "software-device.h"
 #include "software-device-info.h"
+#include "device-batch-open.h"
 #include "software-sensor.h"
 #include "global_timestamp_reader.h"
 #include "auto-calibrated-device.h"
@@ -63,6 +65,7 @@
 
 #include <src/core/time-service.h>
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
 
 ////////////////////////
 // API implementation //
@@ -380,10 +383,47 @@ rs2_device* rs2_create_device(const rs2_device_list* info_list, int index, rs2_e
     VALIDATE_NOT_NULL(info_list);
     VALIDATE_RANGE(index, 0, (int)info_list->list.size() - 1);
 
-    return new rs2_device{ info_list->list[index]->create_device() };
+    return new rs2_device{ create_device_with_phases( info_list->list[index] ) };
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, info_list, index)
 
+int rs2_create_devices(const rs2_device_list* info_list, rs2_device** devices, rs2_error** errors, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(info_list);
+    VALIDATE_NOT_NULL(devices);
+
+    size_t max_threads = 0;
+    if( ! info_list->list.empty() )
+        info_list->list.front()->get_context()->get_settings().nested( "device-open-threads" ).get_ex( max_threads );
+
+    auto results = create_devices( info_list->list, max_threads );
+    int n_created = 0;
+    for( size_t i = 0; i < results.size(); ++i )
+    {
+        devices[i] = nullptr;
+        if( errors )
+            errors[i] = nullptr;
+        if( results[i].device )
+        {
+            devices[i] = new rs2_device{ results[i].device };
+            ++n_created;
+        }
+        else if( errors )
+        {
+            try
+            {
+                std::rethrow_exception( results[i].exception );
+            }
+            catch( ... )
+            {
+                translate_exception( "rs2_create_devices", rsutils::string::from() << "device " << i, &errors[i] );
+            }
+        }
+    }
+    return n_created;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, info_list, devices, errors)
+
 void rs2_delete_device(rs2_device* device) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -399,6 +439,17 @@ int rs2_device_is_connected( const rs2_device * device, rs2_error ** error ) BEG
 }
 HANDLE_EXCEPTIONS_AND_RETURN( 0, device )
 
+const rs2_raw_data_buffer* rs2_get_device_statistics(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    rsutils::json j = rsutils::json::object();
+    if( auto dev = std::dynamic_pointer_cast< librealsense::device >( device->device ) )
+        j = dev->get_statistics();
+    auto str = j.dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
+
 rs2_sensor* rs2_create_sensor(const rs2_sensor_list* list, int index, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(list);
@@ -442,6 +493,14 @@ rs2_stream_profile_list* rs2_get_active_streams(rs2_sensor* sensor, rs2_error**
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
 
+const rs2_raw_data_buffer* rs2_get_sensor_statistics(const rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    auto str = sensor->sensor->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, sensor)
+
 const rs2_stream_profile* rs2_get_stream_profile(const rs2_stream_profile_list* list, int index, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(list);
@@ -822,6 +881,13 @@ void rs2_delete_option_value( rs2_option_value const * p_value ) BEGIN_API_CALL
 }
 NOEXCEPT_RETURN( , p_value )
 
+// Let the sensor's options-changed callback know right away, rather than at its next update
+static void notify_option_set( rs2_options const * options, rs2_option option_id )
+{
+    if( auto sensor = dynamic_cast< sensor_base * >( options->options ) )
+        sensor->notify_option_set( option_id );
+}
+
 void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(options);
@@ -866,6 +932,7 @@ void rs2_set_option(const rs2_options* options, rs2_option option, float value,
         }
         throw not_implemented_exception("use rs2_set_option_value to set string values");
     }
+    notify_option_set( options, option );
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, options, option, value)
 
@@ -877,6 +944,7 @@ void rs2_set_option_value( rs2_options const * options, rs2_option_value const *
     if( ! option_value->is_valid )
     {
         option.set_value( rsutils::null_json );
+        notify_option_set( options, option_value->id );
         return;
     }
     rs2_option_type const option_type = option.get_value_type();
@@ -914,6 +982,7 @@ void rs2_set_option_value( rs2_options const * options, rs2_option_value const *
     default:
         throw not_implemented_exception( "unexpected option type " + get_string( option_type ) );
     }
+    notify_option_set( options, option_value->id );
 }
 HANDLE_EXCEPTIONS_AND_RETURN( , options, option_value )
 
@@ -1300,6 +1369,14 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+int rs2_get_all_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_entry* entries, int capacity, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(entries);
+    return ((frame_interface*)frame)->find_all_metadata( entries, capacity );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, entries, capacity)
+
 const char* rs2_get_notification_description(rs2_notification* notification, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(notification);
@@ -1787,6 +1864,50 @@ void rs2_enable_rolling_log_file( unsigned max_size, rs2_error ** error ) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, max_size)
 
+void rs2_enable_async_logging( unsigned queue_size, rs2_error ** error ) BEGIN_API_CALL
+{
+    librealsense::enable_async_logging( queue_size );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, queue_size)
+
+unsigned long long rs2_get_log_drop_count( rs2_error ** error ) BEGIN_API_CALL
+{
+    return librealsense::get_log_drop_count();
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN( 0 )
+
+void rs2_set_api_trace_sampling( const char * function_name, unsigned every_nth, rs2_error ** error ) BEGIN_API_CALL
+{
+#ifdef TRACE_API
+    librealsense::api_trace::instance().set_sampling( function_name, every_nth );
+#else
+    throw not_implemented_exception( "librealsense was built without TRACE_API" );
+#endif
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, function_name, every_nth)
+
+void rs2_dump_api_trace( const char * file_path, rs2_error ** error ) BEGIN_API_CALL
+{
+#ifdef TRACE_API
+    if( file_path )
+    {
+        std::ofstream file( file_path );
+        if( ! file )
+            throw invalid_value_exception( rsutils::string::from() << "failed to open " << file_path );
+        librealsense::api_trace::instance().dump( file );
+    }
+    else
+    {
+        std::ostringstream ss;
+        librealsense::api_trace::instance().dump( ss );
+        LOG_INFO( "API trace:\n" << ss.str() );
+    }
+#else
+    throw not_implemented_exception( "librealsense was built without TRACE_API" );
+#endif
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, file_path)
+
 // librealsense wrapper around a C function
 class on_log_callback : public rs2_log_callback
 {
@@ -2387,6 +2508,14 @@ rs2_pipeline_profile* rs2_pipeline_get_active_profile(rs2_pipeline* pipe, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
 
+const rs2_raw_data_buffer* rs2_pipeline_get_statistics(rs2_pipeline* pipe, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+    auto str = pipe->pipeline->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
+
 rs2_device* rs2_pipeline_profile_get_device(rs2_pipeline_profile* profile, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(profile);
@@ -2607,6 +2736,14 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::multi_device_syncer>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2651,6 +2788,14 @@ void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error*
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, frame)
 
+const rs2_raw_data_buffer* rs2_get_processing_block_statistics(const rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto str = block->block->get_statistics().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, block)
+
 void rs2_delete_processing_block(rs2_processing_block* block) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -152,13 +152,13 @@ void log_callback_end( uint32_t fps,
 
     void sensor_base::register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const
     {
-        if (_metadata_parsers.get()->end() != _metadata_parsers.get()->find(metadata))
+        if (_metadata_parsers->contains(metadata))
         {
             std::string metadata_type_str(rs2_frame_metadata_to_string(metadata));
             std::string metadata_found_str = "Metadata attribute parser for " + metadata_type_str + " was previously defined";
             LOG_DEBUG(metadata_found_str.c_str());
         }
-        _metadata_parsers.get()->insert(std::pair<rs2_frame_metadata_value, std::shared_ptr<md_attribute_parser_base>>(metadata, metadata_parser));
+        _metadata_parsers->insert(metadata, metadata_parser);
     }
 
     std::shared_ptr<std::map<uint32_t, rs2_format>>& raw_sensor_base::get_fourcc_to_rs2_format_map()
@@ -279,6 +279,11 @@ void log_callback_end( uint32_t fps,
         return *_owner;
     }
 
+    rsutils::json sensor_base::get_statistics() const
+    {
+        return _source.get_statistics();
+    }
+
     // TODO - make this method more efficient, using parralel computation, with SSE or CUDA, when available
     std::vector<uint8_t> sensor_base::align_width_to_64(int width, int height, int bpp, uint8_t * pix) const
     {
@@ -415,12 +420,7 @@ void log_callback_end( uint32_t fps,
         , _raw_sensor( raw_sensor )
         , _options_watcher( _raw_sensor )
     {
-        rsutils::json const & settings = device->get_context()->get_settings();
-        if( auto interval_j = settings.nested( std::string( "options-update-interval", 23 ) ) )
-        {
-            auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
-            _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
-        }
+        _options_watcher.configure( device->get_context()->get_settings() );  // NOTE: can throw!
 
         // synthetic sensor and its raw sensor will share the formats and streams mapping
         auto& raw_fourcc_to_rs2_format_map = _raw_sensor->get_fourcc_to_rs2_format_map();
@@ -451,7 +451,7 @@ void log_callback_end( uint32_t fps,
     {
         _raw_sensor->register_option( id, option );
         sensor_base::register_option( id, option );
-        _options_watcher.register_option( id, option );
+        _options_watcher.register_option( id, option, get_option_name( id ) );
     }
 
     // Used in dynamic discovery of supported controls in generic UVC devices
@@ -663,6 +663,26 @@ void log_callback_end( uint32_t fps,
         _raw_sensor->stop();
     }
 
+    rsutils::json synthetic_sensor::get_statistics() const
+    {
+        // Frames come from the raw sensor, go through the converters (each with its own output), then to the user
+        rsutils::json j = rsutils::json::object();
+        j["backend"] = _raw_sensor->get_statistics();
+        rsutils::json converters = rsutils::json::array();
+        {
+            std::lock_guard< std::mutex > lock( _synthetic_configure_lock );
+            for( auto & converter : _formats_converter.get_active_converters() )
+            {
+                auto stats = converter->get_statistics();
+                stats["name"] = converter->get_info( RS2_CAMERA_INFO_NAME );
+                converters.push_back( std::move( stats ) );
+            }
+        }
+        j["converters"] = std::move( converters );
+        j["callback"] = _formats_converter.get_callback_latency().to_json();
+        return j;
+    }
+
     float librealsense::synthetic_sensor::get_preset_max_value() const
     {
         // to be overriden by depth sensors which need this api
@@ -742,7 +762,12 @@ void log_callback_end( uint32_t fps,
 
     void synthetic_sensor::register_option_to_update( rs2_option id, std::shared_ptr< option > option )
     {
-        _options_watcher.register_option( id, option );
+        _options_watcher.register_option( id, option, get_option_name( id ) );
+    }
+
+    void synthetic_sensor::notify_option_set( rs2_option id )
+    {
+        _options_watcher.notify_set( id );
     }
 
     void synthetic_sensor::unregister_option_from_update( rs2_option id )
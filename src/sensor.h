@@ -115,6 +115,12 @@ namespace librealsense
             throw not_implemented_exception( "Registering options value changed callback is not implemented for this sensor" );
         }
 
+        // Called after an option was set through the API, so any options-changed callback can pick up the change
+        // right away rather than at the next update
+        virtual void notify_option_set( rs2_option ) {}
+
+        rsutils::json get_statistics() const override;
+
     protected:
         // Since _profiles is private, we need a way to get the final profiles
         stream_profiles const & initialized_profiles() const { return *_profiles; }
@@ -257,17 +263,20 @@ namespace librealsense
         bool is_opened() const override;
 
         rsutils::subscription register_options_changed_callback( options_watcher::callback && cb ) override;
+        void notify_option_set( rs2_option ) override;
         virtual void register_option_to_update( rs2_option id, std::shared_ptr< option > option );
         virtual void unregister_option_from_update( rs2_option id );
 
         void prepare_for_bulk_operation() override { _raw_sensor->prepare_for_bulk_operation(); }
         void finished_bulk_operation() override { _raw_sensor->finished_bulk_operation(); }
 
+        rsutils::json get_statistics() const override;
+
     private:
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
 
-        std::mutex _synthetic_configure_lock;
+        mutable std::mutex _synthetic_configure_lock;
 
         rs2_frame_callback_sptr _post_process_callback;
         std::shared_ptr<raw_sensor_base> _raw_sensor;
@@ -41,7 +41,7 @@ static std::shared_ptr< metadata_parser_map > create_software_metadata_parser_ma
             fallback = std::make_shared< ds_md_attribute_actual_fps >();
             break;
         }
-        md_parser_map->emplace( key, std::make_shared< md_array_parser >( key, fallback ) );
+        md_parser_map->insert( key, std::make_shared< md_array_parser >( key, fallback ) );
     }
     return md_parser_map;
 }
@@ -8,6 +8,8 @@
 #include <src/core/enum-helpers.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
+#include <chrono>
 #include <src/core/stream-profile-interface.h>
 
 namespace librealsense
@@ -50,6 +52,7 @@ namespace librealsense
     frame_source::frame_source( uint32_t max_publish_list_size )
         : _callback( nullptr, []( rs2_frame_callback * ) {} )
         , _max_publish_list_size( max_publish_list_size )
+        , _statistics( std::make_shared< frame_source_statistics >() )
     {}
 
     void frame_source::init(std::shared_ptr<metadata_parser_map> metadata_parsers)
@@ -77,7 +80,7 @@ namespace librealsense
         if( it == _supported_extensions.end() )
             throw wrong_api_call_sequence_exception( "Requested frame type is not supported!" );
 
-        auto ret = _archive.insert( { id, make_archive( ex, &_max_publish_list_size, _metadata_parsers ) } );
+        auto ret = _archive.insert( { id, make_archive( ex, &_max_publish_list_size, _metadata_parsers, _statistics ) } );
         if( ! ret.second || ! ret.first->second ) // Check insertion success and allocation success
             throw std::runtime_error( rsutils::string::from() << "Failed to create archive of type " << get_string( ex ) );
 
@@ -162,7 +165,10 @@ namespace librealsense
                 {
                     frame_interface* ref = nullptr;
                     std::swap(frame.frame, ref);
+                    auto const start = std::chrono::steady_clock::now();
                     _callback->on_frame((rs2_frame*)ref);
+                    _statistics->callback.record( std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                                      std::chrono::steady_clock::now() - start ).count() );
                 }
             }
             catch( const std::exception & e )
@@ -187,7 +193,21 @@ namespace librealsense
         }
     }
 
-        rs2_extension frame_source::stream_to_frame_types( rs2_stream stream )
+    rsutils::json frame_source::get_statistics() const
+    {
+        auto j = _statistics->to_json();
+        uint32_t in_flight = 0;
+        {
+            std::lock_guard< std::recursive_mutex > lock( _mutex );
+            for( auto & kvp : _archive )
+                if( kvp.second )
+                    in_flight += kvp.second->get_published_count();
+        }
+        j["frames-in-flight"] = in_flight;
+        return j;
+    }
+
+    rs2_extension frame_source::stream_to_frame_types( rs2_stream stream )
     {
         // TODO: explicitly return video_frame for relevant streams and default to an error?
         switch( stream )
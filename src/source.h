@@ -6,6 +6,7 @@
 
 #include <librealsense2/hpp/rs_types.hpp>
 #include <src/frame-archive.h>
+#include <src/pipeline-statistics.h>
 
 #include <tuple>
 
@@ -60,13 +61,17 @@ namespace librealsense
             // We use a special index for extensions since we don't know the stream type here.
             // We can't wait with the allocation because we need the type T in the creation.
             archive_id special_index = { RS2_STREAM_COUNT, 0, ex };
-            _archive[special_index] = std::make_shared< frame_archive< T > >( &_max_publish_list_size, _metadata_parsers );
+            _archive[special_index]
+                = std::make_shared< frame_archive< T > >( &_max_publish_list_size, _metadata_parsers, _statistics );
         }
 
         void set_max_publish_list_size( int qsize ) { _max_publish_list_size = qsize; }
 
         static rs2_extension stream_to_frame_types( rs2_stream stream );
 
+        // What was produced since construction, plus the frames currently held ("frames-in-flight"), as JSON
+        rsutils::json get_statistics() const;
+
     private:
         friend class syncer_process_unit;
 
@@ -81,5 +86,6 @@ namespace librealsense
         rs2_frame_callback_sptr _callback;
         std::shared_ptr< metadata_parser_map > _metadata_parsers;
         std::weak_ptr< sensor_interface > _sensor;
+        std::shared_ptr< frame_source_statistics > _statistics;  // shared with the archives, which may outlive us
     };
 }
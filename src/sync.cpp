@@ -9,14 +9,27 @@
 #include "core/sensor-interface.h"
 #include "composite-frame.h"
 #include "core/time-service.h"
+#include "pipeline-trace.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
+
+#include <set>
 
 
 namespace librealsense
 {
     const int MAX_GAP = 1000;
 
+    rsutils::json syncer_statistics::to_json() const
+    {
+        rsutils::json j = rsutils::json::object();
+        j["framesets-released"] = framesets_released.load();
+        j["framesets-partial"] = framesets_partial.load();
+        j["wait"] = wait.to_json();
+        return j;
+    }
+
 #define LOG_IF_ENABLE( OSTREAM, ENV ) \
     while( ENV.log ) \
     { \
@@ -151,10 +164,10 @@ namespace librealsense
 
     composite_matcher::matcher_queue::matcher_queue()
         : q( QUEUE_MAX_SIZE,
-             []( frame_holder const & fh )
+             []( queued_frame const & qf )
              {
                  // If queues are overrun, we'll get here
-                 LOG_DEBUG( "DROPPED frame " << fh );
+                 LOG_DEBUG( "DROPPED frame " << qf.frame );
              } )
     {
     }
@@ -296,6 +309,22 @@ namespace librealsense
             m.second->stop();
     }
 
+    void composite_matcher::check_deadline( const syncronization_environment & env )
+    {
+        // Children first: whatever they release gets queued with us. A child may handle more than one stream, and
+        // may add matchers as it releases, so we work on a copy.
+        std::vector< std::shared_ptr< matcher > > children;
+        std::set< matcher * > seen;
+        for( auto const & m : _matchers )
+            if( m.second && seen.insert( m.second.get() ).second )
+                children.push_back( m.second );
+        for( auto const & child : children )
+            child->check_deadline( env );
+
+        if( _has_last_arrived )
+            release_matches( _last_arrived_header, env );
+    }
+
     std::string
     composite_matcher::frames_to_string( std::vector< frame_holder * > const & frames )
     {
@@ -313,8 +342,8 @@ namespace librealsense
         for( auto m : matchers )
         {
             auto const & q = _frames_queue[m].q;
-            q.peek( [&os]( frame_holder const & fh ) {
-                os << fh;
+            q.peek( [&os]( queued_frame const & qf ) {
+                os << qf.frame;
                 } );
         }
         os << ']';
@@ -336,16 +365,26 @@ namespace librealsense
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].q.enqueue( std::move( f ) ) )
+        // Frames are matched by address when they're released, below
+        pipeline_trace::begin_async( "syncer wait", uint64_t( uintptr_t( f.frame ) ), last_arrived.frame_number );
+        if( ! _frames_queue[matcher.get()].q.enqueue( { std::move( f ), std::chrono::steady_clock::now() } ) )
             // If we get stopped, nothing to do!
             return;
 
+        _last_arrived_header = last_arrived;
+        _has_last_arrived = true;
+        release_matches( last_arrived, env );
+    }
+
+    void composite_matcher::release_matches( frame_header const & last_arrived, const syncronization_environment & env )
+    {
         // We have a queue for each known stream we want to sync.
         // E.g., for (Depth Color), we need to sync two frames, one from each.
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
         std::vector< frame_holder * > frames_arrived;
+        std::vector< std::chrono::steady_clock::time_point > frames_arrived_times;
         std::vector< librealsense::matcher * > frames_arrived_matchers;
         std::vector< int > synced_frames;
         std::vector< int > unsynced_frames;
@@ -356,6 +395,8 @@ namespace librealsense
             missing_streams.clear();
             frames_arrived_matchers.clear();
             frames_arrived.clear();
+            frames_arrived_times.clear();
+            bool partial = false;
 
             std::vector< frame_holder > match;
             {
@@ -367,9 +408,10 @@ namespace librealsense
                 for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
                 {
                     librealsense::matcher * const m = s->first;
-                    if( ! s->second.q.peek( [&]( frame_holder & fh ) {
-                            LOG_IF_ENABLE( "... have " << *fh.frame, env );
-                            frames_arrived.push_back( &fh );
+                    if( ! s->second.q.peek( [&]( queued_frame & qf ) {
+                            LOG_IF_ENABLE( "... have " << *qf.frame.frame, env );
+                            frames_arrived.push_back( &qf.frame );
+                            frames_arrived_times.push_back( qf.arrived );
                             frames_arrived_matchers.push_back( m );
                         } ) )
                     {
@@ -412,6 +454,15 @@ namespace librealsense
                     }
                 }
                 bool release_synced_frames = ( synced_frames.size() != 0 );
+
+                // The frameset started waiting when its first frame arrived
+                auto const now = std::chrono::steady_clock::now();
+                auto first_arrived = now;
+                for( auto i : synced_frames )
+                    first_arrived = std::min( first_arrived, frames_arrived_times[i] );
+                bool const deadline_passed = env.deadline_ms > 0
+                    && now - first_arrived >= std::chrono::duration< double, std::milli >( env.deadline_ms );
+
                 if( unsynced_frames.empty() )
                 {
                     // Everything (could be only one!) matches together... but if we also have
@@ -427,6 +478,13 @@ namespace librealsense
                             LOG_IF_ENABLE( "...     cannot be synced; not waiting for it", env );
                             continue;
                         }
+                        if( deadline_passed )
+                        {
+                            // Better late and partial than complete and later still
+                            LOG_IF_ENABLE( "...     deadline passed; not waiting for it", env );
+                            partial = true;
+                            continue;
+                        }
 
                         LOG_IF_ENABLE( "...     waiting for it", env );
                         release_synced_frames = false;
@@ -446,12 +504,26 @@ namespace librealsense
 
                 for( auto index : synced_frames )
                 {
-                    frame_holder frame;
+                    queued_frame queued;
                     int const timeout_ms = 5000;
                     librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].q.dequeue( &frame, timeout_ms );
+                    _frames_queue[m].q.dequeue( &queued, timeout_ms );
+                    frame_holder frame = std::move( queued.frame );
+                    if( frame )
+                        pipeline_trace::end_async( "syncer wait",
+                                                   uint64_t( uintptr_t( frame.frame ) ),
+                                                   frame->get_frame_number() );
                     match.push_back( std::move( frame ) );
                 }
+
+                if( env.statistics )
+                {
+                    ++env.statistics->framesets_released;
+                    if( partial )
+                        ++env.statistics->framesets_partial;
+                    env.statistics->wait.record(
+                        std::chrono::duration_cast< std::chrono::nanoseconds >( now - first_arrived ).count() );
+                }
             }
 
             // The frameset should always be with the same order of streams (the first stream carries extra
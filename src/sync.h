@@ -4,6 +4,8 @@
 
 #include "callback-invocation.h"
 #include "core/frame-holder.h"
+#include "core/frame-header.h"
+#include "pipeline-statistics.h"
 
 #include <librealsense2/h/rs_sensor.h>
 #include <rsutils/concurrency/concurrency.h>
@@ -12,6 +14,7 @@
 #include <mutex>
 #include <memory>
 #include <map>
+#include <chrono>
 
 
 namespace librealsense {
@@ -19,19 +22,37 @@ namespace librealsense {
 
     class synthetic_source_interface;
 
+    // What the syncer does with the frames it waits on
+    //
+    struct syncer_statistics
+    {
+        std::atomic< uint64_t > framesets_released{ 0 };
+        std::atomic< uint64_t > framesets_partial{ 0 };  // released without some stream because their deadline passed
+        latency_histogram wait;  // from the arrival of the frameset's first frame, until the frameset is released
+
+        rsutils::json to_json() const;
+    };
+
     struct syncronization_environment
     {
         syncronization_environment( synthetic_source_interface * source,
                                     single_consumer_frame_queue< frame_holder >& matches,
-                                    bool log )
+                                    bool log,
+                                    double deadline_ms = 0,
+                                    syncer_statistics * statistics = nullptr )
             : source( source )
             , matches( matches )
             , log( log )
+            , deadline_ms( deadline_ms )
+            , statistics( statistics )
         {
         }
         synthetic_source_interface * source;
         single_consumer_frame_queue< frame_holder > & matches;
         bool log = true;
+        // When positive, a frameset is not held for missing streams longer than this since its first frame arrived
+        double deadline_ms = 0;
+        syncer_statistics * statistics = nullptr;
     };
 
     typedef int stream_id;
@@ -66,6 +87,9 @@ namespace librealsense {
         void set_active(const bool active);
         virtual void stop() override {}
 
+        // Release whatever waited past the deadline in env, even though no new frame arrived
+        virtual void check_deadline( const syncronization_environment & env ) {}
+
     protected:
        std::vector<stream_id> _streams_id;
        std::vector<rs2_stream> _streams_type;
@@ -104,6 +128,7 @@ namespace librealsense {
         void sync(frame_holder f, const syncronization_environment& env) override;
         std::shared_ptr<matcher> find_matcher(const frame_holder& f);
         virtual void stop() override;
+        void check_deadline( const syncronization_environment & env ) override;
 
         static std::string frames_to_string( std::vector< frame_holder* > const& );
         std::string matchers_to_string( std::vector< matcher* > const& );
@@ -113,9 +138,20 @@ namespace librealsense {
                                            const frame_holder & f )
             = 0;
 
+        // Release all the framesets that are ready, given the frame that last arrived
+        void release_matches( frame_header const & last_arrived, const syncronization_environment & env );
+
+        struct queued_frame
+        {
+            frame_holder frame;
+            std::chrono::steady_clock::time_point arrived;  // to this matcher
+
+            frame_interface * operator->() const { return frame.frame; }
+        };
+
         struct matcher_queue
         {
-            single_consumer_frame_queue< frame_holder > q;
+            single_consumer_frame_queue< queued_frame > q;
 
             matcher_queue();
         };
@@ -130,6 +166,9 @@ namespace librealsense {
         };
         std::map< matcher *, next_expected_t > _next_expected;
 
+        bool _has_last_arrived = false;
+        frame_header _last_arrived_header;  // of the latest frame to arrive, for check_deadline()
+
         std::mutex _mutex;
     };
 
@@ -462,6 +462,9 @@ std::string const & get_string_( rs2_option value )
         CASE( GYRO_SENSITIVITY )
         CASE( ROTATION )
         arr[RS2_OPTION_REGION_OF_INTEREST] = "Region of Interest";
+        CASE( OUTPUT_DISTANCE )
+        CASE( SYNC_TOLERANCE )
+        CASE( SYNC_DEADLINE )
 #undef CASE
         return arr;
     }();
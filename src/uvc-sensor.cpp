@@ -12,6 +12,7 @@
 #include "platform/stream-profile-impl.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
+#include <src/pipeline-trace.h>
 
 
 namespace librealsense {
@@ -35,6 +36,7 @@ uvc_sensor::uvc_sensor( std::string const & name,
     , _timestamp_reader( std::move( timestamp_reader ) )
     , _gyro_counter(0)
     , _accel_counter(0)
+    , _n_frame_waiters( 0 )
 {
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
@@ -126,6 +128,7 @@ void uvc_sensor::open( const stream_profiles & requests )
                     std::function< void() > continuation ) mutable
                 {
                     const auto system_time = time_service::get_time();  // time frame was received from the backend
+                    pipeline_trace_span backend_span( "backend frame" );
 
                     if( ! this->is_streaming() )
                     {
@@ -136,6 +139,16 @@ void uvc_sensor::open( const stream_profiles & requests )
                         return;
                     }
 
+                    if( _n_frame_waiters )
+                    {
+                        {
+                            std::lock_guard< std::mutex > lock( _frame_arrival_mutex );
+                            ++_n_frames_arrived;
+                        }
+                        _frame_arrived.notify_all();
+                    }
+
+                    pipeline_trace_span metadata_span( "metadata parse" );
                     auto && fr = generate_frame_from_data( f,
                                                                  system_time,
                                                                  _timestamp_reader.get(),
@@ -143,6 +156,8 @@ void uvc_sensor::open( const stream_profiles & requests )
                                                                  last_frame_number,
                                                                  req_profile_base );
                     auto timestamp_domain = _timestamp_reader->get_frame_timestamp_domain( fr );
+                    metadata_span.set_frame_number( fr->additional_data.frame_number );
+                    metadata_span.end();
                     auto bpp = get_image_bpp( req_profile_base->get_format() );
                     auto & frame_counter = fr->additional_data.frame_number;
                     auto & timestamp = fr->additional_data.timestamp;
@@ -196,6 +211,8 @@ void uvc_sensor::open( const stream_profiles & requests )
                     if( val_in_range( req_profile_base->get_format(), { RS2_FORMAT_MJPEG } ) )
                         expected_size = static_cast< int >( f.frame_size );
 
+                    backend_span.set_frame_number( fr->additional_data.frame_number );
+                    pipeline_trace_span copy_span( "frame copy", fr->additional_data.frame_number );
                     auto extension = frame_source::stream_to_frame_types( req_profile_base->get_stream_type() );
                     frame_holder fh = _source.alloc_frame(
                         { req_profile_base->get_stream_type(), req_profile_base->get_stream_index(), extension },
@@ -248,6 +265,7 @@ void uvc_sensor::open( const stream_profiles & requests )
                     // calling the continuation method, and releasing the backend frame buffer
                     // since the content of the OS frame buffer has been copied, it can released ASAP
                     continuation();
+                    copy_span.end();
 
                     if (!fh.frame)
                     {
@@ -360,6 +378,17 @@ void uvc_sensor::register_pu( rs2_option id )
 }
 
 
+bool uvc_sensor::wait_for_next_frame( std::chrono::milliseconds timeout )
+{
+    ++_n_frame_waiters;
+    std::unique_lock< std::mutex > lock( _frame_arrival_mutex );
+    auto const n_arrived = _n_frames_arrived;
+    bool const arrived
+        = _frame_arrived.wait_for( lock, timeout, [&]() { return _n_frames_arrived != n_arrived; } );
+    --_n_frame_waiters;
+    return arrived;
+}
+
 void uvc_sensor::prepare_for_bulk_operation()
 {
     acquire_power();
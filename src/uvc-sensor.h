@@ -5,6 +5,7 @@
 
 #include "sensor.h"
 #include "platform/uvc-device.h"
+#include <condition_variable>
 
 
 namespace librealsense {
@@ -57,6 +58,10 @@ public:
         release_power_thread.detach();
     }
 
+    // Blocks until the next frame arrives from the backend; false on timeout. Lets device writes be timed so they
+    // fall between frames.
+    bool wait_for_next_frame( std::chrono::milliseconds timeout );
+
 protected:
     stream_profiles init_stream_profiles() override;
     void verify_supported_requests( const stream_profiles & requests ) const;
@@ -68,6 +73,12 @@ private:
     std::atomic<int64_t> _gyro_counter;
     std::atomic<int64_t> _accel_counter;
 
+    // Frames are only counted while someone is waiting for one
+    std::mutex _frame_arrival_mutex;
+    std::condition_variable _frame_arrived;
+    uint64_t _n_frames_arrived = 0;
+    std::atomic< int > _n_frame_waiters;
+
 
     struct power
     {
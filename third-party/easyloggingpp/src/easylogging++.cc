@@ -2209,6 +2209,11 @@ namespace base {
 // DefaultLogDispatchCallback
 
 void DefaultLogDispatchCallback::handle(const LogDispatchData* data) {
+  // Nothing to write (e.g., output is left to another callback): don't bother building the line
+  if (data->dispatchAction() == base::DispatchAction::NormalLog
+      && !data->logMessage()->logger()->m_typedConfigurations->toFile(data->logMessage()->level())
+      && !data->logMessage()->logger()->m_typedConfigurations->toStandardOutput(data->logMessage()->level()))
+    return;
 #if defined(ELPP_THREAD_SAFE)
   LogDispatchCallback::handle(data);
   base::threading::ScopedLock scopedLock(fileHandle(data));
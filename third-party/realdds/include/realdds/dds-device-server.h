@@ -35,6 +35,7 @@ class dds_participant;
 class dds_publisher;
 class dds_subscriber;
 class dds_stream_server;
+class dds_stream_pacer;
 class dds_notification_server;
 class dds_topic_reader;
 class dds_topic_writer;
@@ -123,6 +124,7 @@ private:
     std::map< std::string, std::shared_ptr< dds_stream_server > > _stream_name_to_server;
     dds_options _options;
     std::shared_ptr< dds_notification_server > _notification_server;
+    std::shared_ptr< dds_stream_pacer > _pacer;
     std::shared_ptr< dds_topic_reader > _control_reader;
     std::shared_ptr< dds_topic_writer > _metadata_writer;
     std::shared_ptr< dds_device_broadcaster > _broadcaster;
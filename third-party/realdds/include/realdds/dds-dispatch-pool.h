@@ -0,0 +1,100 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+namespace realdds {
+
+
+// A set of worker threads, shared by many topic readers, to which sample handling can be offloaded.
+//
+// Reader threads only need to take the samples out of the DDS reader and post them here: the heavy work (decoding,
+// metadata syncing, frame construction and user callbacks) is then done by the workers so that the readers, and
+// therefore the middleware, do not fall behind.
+//
+// Work is posted to a 'strand', usually one per topic: work items in the same strand are executed in the order they
+// were posted and never concurrently, while different strands are executed in parallel.
+//
+// Strands only hold a weak reference to their pool: a strand that outlives it (e.g., the participant was destroyed
+// first) is simply closed and accepts no more work.
+//
+class dds_dispatch_pool : public std::enable_shared_from_this< dds_dispatch_pool >
+{
+public:
+    typedef std::function< void() > work_item;
+
+    // Per-strand counters; these can be read at any time from any thread
+    struct counters
+    {
+        std::atomic< size_t > backlog{ 0 };       // items currently waiting
+        std::atomic< size_t > max_backlog{ 0 };   // highest backlog seen
+        std::atomic< uint64_t > n_dispatched{ 0 };
+        std::atomic< uint64_t > n_dropped{ 0 };   // overflowed the strand (the oldest item is dropped)
+    };
+
+    class strand : public std::enable_shared_from_this< strand >
+    {
+        friend class dds_dispatch_pool;
+
+        std::weak_ptr< dds_dispatch_pool > const _pool;
+        size_t const _max_backlog;
+        std::deque< work_item > _items;
+        bool _scheduled = false;  // in the pool's ready queue, or being executed
+        bool _closed = false;
+        std::thread::id _executing_thread;
+        counters _counters;
+
+    public:
+        strand( std::weak_ptr< dds_dispatch_pool > const & pool, size_t max_backlog )
+            : _pool( pool )
+            , _max_backlog( max_backlog )
+        {
+        }
+
+        counters const & get_counters() const { return _counters; }
+
+        // Queue an item for execution; returns false if the strand is closed
+        bool post( work_item && item )
+        {
+            auto pool = _pool.lock();
+            return pool && pool->post( shared_from_this(), std::move( item ) );
+        }
+
+        // Discard anything pending and wait for any currently-executing item to finish. No more items will be accepted.
+        void close();
+    };
+
+    // Must be owned by a shared_ptr (strands refer back to it)
+    dds_dispatch_pool( size_t n_threads );
+    ~dds_dispatch_pool();
+
+    size_t size() const { return _workers.size(); }
+
+    // Returns a new strand; 'max_backlog' items can be pending before the oldest are dropped
+    std::shared_ptr< strand > create_strand( size_t max_backlog );
+
+    // Queue an item for execution; returns false if the strand is closed
+    bool post( std::shared_ptr< strand > const &, work_item && );
+
+private:
+    void worker_loop();
+
+    std::vector< std::thread > _workers;
+    std::deque< std::shared_ptr< strand > > _ready;
+    std::mutex _mutex;
+    std::condition_variable _work_cv;     // signaled when strands become ready
+    std::condition_variable _strand_cv;   // signaled when a strand finishes executing an item
+    bool _stopping = false;
+};
+
+
+}  // namespace realdds
@@ -3,10 +3,15 @@
 #pragma once
 
 #include <rsutils/json.h>
+#include <rsutils/concurrency/spsc-ring.h>
 
 #include <deque>
+#include <array>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
 #include <functional>
 #include <atomic>
 
@@ -15,16 +20,21 @@ namespace realdds {
 
 
 // Frame data and metadata are sent as two seperate streams which may need synchronizing and joining together.
-// 
+//
 // This mechanism takes a generic "frame" (as a void*) and "metadata" (any json) and issues a callback whenever a match
 // occurs.
-// 
-// Note this means:
+//
+// By default, matching is done inline. This means:
 //     - the callback is only called when a frame/metadata is fed to it (enqueued)
 //     - callbacks are called on the same thread as the enqueue
 //     - frames may be issued without metadata if none is found
 //     - metadata by itself is never issued
 //
+// With a maximum wait (see set_max_wait()), matching is pipelined instead:
+//     - enqueues only push into lock-free queues and never block or call callbacks
+//     - a matcher thread does the matching and calls the callbacks
+//     - a frame will not wait longer than the maximum for its metadata: it is then issued without it
+//
 // A few assumptions are made:
 //     - metadata and frames arrive from different threads, so can happen concurrently
 //     - frames are enqueued in strictly increasing order (keys) from the same thread
@@ -62,10 +72,43 @@ public:
     // And we provide other callbacks, for control, testing, etc.
     typedef std::function< void( key_type, metadata_type const & ) > on_metadata_dropped_callback;
 
+    typedef std::chrono::steady_clock clock;
+
+    // How long frames waited for their metadata, from enqueue until issued, is kept as a histogram with these upper
+    // bounds (the last bucket is for anything longer)
+    static constexpr size_t n_wait_buckets = 8;
+    static const std::array< std::chrono::microseconds, n_wait_buckets - 1 > wait_bucket_limits;
+
+    struct statistics
+    {
+        uint64_t n_frames = 0;           // issued
+        uint64_t n_matched = 0;          // issued with metadata
+        uint64_t n_timed_out = 0;        // issued without metadata because the maximum wait was reached
+        uint64_t n_frames_dropped = 0;   // never issued because the matcher could not keep up
+        uint64_t n_metadata_dropped = 0;
+        std::array< uint64_t, n_wait_buckets > wait_histogram{};
+
+        double match_rate() const { return n_frames ? double( n_matched ) / n_frames : 0.; }
+        rsutils::json to_json() const;
+    };
+
 private:
-    using key_frame = std::pair< key_type, frame_holder >;
+    struct key_frame
+    {
+        key_type key;
+        frame_holder frame;
+        clock::time_point arrival;
+    };
     using key_metadata = std::pair< key_type, metadata_type >;
 
+    // What gets pushed into the lock-free queues in pipelined mode; frame_holder is not default-constructible
+    struct incoming_frame
+    {
+        key_type key = 0;
+        frame_type * frame = nullptr;
+        clock::time_point arrival;
+    };
+
     std::deque< key_frame > _frame_queue;
     std::deque< key_metadata > _metadata_queue;
     std::mutex _queues_lock;
@@ -76,6 +119,20 @@ private:
 
     std::shared_ptr< bool > _is_alive; // Ensures object can be accessed
 
+    statistics _stats;  // under _queues_lock
+
+    // Pipelined mode:
+    clock::duration _max_wait{ 0 };
+    std::unique_ptr< rsutils::concurrency::spsc_ring< incoming_frame > > _incoming_frames;
+    std::unique_ptr< rsutils::concurrency::spsc_ring< key_metadata > > _incoming_metadata;
+    key_type _min_incoming_frame_key = 0;  // producer-side ordering checks
+    key_type _min_incoming_metadata_key = 0;
+    std::thread _matcher;
+    std::mutex _wake_mutex;
+    std::condition_variable _wake_cv;
+    std::atomic< bool > _matcher_sleeping;
+    std::atomic< bool > _matcher_stopping;
+
 public:
     dds_metadata_syncer();
     virtual ~dds_metadata_syncer();
@@ -87,6 +144,14 @@ public:
     void on_frame_ready( on_frame_ready_callback cb ) { _on_frame_ready = cb; }
     void on_metadata_dropped( on_metadata_dropped_callback cb ) { _on_metadata_dropped = cb; }
 
+    // Switch to pipelined mode if non-zero; back to inline mode if zero. Must be called while stopped.
+    void set_max_wait( clock::duration );
+    clock::duration get_max_wait() const { return _max_wait; }
+    bool is_pipelined() const { return _max_wait.count() > 0; }
+
+    statistics get_statistics();
+    void reset_statistics();
+
     // Helper to create frame_holder
     template< class Frame >
     inline frame_holder hold( Frame * frame ) const
@@ -94,15 +159,23 @@ public:
         return frame_holder( frame, _on_frame_release );
     }
 
-    void start() { _started = true; }
-    void stop() { _started = false; }
+    void start();
+    void stop();
 
 private:
     // Call these under lock:
     void search_for_match( std::unique_lock< std::mutex > & );
     bool handle_match( std::unique_lock< std::mutex > & );
-    bool handle_frame_without_metadata( std::unique_lock< std::mutex > & );
+    bool handle_frame_without_metadata( std::unique_lock< std::mutex > &, bool timed_out = false );
     bool drop_metadata( std::unique_lock< std::mutex > & );
+    void update_wait_stats( key_frame const &, bool matched, bool timed_out );
+
+    // Pipelined mode:
+    void wake_matcher();
+    void matcher_loop( std::weak_ptr< bool > alive );
+    bool drain_incoming( std::unique_lock< std::mutex > & );
+    void stop_matcher();
+    void release_incoming();
 
     std::atomic< bool > _started;
 };
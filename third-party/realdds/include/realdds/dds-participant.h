@@ -12,6 +12,7 @@
 #include <string>
 #include <list>
 #include <atomic>
+#include <mutex>
 
 
 namespace eprosima {
@@ -46,6 +47,7 @@ namespace realdds {
 
 
 class dds_network_adapter_watcher;
+class dds_dispatch_pool;
 
 
 // The starting point for any DDS interaction, a participant has a name and is the focal point for creating, destroying,
@@ -63,6 +65,8 @@ class dds_participant
 
     rsutils::json _settings;
     std::shared_ptr< dds_network_adapter_watcher > _adapter_watcher;
+    std::shared_ptr< dds_dispatch_pool > _dispatch_pool;
+    std::mutex _dispatch_pool_mutex;
 
 public:
     dds_participant() = default;
@@ -135,6 +139,12 @@ public:
     //
     std::shared_ptr< const eprosima::fastdds::rtps::FlowControllerDescriptor > find_flow_controller( char const * name ) const;
 
+    // Stream readers can offload sample handling to a pool of worker threads shared by all the participant's streams.
+    // The pool is created on first use, with "device/dispatch/threads" from the settings; if that's missing or 0,
+    // dispatching is disabled and nullptr is returned.
+    //
+    std::shared_ptr< dds_dispatch_pool > dispatch_pool();
+
     // Utility to create a custom GUID, to help
     //
     dds_guid create_guid();
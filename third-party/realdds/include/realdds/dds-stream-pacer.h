@@ -0,0 +1,126 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <rsutils/json-fwd.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+
+namespace realdds {
+
+
+class dds_participant;
+class dds_stream_server;
+
+
+// By default, stream servers write each frame synchronously, on whatever thread called publish_image(). When several
+// streams share a congested link, a big color frame will then delay the depth frame that comes right after it.
+//
+// The pacer takes over the actual writing for a set of streams and does it from a single sender thread:
+//     - Each stream has a priority: the pending frame of the most important stream (lowest number) is always sent
+//       first
+//     - Each stream has a deadline: a frame that has been pending longer than its deadline is dropped rather than
+//       sent late
+//     - Only a limited number of frames may be pending per stream; older ones are dropped when new ones arrive
+//     - When a stream writer uses a flow-controller, we wait until the previous frame on that controller is
+//       (approximately) sent before choosing the next one, so it's our priorities that decide what goes out next and
+//       not the DDS FIFO send queue
+//
+// Statistics are kept per stream and are periodically reported via a callback.
+//
+class dds_stream_pacer
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    struct stream_settings
+    {
+        int priority = 0;                      // lower is more important
+        std::chrono::nanoseconds deadline{ 0 };  // zero for no deadline
+        size_t max_pending = 1;
+    };
+
+    struct stream_stats
+    {
+        uint64_t n_sent = 0;
+        uint64_t n_dropped = 0;
+
+        // Send latency (from enqueue() until the write returns) for the current statistics period only:
+        std::chrono::nanoseconds total_latency{ 0 };
+        std::chrono::nanoseconds max_latency{ 0 };
+        uint64_t n_latencies = 0;
+    };
+
+    typedef std::function< void() > write_callback;
+    typedef std::function< void( rsutils::json && ) > stats_callback;
+
+    // Settings are taken from the participant's "device/pacing" object, which looks like this (all optional):
+    //     {
+    //         "stats-period": 5.0,                                            // seconds; 0 to disable
+    //         "depth": { "priority": 0, "deadline": 0.1, "max-pending": 1 },  // per stream type
+    //         "color": { "priority": 2 },
+    //         ...
+    //     }
+    //
+    dds_stream_pacer( std::shared_ptr< dds_participant > const & );
+    ~dds_stream_pacer();
+
+    // Streams must be open when added; the returned index is then used to enqueue()
+    size_t add_stream( dds_stream_server const & );
+
+    // Called from the sender thread every statistics period, with a JSON object of stream-name to statistics
+    void on_stats( stats_callback callback ) { _on_stats = std::move( callback ); }
+
+    // Queue a write of 'n_bytes' for the stream, to be performed on the sender thread
+    void enqueue( size_t stream_index, size_t n_bytes, write_callback && );
+
+    // Returns an object of stream-name to statistics; resets the latency statistics
+    rsutils::json get_stats();
+
+private:
+    struct pending_write
+    {
+        write_callback write;
+        size_t n_bytes;
+        clock::time_point enqueued;
+    };
+
+    struct stream_state
+    {
+        std::string name;
+        stream_settings settings;
+        double bytes_per_second = 0;  // from the flow-controller; 0 if there's none
+        std::string flow_controller;
+        std::deque< pending_write > pending;
+        stream_stats stats;
+    };
+
+    void sender_loop();
+    void drop_stale( clock::time_point now );
+    rsutils::json stats_to_json();
+
+    std::vector< stream_state > _streams;
+    std::map< std::string, clock::time_point > _flow_controller_busy_until;
+    std::chrono::nanoseconds _stats_period;
+    clock::time_point _next_stats;
+    stats_callback _on_stats;
+    std::shared_ptr< dds_participant > _participant;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping = false;
+    std::thread _sender;
+};
+
+
+}  // namespace realdds
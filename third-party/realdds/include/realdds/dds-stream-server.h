@@ -24,6 +24,7 @@ class dds_topic;
 class dds_topic_writer;
 class dds_publisher;
 class dds_stream_profile;
+class dds_stream_pacer;
 
 
 struct image_header
@@ -51,12 +52,17 @@ public:
 
     bool is_open() const override { return !! _writer; }
     virtual void open( std::string const & topic_name, std::shared_ptr< dds_publisher > const & ) = 0;
-    void close();
+    virtual void close();
 
     bool is_streaming() const override { return _streaming; }
     virtual void stop_streaming();
 
     std::shared_ptr< dds_topic > const & get_topic() const override;
+    std::shared_ptr< dds_topic_writer > const & get_writer() const { return _writer; }
+
+    // By default, samples are written directly from the publishing thread. With a pacer, the pacer's thread does it
+    // instead, according to stream priorities and deadlines. Must be called after open().
+    void set_pacer( std::shared_ptr< dds_stream_pacer > const & );
 
     // We don't know how to actually stream -- someone else calls publish_image. So we provide an easy callback
     // to let our owner know if streaming needs to start or end based on the number of readers we are matched to:
@@ -66,6 +72,8 @@ public:
 
 protected:
     std::shared_ptr< dds_topic_writer > _writer;
+    std::shared_ptr< dds_stream_pacer > _pacer;
+    size_t _pacer_index = 0;
     readers_changed_callback _on_readers_changed;
     bool _streaming = false;
 
@@ -92,7 +100,8 @@ public:
     void stop_streaming() override;
     image_header const & get_image_header() const { return _image_header; }
 
-    virtual void publish_image( topics::image_msg & );
+    // The image is consumed: with a pacer, its data is only written later, from the pacer's thread
+    virtual void publish_image( topics::image_msg && );
 
 private:
     void check_profile( std::shared_ptr< dds_stream_profile > const & ) const override;
@@ -163,8 +172,15 @@ public:
     const motion_intrinsics & get_gyro_intrinsics() const { return _gyro_intrinsics; }
 
     void start_streaming();
+    void stop_streaming() override;
+    void close() override;
     virtual void publish_motion( topics::imu_msg && );
 
+    // When the participant's device/motion/batch settings allow more than one sample per batch, samples are not
+    // written to the stream topic but packed together and written to a separate BATCH_TOPIC_SUFFIX topic. A batch is
+    // written when full, when its first sample is max-latency old, or when streaming stops.
+    bool is_batching() const { return !! _batch; }
+
     char const * type_string() const override { return "motion"; }
 
 private:
@@ -172,6 +188,11 @@ private:
 
     motion_intrinsics _accel_intrinsics;
     motion_intrinsics _gyro_intrinsics;
+
+    struct batch;
+    std::shared_ptr< batch > _batch;
+
+    void write_batch( batch & );
 };
 
 
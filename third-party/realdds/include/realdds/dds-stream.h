@@ -5,6 +5,7 @@
 
 #include "dds-stream-base.h"
 #include "dds-trinsics.h"
+#include "dds-dispatch-pool.h"
 
 #include <string>
 #include <vector>
@@ -50,11 +51,24 @@ public:
 
     std::shared_ptr< dds_topic > const & get_topic() const override;
 
+    // When the participant has a dispatch pool, samples are only taken on the reader thread and are then handed to
+    // the pool for handling (in order). Returns the backlog counters for this stream, or nullptr if not dispatching.
+    dds_dispatch_pool::counters const * get_dispatch_counters() const
+    {
+        return _strand ? &_strand->get_counters() : nullptr;
+    }
+
 protected:
     virtual void handle_data() = 0;
     virtual bool can_start_streaming() const = 0;
 
+    // Called from open(), once the reader is created
+    void init_dispatch( std::shared_ptr< dds_subscriber > const & );
+    // Calls the function on the pool if dispatching, or immediately if not
+    void dispatch( dds_dispatch_pool::work_item && );
+
     std::shared_ptr< dds_topic_reader_thread > _reader;
+    std::shared_ptr< dds_dispatch_pool::strand > _strand;
     bool _streaming = false;
 };
 
@@ -64,6 +78,7 @@ class dds_video_stream : public dds_stream
 
 public:
     dds_video_stream( std::string const & stream_name, std::string const & sensor_name );
+    ~dds_video_stream();
 
     void open( std::string const & topic_name, std::shared_ptr< dds_subscriber > const & ) override;
 
@@ -127,14 +142,25 @@ class dds_motion_stream : public dds_stream
 
 public:
     dds_motion_stream( std::string const & stream_name, std::string const & sensor_name );
+    ~dds_motion_stream();
 
     char const * type_string() const override { return "motion"; }
 
     void open( std::string const & topic_name, std::shared_ptr< dds_subscriber > const & ) override;
 
+    void close() override;
+
     typedef std::function< void( topics::imu_msg &&, dds_sample && ) > on_data_available_callback;
     void on_data_available( on_data_available_callback cb ) { _on_data_available = cb; }
 
+    // The server may batch samples (see dds_motion_stream_server::is_batching()), in which case its stream-header says
+    // so and the device calls enable_batching() before open(); only then is the batch topic read. By default, batches
+    // are unpacked and each sample is handed to on_data_available, but they can be received as-is instead:
+    void enable_batching() { _batched = true; }
+    bool is_batched() const { return _batched; }
+    typedef std::function< void( std::vector< topics::imu_msg > &&, dds_sample && ) > on_batch_available_callback;
+    void on_batch_available( on_batch_available_callback cb ) { _on_batch_available = cb; }
+
     void set_accel_intrinsics( const motion_intrinsics & intrinsics ) { _accel_intrinsics = intrinsics; }
     void set_gyro_intrinsics( const motion_intrinsics & intrinsics ) { _gyro_intrinsics = intrinsics; }
     const motion_intrinsics & get_accel_intrinsics() const { return _accel_intrinsics; }
@@ -142,11 +168,16 @@ public:
 
 protected:
     void handle_data() override;
+    void handle_batch();
+    void on_batch( std::vector< topics::imu_msg > &&, dds_sample && );
     bool can_start_streaming() const override { return _on_data_available != nullptr; }
 
     motion_intrinsics _accel_intrinsics;
     motion_intrinsics _gyro_intrinsics;
     on_data_available_callback _on_data_available = nullptr;
+    on_batch_available_callback _on_batch_available = nullptr;
+    std::shared_ptr< dds_topic_reader_thread > _batch_reader;  // only if batched
+    bool _batched = false;
 };
 
 
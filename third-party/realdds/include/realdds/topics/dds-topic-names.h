@@ -24,6 +24,8 @@ constexpr char const * NOTIFICATION_TOPIC_NAME = "/notification";
 constexpr char const * CONTROL_TOPIC_NAME = "/control";
 constexpr char const * METADATA_TOPIC_NAME = "/metadata";
 constexpr char const * DFU_TOPIC_NAME = "/dfu";
+// Concatenated to a motion stream topic, when samples are batched (see imu_msg::pack)
+constexpr char const * BATCH_TOPIC_SUFFIX = "/batch";
 
 
 namespace ros2 {
@@ -75,6 +77,7 @@ namespace notification {
             extern std::string const profiles;
             extern std::string const default_profile_index;
             extern std::string const metadata_enabled;
+            extern std::string const batched;
         }
     }
     namespace stream_options {
@@ -131,6 +134,14 @@ namespace notification {
             using namespace stream_options::intrinsics;
         }
     }
+    namespace stream_stats {
+        extern std::string const id;
+        namespace key {
+            extern std::string const sent;
+            extern std::string const dropped;
+            extern std::string const latency;
+        }
+    }
 }
 
 namespace control {
@@ -88,6 +88,12 @@ public:
 
     void write_to( dds_topic_writer & );
 
+    // Several samples can be packed into a single blob (see blob_msg) and sent together, for a much lower packet rate
+    // on constrained networks. Only the timestamp and accel/gyro data are kept.
+    static void pack( std::vector< imu_msg > const &, std::vector< uint8_t > & output );
+    // Throws if the data is not a valid pack
+    static std::vector< imu_msg > unpack( std::vector< uint8_t > const & );
+
     std::string to_string() const;
 };
 
@@ -18,6 +18,7 @@
 #include <realdds/dds-device-broadcaster.h>
 #include <realdds/dds-device-server.h>
 #include <realdds/dds-stream-server.h>
+#include <realdds/dds-stream-pacer.h>
 #include <realdds/dds-stream-profile.h>
 #include <realdds/dds-device-watcher.h>
 #include <realdds/dds-device.h>
@@ -978,6 +979,7 @@ PYBIND11_MODULE(NAME, m) {
     stream_server_base  //
         .def( "on_readers_changed", &dds_stream_server::on_readers_changed )
         .def( "open", &dds_stream_server::open )
+        .def( "set_pacer", &dds_stream_server::set_pacer )
         .def( "stop_streaming", &dds_stream_server::stop_streaming )
         .def( "__repr__",
               []( dds_stream_server const & self )
@@ -999,7 +1001,13 @@ PYBIND11_MODULE(NAME, m) {
               []( dds_video_stream_server & self, dds_video_encoding encoding, int width, int height ) {
                   self.start_streaming( { encoding, height, width } );
               } )
-        .def( "publish_image", &dds_video_stream_server::publish_image );
+        .def( "publish_image",
+              // Python keeps its image, so the server gets a copy
+              []( dds_video_stream_server & self, realdds::topics::image_msg const & image )
+              {
+                  auto raw = image.raw();
+                  self.publish_image( realdds::topics::image_msg( std::move( raw ) ) );
+              } );
 
     using realdds::dds_depth_stream_server;
     py::class_< dds_depth_stream_server, std::shared_ptr< dds_depth_stream_server > >( m, "depth_stream_server", video_stream_server_base )
@@ -1024,6 +1032,18 @@ PYBIND11_MODULE(NAME, m) {
         .def( "set_accel_intrinsics", &dds_motion_stream_server::set_accel_intrinsics )
         .def( "start_streaming", &dds_motion_stream_server::start_streaming );
 
+    using realdds::dds_stream_pacer;
+    py::class_< dds_stream_pacer, std::shared_ptr< dds_stream_pacer > >( m, "stream_pacer" )
+        .def( py::init< std::shared_ptr< dds_participant > const & >() )
+        // The GIL must not be held while waiting for the pacer: its thread may need it to call (or free) a callback
+        .def( "add_stream", &dds_stream_pacer::add_stream, py::call_guard< py::gil_scoped_release >() )
+        .def(
+            "enqueue",
+            []( dds_stream_pacer & self, size_t stream_index, size_t n_bytes, dds_stream_pacer::write_callback write )
+            { self.enqueue( stream_index, n_bytes, std::move( write ) ); },
+            py::call_guard< py::gil_scoped_release >() )
+        .def( "get_stats", &dds_stream_pacer::get_stats, py::call_guard< py::gil_scoped_release >() );
+
     // To have the python code be able to modify json objects in callbacks, we need to somehow refer to the original
     // json object as changes to translated dict will not automatically get picked up!
     // We do this thru the [] operator:
@@ -1073,6 +1093,19 @@ PYBIND11_MODULE(NAME, m) {
         .def( "is_open", &dds_stream::is_open )
         .def( "start_streaming", &dds_stream::start_streaming )
         .def( "stop_streaming", &dds_stream::stop_streaming )
+        .def( "dispatch_counters",
+              []( dds_stream const & self ) -> py::object
+              {
+                  auto counters = self.get_dispatch_counters();
+                  if( ! counters )
+                      return py::none();
+                  py::dict d;
+                  d["backlog"] = counters->backlog.load();
+                  d["max-backlog"] = counters->max_backlog.load();
+                  d["dispatched"] = counters->n_dispatched.load();
+                  d["dropped"] = counters->n_dropped.load();
+                  return std::move( d );
+              } )
         .def( "__repr__", []( dds_stream const & self ) {
             std::ostringstream os;
             os << "<" SNAME "." << self.type_string() << "_stream \"" << self.name() << "\"";
@@ -1307,8 +1340,17 @@ PYBIND11_MODULE(NAME, m) {
         }
 
         ~dds_metadata_syncer()
+        {
+            // A pipelined syncer may be waiting on the GIL in a callback right now, and stop() waits for it
+            py::gil_scoped_release gil;
+            stop();
+        }
+
+        void set_max_wait( double seconds )
         {
             stop();
+            super::set_max_wait( std::chrono::duration_cast< clock::duration >( std::chrono::duration< double >( seconds ) ) );
+            start();
         }
 
         void enqueue_frame( key_type key, frame_type const & img )
@@ -1339,7 +1381,11 @@ PYBIND11_MODULE(NAME, m) {
         .def( "enqueue_frame", &dds_metadata_syncer::enqueue_frame )
         .def( "enqueue_metadata",
               []( dds_metadata_syncer & self, dds_metadata_syncer::key_type key, json const & j )
-              { self.enqueue_metadata( key, std::make_shared< const json >( j ) ); } );
+              { self.enqueue_metadata( key, std::make_shared< const json >( j ) ); } )
+        .def( "set_max_wait", &dds_metadata_syncer::set_max_wait, py::call_guard< py::gil_scoped_release >() )
+        .def( "is_pipelined", &dds_metadata_syncer::is_pipelined )
+        .def( "get_statistics", []( dds_metadata_syncer & self ) { return self.get_statistics().to_json(); } )
+        .def( "reset_statistics", &dds_metadata_syncer::reset_statistics );
     metadata_syncer.attr( "max_frame_queue_size" ) = dds_metadata_syncer::max_frame_queue_size;
     metadata_syncer.attr( "max_md_queue_size" ) = dds_metadata_syncer::max_md_queue_size;
 }
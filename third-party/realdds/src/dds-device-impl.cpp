@@ -668,6 +668,12 @@ void dds_device::impl::on_stream_header( json const & j, dds_sample const & samp
         stream->enable_metadata();  // Call before init_profiles
     }
 
+    if( j.nested( topics::notification::stream_header::key::batched ).default_value( false ) )
+    {
+        if( auto motion_stream = std::dynamic_pointer_cast< dds_motion_stream >( stream ) )
+            motion_stream->enable_batching();  // Call before open
+    }
+
     if( default_profile_index < profiles.size() )
         stream->init_profiles( profiles, default_profile_index );
     else
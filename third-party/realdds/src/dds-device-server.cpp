@@ -7,6 +7,7 @@
 #include <realdds/dds-publisher.h>
 #include <realdds/dds-subscriber.h>
 #include <realdds/dds-stream-server.h>
+#include <realdds/dds-stream-pacer.h>
 #include <realdds/dds-stream-profile.h>
 #include <realdds/dds-notification-server.h>
 #include <realdds/dds-topic-reader.h>
@@ -66,6 +67,7 @@ rsutils::string::slice dds_device_server::debug_name() const
 
 dds_device_server::~dds_device_server()
 {
+    _pacer.reset();
     _stream_name_to_server.clear();
     LOG_DEBUG( "[" << debug_name() << "] device server deleted" );
 }
@@ -115,6 +117,10 @@ static void on_discovery_stream_header( std::shared_ptr< dds_stream_server > con
         { topics::notification::stream_header::key::default_profile_index, stream->default_profile_index() },
         { topics::notification::stream_header::key::metadata_enabled, stream->metadata_enabled() },
     };
+    // Only present when on, so clients that do not know about batching see no difference
+    auto motion_server = std::dynamic_pointer_cast< dds_motion_stream_server >( stream );
+    if( motion_server && motion_server->is_batching() )
+        j_stream_header[topics::notification::stream_header::key::batched] = true;
     topics::flexible_msg stream_header_message( j_stream_header );
     LOG_DEBUG( stream->name() << " stream-header " << std::setw( 4 ) << j_stream_header << " size "
                               << stream_header_message._data.size() );
@@ -225,6 +231,25 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
             }
         }
 
+        // Optional pacing of stream writes, see dds_stream_pacer
+        auto const pacing_settings = participant()->settings().nested( "device", "pacing" );
+        if( pacing_settings.is_object() && pacing_settings.nested( "enabled" ).default_value( true ) )
+        {
+            _pacer = std::make_shared< dds_stream_pacer >( participant() );
+            std::weak_ptr< dds_notification_server > weak_notifications( _notification_server );
+            _pacer->on_stats(
+                [weak_notifications]( json && stats )
+                {
+                    auto notifications = weak_notifications.lock();
+                    if( ! notifications )
+                        return;
+                    stats[topics::notification::key::id] = topics::notification::stream_stats::id;
+                    notifications->send_notification( topics::flexible_msg( stats ) );
+                } );
+            for( auto & stream : streams )
+                stream->set_pacer( _pacer );
+        }
+
         _notification_server->run();
 
         // Create a control reader and set callback
@@ -241,6 +266,7 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
     }
     catch( std::exception const & )
     {
+        _pacer.reset();
         _notification_server.reset();
         _stream_name_to_server.clear();
         _control_reader.reset();
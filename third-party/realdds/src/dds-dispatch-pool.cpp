@@ -0,0 +1,152 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/dds-dispatch-pool.h>
+#include <realdds/dds-utilities.h>
+
+
+namespace realdds {
+
+
+dds_dispatch_pool::dds_dispatch_pool( size_t n_threads )
+{
+    if( ! n_threads )
+        DDS_THROW( runtime_error, "dispatch pool must have at least one thread" );
+
+    _workers.reserve( n_threads );
+    for( size_t i = 0; i < n_threads; ++i )
+        _workers.emplace_back( [this]() { worker_loop(); } );
+}
+
+
+dds_dispatch_pool::~dds_dispatch_pool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _work_cv.notify_all();
+    for( auto & worker : _workers )
+        if( worker.joinable() )
+            worker.join();
+}
+
+
+std::shared_ptr< dds_dispatch_pool::strand > dds_dispatch_pool::create_strand( size_t max_backlog )
+{
+    if( ! max_backlog )
+        DDS_THROW( runtime_error, "strand backlog must be at least 1" );
+    return std::make_shared< strand >( shared_from_this(), max_backlog );
+}
+
+
+bool dds_dispatch_pool::post( std::shared_ptr< strand > const & s, work_item && item )
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( s->_closed || _stopping )
+            return false;
+
+        if( s->_items.size() >= s->_max_backlog )
+        {
+            s->_items.pop_front();
+            ++s->_counters.n_dropped;
+        }
+        s->_items.push_back( std::move( item ) );
+
+        auto const backlog = s->_items.size();
+        s->_counters.backlog = backlog;
+        if( backlog > s->_counters.max_backlog )
+            s->_counters.max_backlog = backlog;
+
+        if( s->_scheduled )
+            return true;  // already in the ready queue, or being executed
+        s->_scheduled = true;
+        _ready.push_back( s );
+    }
+    _work_cv.notify_one();
+    return true;
+}
+
+
+void dds_dispatch_pool::worker_loop()
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( true )
+    {
+        _work_cv.wait( lock, [this]() { return _stopping || ! _ready.empty(); } );
+        if( _stopping )
+            break;
+
+        auto s = std::move( _ready.front() );
+        _ready.pop_front();
+        if( s->_items.empty() )
+        {
+            // Closed while waiting in the ready queue
+            s->_scheduled = false;
+            continue;
+        }
+
+        // We execute only one item before going back to the ready queue, so a busy strand cannot starve the others
+        auto item = std::move( s->_items.front() );
+        s->_items.pop_front();
+        s->_counters.backlog = s->_items.size();
+        s->_executing_thread = std::this_thread::get_id();
+
+        lock.unlock();
+        try
+        {
+            item();
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "exception in dispatched work item: " << e.what() );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "unknown exception in dispatched work item" );
+        }
+        item = nullptr;  // release any captured resources before the strand can be closed
+        lock.lock();
+
+        ++s->_counters.n_dispatched;
+        s->_executing_thread = std::thread::id();
+        if( s->_items.empty() || s->_closed )
+            s->_scheduled = false;
+        else
+        {
+            _ready.push_back( std::move( s ) );
+            _work_cv.notify_one();
+        }
+        _strand_cv.notify_all();
+    }
+}
+
+
+void dds_dispatch_pool::strand::close()
+{
+    auto pool = _pool.lock();
+    if( ! pool )
+    {
+        // The workers are gone: nothing can be executing, nor will anything pending ever be
+        _closed = true;
+        _counters.n_dropped += _items.size();
+        _items.clear();
+        _counters.backlog = 0;
+        return;
+    }
+
+    std::unique_lock< std::mutex > lock( pool->_mutex );
+    _closed = true;
+    _counters.n_dropped += _items.size();
+    _items.clear();
+    _counters.backlog = 0;
+
+    // If we're called from inside one of our own work items, we cannot wait for it to finish!
+    if( _executing_thread == std::this_thread::get_id() )
+        return;
+    pool->_strand_cv.wait( lock, [this]() { return _executing_thread == std::thread::id(); } );
+}
+
+
+}  // namespace realdds
@@ -4,6 +4,8 @@
 #include <realdds/dds-metadata-syncer.h>
 #include <realdds/dds-utilities.h>
 
+using rsutils::json;
+
 
 namespace realdds {
 
@@ -11,10 +13,41 @@ namespace realdds {
 const size_t dds_metadata_syncer::max_md_queue_size = 8;
 const size_t dds_metadata_syncer::max_frame_queue_size = 2;
 
+// In pipelined mode, the lock-free queues only need to hold whatever comes in while the matcher is busy
+static const size_t incoming_frames_capacity = 16;
+static const size_t incoming_metadata_capacity = 64;
+
+const std::array< std::chrono::microseconds, dds_metadata_syncer::n_wait_buckets - 1 >
+    dds_metadata_syncer::wait_bucket_limits = { std::chrono::microseconds( 100 ),  std::chrono::microseconds( 500 ),
+                                                std::chrono::microseconds( 1000 ), std::chrono::microseconds( 5000 ),
+                                                std::chrono::microseconds( 10000 ), std::chrono::microseconds( 50000 ),
+                                                std::chrono::microseconds( 100000 ) };
+
+
+json dds_metadata_syncer::statistics::to_json() const
+{
+    // Buckets are listed by their upper limit; the last one has none
+    json limits = json::array();
+    for( auto limit : wait_bucket_limits )
+        limits.push_back( limit.count() );
+    json wait = json::object( { { "limits-us", std::move( limits ) },
+                                { "counts", wait_histogram } } );
+    return json::object( { { "frames", n_frames },
+                           { "matched", n_matched },
+                           { "timed-out", n_timed_out },
+                           { "frames-dropped", n_frames_dropped },
+                           { "metadata-dropped", n_metadata_dropped },
+                           { "match-rate", match_rate() },
+                           { "wait", std::move( wait ) } } );
+}
+
 
 dds_metadata_syncer::dds_metadata_syncer()
-    : _is_alive( std::make_shared< bool >( true ) )
-    , _on_frame_release( nullptr )
+    : _on_frame_release( nullptr )
+    , _is_alive( std::make_shared< bool >( true ) )
+    , _matcher_sleeping( false )
+    , _matcher_stopping( false )
+    , _started( false )
 {
 }
 
@@ -22,6 +55,8 @@ dds_metadata_syncer::dds_metadata_syncer()
 dds_metadata_syncer::~dds_metadata_syncer()
 {
     _is_alive.reset();
+    stop_matcher();
+    release_incoming();
 
     std::lock_guard< std::mutex > lock( _queues_lock );
     _frame_queue.clear();
@@ -29,19 +64,67 @@ dds_metadata_syncer::~dds_metadata_syncer()
 }
 
 
+void dds_metadata_syncer::set_max_wait( clock::duration max_wait )
+{
+    if( _started )
+        DDS_THROW( runtime_error, "cannot change the metadata syncer mode while started" );
+    if( max_wait.count() < 0 )
+        max_wait = clock::duration( 0 );
+
+    _max_wait = max_wait;
+    if( is_pipelined() )
+    {
+        if( ! _incoming_frames )
+        {
+            _incoming_frames.reset( new rsutils::concurrency::spsc_ring< incoming_frame >( incoming_frames_capacity ) );
+            _incoming_metadata.reset( new rsutils::concurrency::spsc_ring< key_metadata >( incoming_metadata_capacity ) );
+        }
+    }
+    else
+    {
+        release_incoming();
+        _incoming_frames.reset();
+        _incoming_metadata.reset();
+    }
+}
+
+
 void dds_metadata_syncer::enqueue_frame( key_type id, frame_holder && frame )
 {
     std::weak_ptr< bool > alive = _is_alive;
     if( ! alive.lock() ) // Check if was destructed by another thread
         return;
 
+    if( is_pipelined() )
+    {
+        // Expect increasing order
+        if( id < _min_incoming_frame_key )
+            DDS_THROW( runtime_error, "frame " << id << " cannot be enqueued after " << _min_incoming_frame_key - 1 );
+        _min_incoming_frame_key = id + 1;
+
+        if( ! _started )
+            return;  // frame is released
+
+        incoming_frame incoming{ id, frame.get(), clock::now() };
+        if( ! _incoming_frames->try_push( std::move( incoming ) ) )
+        {
+            // The matcher is not keeping up; better to lose this frame than block the reader
+            std::lock_guard< std::mutex > lock( _queues_lock );
+            ++_stats.n_frames_dropped;
+            return;
+        }
+        frame.release();  // now owned by the ring
+        wake_matcher();
+        return;
+    }
+
     std::unique_lock< std::mutex > lock( _queues_lock );
     // Expect increasing order
-    if( ! _frame_queue.empty() && _frame_queue.back().first >= id )
-        DDS_THROW( runtime_error, "frame " << id << " cannot be enqueued after " << _frame_queue.back().first );
+    if( ! _frame_queue.empty() && _frame_queue.back().key >= id )
+        DDS_THROW( runtime_error, "frame " << id << " cannot be enqueued after " << _frame_queue.back().key );
 
     // We must push the new one before releasing the lock, else someone else may push theirs ahead of ours
-    _frame_queue.push_back( key_frame{ id, std::move( frame ) } );
+    _frame_queue.push_back( key_frame{ id, std::move( frame ), clock::now() } );
 
     while( _frame_queue.size() > max_frame_queue_size )
         if( ! handle_frame_without_metadata( lock ) ) // Lock released and aquired around callbacks, check we are alive
@@ -57,6 +140,26 @@ void dds_metadata_syncer::enqueue_metadata( key_type id, metadata_type const & m
     if( ! alive.lock() )  // Check if was destructed by another thread
         return;
 
+    if( is_pipelined() )
+    {
+        // Expect increasing order
+        if( id < _min_incoming_metadata_key )
+            DDS_THROW( runtime_error, "metadata " << id << " cannot be enqueued after " << _min_incoming_metadata_key - 1 );
+        _min_incoming_metadata_key = id + 1;
+
+        if( ! _started )
+            return;
+
+        if( ! _incoming_metadata->try_push( key_metadata{ id, md } ) )
+        {
+            std::lock_guard< std::mutex > lock( _queues_lock );
+            ++_stats.n_metadata_dropped;
+            return;
+        }
+        wake_matcher();
+        return;
+    }
+
     std::unique_lock< std::mutex > lock( _queues_lock );
     // Expect increasing order
     if( ! _metadata_queue.empty() && _metadata_queue.back().first >= id )
@@ -79,7 +182,7 @@ void dds_metadata_syncer::search_for_match( std::unique_lock< std::mutex > & loc
     while( ! _frame_queue.empty() && ! _metadata_queue.empty() )
     {
         // We're looking for metadata with the same ID as the next frame
-        auto const frame_key = _frame_queue.front().first;
+        auto const frame_key = _frame_queue.front().key;
         auto const md_key = _metadata_queue.front().first;
 
         if( frame_key < md_key )
@@ -103,11 +206,28 @@ void dds_metadata_syncer::search_for_match( std::unique_lock< std::mutex > & loc
 }
 
 
+void dds_metadata_syncer::update_wait_stats( key_frame const & kf, bool matched, bool timed_out )
+{
+    ++_stats.n_frames;
+    if( matched )
+        ++_stats.n_matched;
+    if( timed_out )
+        ++_stats.n_timed_out;
+
+    auto const waited = std::chrono::duration_cast< std::chrono::microseconds >( clock::now() - kf.arrival );
+    size_t bucket = 0;
+    while( bucket < wait_bucket_limits.size() && waited >= wait_bucket_limits[bucket] )
+        ++bucket;
+    ++_stats.wait_histogram[bucket];
+}
+
+
 bool dds_metadata_syncer::handle_match( std::unique_lock< std::mutex > & lock )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
-    frame_holder fh = std::move( _frame_queue.front().second );
+    update_wait_stats( _frame_queue.front(), true, false );
+    frame_holder fh = std::move( _frame_queue.front().frame );
     metadata_type md = std::move( _metadata_queue.front().second );
     _metadata_queue.pop_front();
     _frame_queue.pop_front();
@@ -125,11 +245,12 @@ bool dds_metadata_syncer::handle_match( std::unique_lock< std::mutex > & lock )
 }
 
 
-bool dds_metadata_syncer::handle_frame_without_metadata( std::unique_lock< std::mutex > & lock )
+bool dds_metadata_syncer::handle_frame_without_metadata( std::unique_lock< std::mutex > & lock, bool timed_out )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
-    frame_holder fh = std::move( _frame_queue.front().second );
+    update_wait_stats( _frame_queue.front(), false, timed_out );
+    frame_holder fh = std::move( _frame_queue.front().frame );
     _frame_queue.pop_front();
 
     if( _on_frame_ready && _started )
@@ -149,6 +270,7 @@ bool dds_metadata_syncer::drop_metadata( std::unique_lock< std::mutex > & lock )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
+    ++_stats.n_metadata_dropped;
     auto key = _metadata_queue.front().first;
     auto md = std::move( _metadata_queue.front().second );
     _metadata_queue.pop_front();  // Throw oldest
@@ -165,4 +287,153 @@ bool dds_metadata_syncer::drop_metadata( std::unique_lock< std::mutex > & lock )
 }
 
 
+dds_metadata_syncer::statistics dds_metadata_syncer::get_statistics()
+{
+    std::lock_guard< std::mutex > lock( _queues_lock );
+    return _stats;
+}
+
+
+void dds_metadata_syncer::reset_statistics()
+{
+    std::lock_guard< std::mutex > lock( _queues_lock );
+    _stats = statistics();
+}
+
+
+void dds_metadata_syncer::start()
+{
+    if( _started )
+        return;
+    if( is_pipelined() )
+    {
+        release_incoming();  // anything left over from the last time we were stopped
+        _min_incoming_frame_key = _min_incoming_metadata_key = 0;
+        _matcher_stopping = false;
+        _started = true;
+        _matcher = std::thread( [this, alive = std::weak_ptr< bool >( _is_alive )]() { matcher_loop( alive ); } );
+    }
+    else
+        _started = true;
+}
+
+
+void dds_metadata_syncer::stop()
+{
+    _started = false;
+    if( is_pipelined() )
+    {
+        stop_matcher();
+        release_incoming();
+    }
+}
+
+
+void dds_metadata_syncer::wake_matcher()
+{
+    // Pairs with the fence in matcher_loop(): either we see it's about to sleep, or it sees what we just pushed. The
+    // fence is needed because the ring's empty() only uses acquire loads, which alone would not order them
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if( _matcher_sleeping.load( std::memory_order_relaxed ) )
+    {
+        std::lock_guard< std::mutex > lock( _wake_mutex );
+        _wake_cv.notify_one();
+    }
+}
+
+
+bool dds_metadata_syncer::drain_incoming( std::unique_lock< std::mutex > & lock )
+{
+    key_metadata md;
+    while( _incoming_metadata->try_pop( md ) )
+    {
+        _metadata_queue.push_back( std::move( md ) );
+        while( _metadata_queue.size() > max_md_queue_size )
+            if( ! drop_metadata( lock ) )
+                return false;
+    }
+
+    // Frames are not limited by max_frame_queue_size: they stay until matched or until they've waited long enough
+    incoming_frame f;
+    while( _incoming_frames->try_pop( f ) )
+        _frame_queue.push_back( key_frame{ f.key, hold( f.frame ), f.arrival } );
+
+    return true;
+}
+
+
+void dds_metadata_syncer::matcher_loop( std::weak_ptr< bool > alive )
+{
+    while( ! _matcher_stopping )
+    {
+        clock::time_point wake_up = clock::time_point::max();
+        {
+            std::unique_lock< std::mutex > lock( _queues_lock );
+            if( ! drain_incoming( lock ) )
+                return;
+            search_for_match( lock );
+            if( ! alive.lock() )
+                return;
+
+            // Frames that waited long enough for their metadata are let go without it
+            auto const now = clock::now();
+            while( ! _frame_queue.empty() && now - _frame_queue.front().arrival >= _max_wait )
+                if( ! handle_frame_without_metadata( lock, true ) )
+                    return;
+            if( ! _frame_queue.empty() )
+                wake_up = _frame_queue.front().arrival + _max_wait;
+        }
+
+        std::unique_lock< std::mutex > lock( _wake_mutex );
+        _matcher_sleeping.store( true, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );  // see wake_matcher()
+        if( ! _matcher_stopping && _incoming_frames->empty() && _incoming_metadata->empty() )
+        {
+            if( wake_up == clock::time_point::max() )
+                _wake_cv.wait( lock );
+            else
+                _wake_cv.wait_until( lock, wake_up );
+        }
+        _matcher_sleeping = false;
+    }
+}
+
+
+void dds_metadata_syncer::stop_matcher()
+{
+    if( ! _matcher.joinable() )
+        return;
+    {
+        std::lock_guard< std::mutex > lock( _wake_mutex );
+        _matcher_stopping = true;
+        _wake_cv.notify_one();
+    }
+    if( _matcher.get_id() == std::this_thread::get_id() )
+        _matcher.detach();  // stopped from inside a callback; the loop will exit when it returns
+    else
+        _matcher.join();
+}
+
+
+void dds_metadata_syncer::release_incoming()
+{
+    // Only when the matcher is not running (we become the consumer)
+    if( _incoming_frames )
+    {
+        incoming_frame f;
+        while( _incoming_frames->try_pop( f ) )
+            hold( f.frame );  // released on destruction
+        key_metadata md;
+        while( _incoming_metadata->try_pop( md ) )
+            ;
+    }
+    if( is_pipelined() )
+    {
+        std::lock_guard< std::mutex > lock( _queues_lock );
+        _frame_queue.clear();
+        _metadata_queue.clear();
+    }
+}
+
+
 }  // namespace realdds
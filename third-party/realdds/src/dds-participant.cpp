@@ -7,6 +7,7 @@
 #include <realdds/dds-time.h>
 #include <realdds/dds-serialization.h>
 #include <realdds/dds-network-adapter-watcher.h>
+#include <realdds/dds-dispatch-pool.h>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipantListener.hpp>
@@ -280,6 +281,7 @@ void dds_participant::init( dds_domain_id domain_id, qos & pqos, rsutils::json c
 
 dds_participant::~dds_participant()
 {
+    _dispatch_pool.reset();  // stop the workers before anything they might be using is gone
     if( is_valid() )
     {
         if( _participant->has_active_entities() )
@@ -318,6 +320,22 @@ rsutils::string::slice dds_participant::name() const
 }
 
 
+std::shared_ptr< dds_dispatch_pool > dds_participant::dispatch_pool()
+{
+    std::lock_guard< std::mutex > lock( _dispatch_pool_mutex );
+    if( ! _dispatch_pool )
+    {
+        size_t const n_threads = _settings.nested( "device", "dispatch", "threads" ).default_value( size_t( 0 ) );
+        if( n_threads )
+        {
+            LOG_DEBUG( name() << ": dispatching stream samples with " << n_threads << " threads" );
+            _dispatch_pool = std::make_shared< dds_dispatch_pool >( n_threads );
+        }
+    }
+    return _dispatch_pool;
+}
+
+
 std::shared_ptr< const eprosima::fastdds::rtps::FlowControllerDescriptor >
 dds_participant::find_flow_controller( char const * name ) const
 {
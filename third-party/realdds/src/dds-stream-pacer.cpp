@@ -0,0 +1,286 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/dds-stream-pacer.h>
+#include <realdds/dds-stream-server.h>
+#include <realdds/dds-topic-writer.h>
+#include <realdds/dds-topic.h>
+#include <realdds/dds-participant.h>
+#include <realdds/dds-utilities.h>
+#include <realdds/topics/dds-topic-names.h>
+
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
+
+#include <rsutils/json.h>
+using rsutils::json;
+
+
+namespace realdds {
+
+
+static dds_stream_pacer::stream_settings default_stream_settings( std::string const & type_string )
+{
+    dds_stream_pacer::stream_settings settings;
+    settings.deadline = std::chrono::milliseconds( 100 );
+    if( type_string == "depth" )
+        settings.priority = 0;
+    else if( type_string == "motion" )
+    {
+        settings.priority = 0;
+        settings.max_pending = 32;  // high-rate and tiny: we don't want to replace pending samples
+    }
+    else if( type_string == "color" )
+        settings.priority = 2;
+    else
+        settings.priority = 1;
+    return settings;
+}
+
+
+dds_stream_pacer::dds_stream_pacer( std::shared_ptr< dds_participant > const & participant )
+    : _stats_period( 0 )
+    , _participant( participant )
+{
+    double stats_period_seconds = 5.;
+    _participant->settings().nested( "device", "pacing", "stats-period" ).get_ex( stats_period_seconds );
+    _stats_period = std::chrono::duration_cast< std::chrono::nanoseconds >(
+        std::chrono::duration< double >( stats_period_seconds ) );
+    _next_stats = clock::now() + _stats_period;
+
+    _sender = std::thread( [this]() { sender_loop(); } );
+}
+
+
+dds_stream_pacer::~dds_stream_pacer()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _cv.notify_all();
+    if( _sender.joinable() )
+        _sender.join();
+}
+
+
+size_t dds_stream_pacer::add_stream( dds_stream_server const & stream )
+{
+    if( ! stream.is_open() )
+        DDS_THROW( runtime_error, "stream '" + stream.name() + "' must be open to add to pacer" );
+
+    stream_state state;
+    state.name = stream.name();
+    state.settings = default_stream_settings( stream.type_string() );
+    if( auto j = _participant->settings().nested( "device", "pacing", stream.type_string() ) )
+    {
+        j.nested( "priority" ).get_ex( state.settings.priority );
+        double deadline_seconds;
+        if( j.nested( "deadline" ).get_ex( deadline_seconds ) )
+            state.settings.deadline = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                std::chrono::duration< double >( deadline_seconds ) );
+        j.nested( "max-pending" ).get_ex( state.settings.max_pending );
+        if( ! state.settings.max_pending )
+            DDS_THROW( runtime_error, "stream '" + state.name + "' max-pending must be at least 1" );
+    }
+
+    // If the writer is using a flow-controller, we need to know its throughput to avoid overflowing it
+    if( auto writer = stream.get_writer() )
+    {
+        if( auto controller_name = writer->get()->get_qos().publish_mode().flow_controller_name )
+        {
+            if( auto controller = _participant->find_flow_controller( controller_name ) )
+            {
+                if( controller->max_bytes_per_period > 0 && controller->period_ms > 0 )
+                {
+                    state.flow_controller = controller->name;
+                    state.bytes_per_second = 1. / estimate_seconds_to_send( 1, *controller );
+                }
+            }
+        }
+    }
+
+    LOG_DEBUG( "[pacer] '" << state.name << "' priority " << state.settings.priority << " deadline "
+                           << std::chrono::duration_cast< std::chrono::milliseconds >( state.settings.deadline ).count()
+                           << "ms max-pending " << state.settings.max_pending
+                           << ( state.flow_controller.empty() ? "" : " flow-controller '" ) << state.flow_controller
+                           << ( state.flow_controller.empty() ? "" : "'" ) );
+
+    std::lock_guard< std::mutex > lock( _mutex );
+    _streams.push_back( std::move( state ) );
+    return _streams.size() - 1;
+}
+
+
+void dds_stream_pacer::enqueue( size_t stream_index, size_t n_bytes, write_callback && write )
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( _stopping )
+            return;
+        auto & stream = _streams.at( stream_index );
+        while( stream.pending.size() >= stream.settings.max_pending )
+        {
+            // Newer is better: drop the oldest
+            stream.pending.pop_front();
+            ++stream.stats.n_dropped;
+        }
+        stream.pending.push_back( { std::move( write ), n_bytes, clock::now() } );
+    }
+    _cv.notify_one();
+}
+
+
+void dds_stream_pacer::drop_stale( clock::time_point const now )
+{
+    for( auto & stream : _streams )
+    {
+        if( stream.settings.deadline.count() <= 0 )
+            continue;
+        while( ! stream.pending.empty() && now - stream.pending.front().enqueued > stream.settings.deadline )
+        {
+            stream.pending.pop_front();
+            ++stream.stats.n_dropped;
+        }
+    }
+}
+
+
+void dds_stream_pacer::sender_loop()
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( ! _stopping )
+    {
+        auto now = clock::now();
+
+        if( _stats_period.count() > 0 && now >= _next_stats )
+        {
+            _next_stats = now + _stats_period;
+            if( _on_stats && ! _streams.empty() )
+            {
+                auto j = stats_to_json();
+                lock.unlock();
+                try
+                {
+                    _on_stats( std::move( j ) );
+                }
+                catch( std::exception const & e )
+                {
+                    LOG_ERROR( "[pacer] exception from stats callback: " << e.what() );
+                }
+                lock.lock();
+                continue;
+            }
+        }
+
+        drop_stale( now );
+
+        // Choose the most important stream with a pending frame, whose flow-controller (if any) is not busy. The
+        // oldest frame wins between streams of the same priority.
+        stream_state * next = nullptr;
+        clock::time_point wake_up = _stats_period.count() > 0 ? _next_stats : clock::time_point::max();
+        for( auto & stream : _streams )
+        {
+            if( stream.pending.empty() )
+                continue;
+            if( ! stream.flow_controller.empty() )
+            {
+                auto busy_until = _flow_controller_busy_until[stream.flow_controller];
+                if( busy_until > now )
+                {
+                    if( busy_until < wake_up )
+                        wake_up = busy_until;
+                    continue;
+                }
+            }
+            if( stream.settings.deadline.count() > 0 )
+            {
+                auto expires = stream.pending.front().enqueued + stream.settings.deadline;
+                if( expires < wake_up )
+                    wake_up = expires;
+            }
+            if( ! next || stream.settings.priority < next->settings.priority
+                || ( stream.settings.priority == next->settings.priority
+                     && stream.pending.front().enqueued < next->pending.front().enqueued ) )
+                next = &stream;
+        }
+
+        if( ! next )
+        {
+            if( wake_up == clock::time_point::max() )
+                _cv.wait( lock );
+            else
+                _cv.wait_until( lock, wake_up );
+            continue;
+        }
+
+        auto pending = std::move( next->pending.front() );
+        next->pending.pop_front();
+        size_t const stream_index = next - _streams.data();  // _streams may change while unlocked
+        std::string const stream_name = next->name;
+
+        lock.unlock();
+        bool sent = false;
+        try
+        {
+            pending.write();
+            sent = true;
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "[pacer] failed to write '" << stream_name << "': " << e.what() );
+        }
+        auto const done = clock::now();
+        lock.lock();
+
+        auto & stream = _streams[stream_index];
+        if( ! sent )
+        {
+            ++stream.stats.n_dropped;
+            continue;
+        }
+        ++stream.stats.n_sent;
+        auto const latency = std::chrono::duration_cast< std::chrono::nanoseconds >( done - pending.enqueued );
+        stream.stats.total_latency += latency;
+        if( latency > stream.stats.max_latency )
+            stream.stats.max_latency = latency;
+        ++stream.stats.n_latencies;
+
+        if( stream.bytes_per_second > 0 )
+            _flow_controller_busy_until[stream.flow_controller]
+                = done
+                + std::chrono::duration_cast< clock::duration >(
+                      std::chrono::duration< double >( pending.n_bytes / stream.bytes_per_second ) );
+    }
+}
+
+
+json dds_stream_pacer::stats_to_json()
+{
+    json j = json::object();
+    for( auto & stream : _streams )
+    {
+        auto & stats = stream.stats;
+        double avg_ms = stats.n_latencies ? stats.total_latency.count() / 1e6 / stats.n_latencies : 0.;
+        j[stream.name] = json::object( {
+            { topics::notification::stream_stats::key::sent, stats.n_sent },
+            { topics::notification::stream_stats::key::dropped, stats.n_dropped },
+            { topics::notification::stream_stats::key::latency,
+              json::object( { { "avg", avg_ms }, { "max", stats.max_latency.count() / 1e6 } } ) },
+        } );
+        // Sent/dropped are cumulative, but latency is per period
+        stats.total_latency = stats.max_latency = std::chrono::nanoseconds( 0 );
+        stats.n_latencies = 0;
+    }
+    return j;
+}
+
+
+json dds_stream_pacer::get_stats()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return stats_to_json();
+}
+
+
+}  // namespace realdds
@@ -2,6 +2,7 @@
 // Copyright(c) 2022 Intel Corporation. All Rights Reserved.
 
 #include <realdds/dds-stream-server.h>
+#include <realdds/dds-stream-pacer.h>
 
 #include <realdds/dds-topic-writer.h>
 #include <realdds/dds-topic.h>
@@ -11,11 +12,20 @@
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/blob-msg.h>
+#include <realdds/topics/dds-topic-names.h>
 #include <realdds/dds-time.h>
 
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 
+#include <rsutils/json.h>
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
 
 namespace realdds {
 
@@ -123,10 +133,55 @@ void dds_stream_server::run_stream()
             } );
     }
     
-    _writer->run( dds_topic_writer::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+    dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+    // Each stream type can have its own QoS (e.g., a flow-controller for color only)
+    _writer->override_qos_from_json( wqos,
+                                     _writer->topic()->get_participant()->settings().nested( "device", type_string() ) );
+    _writer->run( wqos );
+}
+
+
+void dds_stream_server::set_pacer( std::shared_ptr< dds_stream_pacer > const & pacer )
+{
+    if( ! is_open() )
+        DDS_THROW( runtime_error, "stream '" + name() + "' must be open before set_pacer()" );
+    if( _pacer )
+        DDS_THROW( runtime_error, "stream '" + name() + "' already has a pacer" );
+
+    if( pacer )
+        _pacer_index = pacer->add_stream( *this );
+    _pacer = pacer;
 }
 
 
+struct dds_motion_stream_server::batch
+{
+    std::shared_ptr< dds_topic_writer > writer;
+    size_t max_samples = 1;
+    std::chrono::steady_clock::duration max_latency;
+
+    std::mutex mutex;
+    std::condition_variable cv;  // signaled when a new batch is started, or when stopping
+    std::vector< topics::imu_msg > samples;
+    std::chrono::steady_clock::time_point first_sample;
+    bool stopping = false;
+
+    // A partial batch is written once its first sample is max-latency old, even if no more samples arrive
+    std::thread flusher;
+
+    ~batch()
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            stopping = true;
+        }
+        cv.notify_all();
+        if( flusher.joinable() )
+            flusher.join();
+    }
+};
+
+
 void dds_motion_stream_server::open( std::string const & topic_name, std::shared_ptr< dds_publisher > const & publisher )
 {
     if( is_open() )
@@ -137,10 +192,52 @@ void dds_motion_stream_server::open( std::string const & topic_name, std::shared
     auto topic = topics::imu_msg::create_topic( publisher->get_participant(), topic_name.c_str() );
     _writer = std::make_shared< dds_topic_writer >( topic, publisher );
 
+    // Batching is opt-in: clients that do not know about it will not get any samples
+    auto batch_settings = publisher->get_participant()->settings().nested( "device", "motion", "batch" );
+    size_t const max_samples = batch_settings.nested( "max-samples" ).default_value( size_t( 1 ) );
+    if( max_samples > 1 )
+    {
+        auto b = std::make_shared< batch >();
+        b->max_samples = max_samples;
+        double const max_latency_seconds = batch_settings.nested( "max-latency" ).default_value( 0.01 );
+        b->max_latency = std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+            std::chrono::duration< double >( max_latency_seconds ) );
+        b->samples.reserve( max_samples );
+
+        auto batch_topic = topics::blob_msg::create_topic( publisher->get_participant(),
+                                                           topic_name + topics::BATCH_TOPIC_SUFFIX );
+        b->writer = std::make_shared< dds_topic_writer >( batch_topic, publisher );
+        dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+        b->writer->override_qos_from_json( wqos, batch_settings );
+        b->writer->run( wqos );
+        b->flusher = std::thread(
+            [this, b = b.get()]()
+            {
+                std::unique_lock< std::mutex > lock( b->mutex );
+                while( ! b->stopping )
+                {
+                    if( b->samples.empty() )
+                        b->cv.wait( lock );
+                    else if( std::chrono::steady_clock::now() < b->first_sample + b->max_latency )
+                        b->cv.wait_until( lock, b->first_sample + b->max_latency );
+                    else
+                        write_batch( *b );
+                }
+            } );
+        _batch = b;
+    }
+
     run_stream();
 }
 
 
+void dds_motion_stream_server::close()
+{
+    _batch.reset();
+    super::close();
+}
+
+
 std::shared_ptr< dds_topic > const & dds_stream_server::get_topic() const
 {
     if( ! is_open() )
@@ -174,6 +271,19 @@ void dds_motion_stream_server::start_streaming()
 }
 
 
+void dds_motion_stream_server::stop_streaming()
+{
+    if( _batch )
+    {
+        // Don't keep a partial batch until the next time we stream
+        std::lock_guard< std::mutex > lock( _batch->mutex );
+        if( ! _batch->samples.empty() )
+            write_batch( *_batch );
+    }
+    super::stop_streaming();
+}
+
+
 void dds_stream_server::stop_streaming()
 {
     if( ! is_streaming() )
@@ -195,7 +305,7 @@ void dds_stream_server::close()
     _writer.reset();
 }
 
-void dds_video_stream_server::publish_image( topics::image_msg & image )
+void dds_video_stream_server::publish_image( topics::image_msg && image )
 {
     if( ! is_streaming() )
         DDS_THROW( runtime_error, "stream '" << name() << "' cannot publish before start_streaming()" );
@@ -241,6 +351,15 @@ void dds_video_stream_server::publish_image( topics::image_msg & image )
     assert( ! image.is_bigendian() );
 
     LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
+    if( _pacer )
+    {
+        auto const n_bytes = image.raw().data().size();
+        _pacer->enqueue( _pacer_index,
+                         n_bytes,
+                         [writer = _writer, raw = std::move( image.raw() )]() mutable
+                         { DDS_API_CALL( writer->get()->write( &raw ) ); } );
+        return;
+    }
     DDS_API_CALL( _writer->get()->write( &image.raw() ) );
 }
 
@@ -250,11 +369,54 @@ void dds_motion_stream_server::publish_motion( topics::imu_msg && imu )
     if( ! is_streaming() )
         DDS_THROW( runtime_error, "stream '" + name() + "' cannot publish before start_streaming()" );
 
+    if( _batch )
+    {
+        std::lock_guard< std::mutex > lock( _batch->mutex );
+        if( _batch->samples.empty() )
+        {
+            _batch->first_sample = std::chrono::steady_clock::now();
+            _batch->cv.notify_one();  // start the max-latency timer
+        }
+        _batch->samples.push_back( std::move( imu ) );
+        if( _batch->samples.size() >= _batch->max_samples )
+            write_batch( *_batch );
+        return;
+    }
+
     sensor_msgs::msg::Imu & raw_imu = imu.imu_data();
     raw_imu.header().frame_id() = sensor_name();
     LOG_DEBUG( "publishing '" << name() << "' " << imu.to_string() );
 
+    if( _pacer )
+    {
+        _pacer->enqueue( _pacer_index,
+                         sizeof( raw_imu ),
+                         [writer = _writer, raw = std::move( raw_imu )]() mutable
+                         { DDS_API_CALL( writer->get()->write( &raw ) ); } );
+        return;
+    }
     imu.write_to( *_writer );
 }
 
-}  // namespace realdds
\ No newline at end of file
+
+// Called with the batch mutex locked, so batches are written in order
+void dds_motion_stream_server::write_batch( batch & b )
+{
+    topics::blob_msg blob;
+    topics::imu_msg::pack( b.samples, blob.data() );
+    b.samples.clear();
+
+    LOG_DEBUG( "publishing '" << name() << "' batch of " << blob.data().size() << " bytes" );
+    if( _pacer )
+    {
+        auto const n_bytes = blob.data().size();
+        _pacer->enqueue( _pacer_index,
+                         n_bytes,
+                         [writer = b.writer, blob = std::move( blob )]() { blob.write_to( *writer ); } );
+        return;
+    }
+    blob.write_to( *b.writer );
+}
+
+
+}  // namespace realdds
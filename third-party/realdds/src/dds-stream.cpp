@@ -6,9 +6,13 @@
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader-thread.h>
 #include <realdds/dds-subscriber.h>
+#include <realdds/dds-participant.h>
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/blob-msg.h>
+#include <realdds/topics/dds-topic-names.h>
+#include <realdds/dds-utilities.h>
 #include <realdds/dds-exceptions.h>
 #include <realdds/dds-sample.h>
 
@@ -26,8 +30,30 @@ dds_stream::dds_stream( std::string const & stream_name, std::string const & sen
 
 dds_stream::~dds_stream()
 {
-    if( _reader )
-        _reader->stop();
+    // Derived classes must close() in their own destructor: by the time we get here, the members of theirs that the
+    // reader thread and strand use are already gone
+    close();
+}
+
+
+void dds_stream::init_dispatch( std::shared_ptr< dds_subscriber > const & subscriber )
+{
+    auto participant = subscriber->get_participant();
+    if( auto pool = participant->dispatch_pool() )
+    {
+        size_t const max_backlog
+            = participant->settings().nested( "device", "dispatch", "max-backlog" ).default_value( size_t( 8 ) );
+        _strand = pool->create_strand( max_backlog );
+    }
+}
+
+
+void dds_stream::dispatch( dds_dispatch_pool::work_item && item )
+{
+    if( _strand )
+        _strand->post( std::move( item ) );
+    else
+        item();
 }
 
 
@@ -44,6 +70,7 @@ void dds_video_stream::open( std::string const & topic_name, std::shared_ptr< dd
     // To support automatic streaming (without the need to handle start/stop-streaming commands) the reader is created
     // here and destroyed on close()
     _reader = std::make_shared< dds_topic_reader_thread >( topic, subscriber );
+    init_dispatch( subscriber );
     _reader->on_data_available( [this]() { handle_data(); } );
     _reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
 }
@@ -62,8 +89,27 @@ void dds_motion_stream::open( std::string const & topic_name, std::shared_ptr< d
     // To support automatic streaming (without the need to handle start/stop-streaming commands) the reader is created
     // here and destroyed on close()
     _reader = std::make_shared< dds_topic_reader_thread >( topic, subscriber );
+    init_dispatch( subscriber );
     _reader->on_data_available( [this]() { handle_data(); } );
     _reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+
+    // If the server batches samples, they'll come on a separate topic instead
+    if( ! _batched )
+        return;
+    auto batch_topic = topics::blob_msg::create_topic( subscriber->get_participant(),
+                                                       topic_name + topics::BATCH_TOPIC_SUFFIX );
+    _batch_reader = std::make_shared< dds_topic_reader_thread >( batch_topic, subscriber );
+    _batch_reader->on_data_available( [this]() { handle_batch(); } );
+    _batch_reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );
+}
+
+
+void dds_motion_stream::close()
+{
+    if( _batch_reader )
+        _batch_reader->stop();
+    super::close();  // closes the strand, so no batch is being handled anymore
+    _batch_reader.reset();
 }
 
 
@@ -71,6 +117,11 @@ void dds_stream::close()
 {
     if( _reader )
         _reader->stop();
+    // Pending samples are discarded, and we wait for the one being handled (if any) before the reader it may be
+    // using goes away
+    if( _strand )
+        _strand->close();
+    _strand.reset();
     _reader.reset();
 }
 
@@ -97,8 +148,23 @@ void dds_video_stream::handle_data()
         if( ! frame.is_valid() )
             continue;
 
-        if( is_streaming() && _on_data_available )
+        if( ! is_streaming() || ! _on_data_available )
+            continue;
+
+        if( ! _strand )
+        {
             _on_data_available( std::move( frame ), std::move( sample ) );
+            continue;
+        }
+
+        // Messages are move-only, but work items must be copyable
+        auto p_frame = std::make_shared< topics::image_msg >( std::move( frame ) );
+        dispatch(
+            [this, p_frame, sample]() mutable
+            {
+                if( is_streaming() && _on_data_available )
+                    _on_data_available( std::move( *p_frame ), std::move( sample ) );
+            } );
     }
 }
 
@@ -109,8 +175,77 @@ void dds_motion_stream::handle_data()
     dds_sample sample;
     while( _reader && topics::imu_msg::take_next( *_reader, &imu, &sample ) )
     {
-        if( is_streaming() && _on_data_available )
+        if( ! is_streaming() || ! _on_data_available )
+            continue;
+
+        if( ! _strand )
+        {
             _on_data_available( std::move( imu ), std::move( sample ) );
+            continue;
+        }
+
+        auto p_imu = std::make_shared< topics::imu_msg >( std::move( imu ) );
+        dispatch(
+            [this, p_imu, sample]() mutable
+            {
+                if( is_streaming() && _on_data_available )
+                    _on_data_available( std::move( *p_imu ), std::move( sample ) );
+            } );
+    }
+}
+
+
+void dds_motion_stream::handle_batch()
+{
+    topics::blob_msg blob;
+    dds_sample sample;
+    while( _batch_reader && topics::blob_msg::take_next( *_batch_reader, &blob, &sample ) )
+    {
+        if( ! blob.is_valid() )
+            continue;
+
+        if( ! is_streaming() || ! _on_data_available )
+            continue;
+
+        std::vector< topics::imu_msg > imus;
+        try
+        {
+            imus = topics::imu_msg::unpack( blob.data() );
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "[" << name() << "] invalid batch: " << e.what() );
+            continue;
+        }
+
+        if( ! _strand )
+        {
+            on_batch( std::move( imus ), std::move( sample ) );
+            continue;
+        }
+
+        auto p_imus = std::make_shared< std::vector< topics::imu_msg > >( std::move( imus ) );
+        dispatch(
+            [this, p_imus, sample]() mutable
+            {
+                if( is_streaming() && _on_data_available )
+                    on_batch( std::move( *p_imus ), std::move( sample ) );
+            } );
+    }
+}
+
+
+void dds_motion_stream::on_batch( std::vector< topics::imu_msg > && imus, dds_sample && sample )
+{
+    if( _on_batch_available )
+    {
+        _on_batch_available( std::move( imus ), std::move( sample ) );
+        return;
+    }
+    for( auto & imu : imus )
+    {
+        dds_sample sample_copy( sample );
+        _on_data_available( std::move( imu ), std::move( sample_copy ) );
     }
 }
 
@@ -136,6 +271,13 @@ dds_video_stream::dds_video_stream( std::string const & stream_name, std::string
 }
 
 
+dds_video_stream::~dds_video_stream()
+{
+    // Before _on_data_available goes away
+    close();
+}
+
+
 dds_depth_stream::dds_depth_stream( std::string const & stream_name, std::string const & sensor_name )
     : super( stream_name, sensor_name )
 {
@@ -166,4 +308,11 @@ dds_motion_stream::dds_motion_stream( std::string const & stream_name, std::stri
 }
 
 
+dds_motion_stream::~dds_motion_stream()
+{
+    // Before _on_data_available and _batch_reader go away
+    close();
+}
+
+
 }  // namespace realdds
@@ -34,6 +34,7 @@ namespace notification {
             std::string const profiles( "profiles", 8 );
             std::string const default_profile_index( "default-profile-index", 21 );
             std::string const metadata_enabled( "metadata-enabled", 16 );
+            std::string const batched( "batched", 7 );
         }
     }
     namespace stream_options {
@@ -90,6 +91,14 @@ namespace notification {
         //    using namespace stream_options::intrinsics;
         //}
     }
+    namespace stream_stats {
+        std::string const id( "stream-stats", 12 );
+        namespace key {
+            std::string const sent( "sent", 4 );
+            std::string const dropped( "dropped", 7 );
+            std::string const latency( "latency", 7 );
+        }
+    }
 }
 
 namespace control {
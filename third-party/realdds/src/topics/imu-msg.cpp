@@ -14,6 +14,8 @@
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
+#include <cstring>
+
 
 namespace realdds {
 namespace topics {
@@ -94,6 +96,84 @@ void imu_msg::write_to( dds_topic_writer & writer )
 }
 
 
+// Packed layout, in host (little-endian) order:
+//     uint8_t version; uint8_t reserved[3]; uint32_t count;
+// followed by 'count' items of:
+//     int32_t sec; uint32_t nsec; double accel[3]; double gyro[3];
+//
+static uint8_t const pack_version = 1;
+static size_t const pack_header_size = 8;
+static size_t const pack_item_size = 4 + 4 + 6 * sizeof( double );
+
+
+/*static*/ void imu_msg::pack( std::vector< imu_msg > const & imus, std::vector< uint8_t > & output )
+{
+    output.resize( pack_header_size + imus.size() * pack_item_size );
+    auto p = output.data();
+    auto put = [&p]( void const * data, size_t size )
+    {
+        std::memcpy( p, data, size );
+        p += size;
+    };
+
+    uint8_t const header[4] = { pack_version, 0, 0, 0 };
+    put( header, sizeof( header ) );
+    uint32_t const count = static_cast< uint32_t >( imus.size() );
+    put( &count, sizeof( count ) );
+
+    for( auto const & imu : imus )
+    {
+        auto const & stamp = imu.imu_data().header().stamp();
+        int32_t const sec = stamp.sec();
+        uint32_t const nsec = stamp.nanosec();
+        double const data[6] = { imu.accel_data().x(), imu.accel_data().y(), imu.accel_data().z(),
+                                 imu.gyro_data().x(),  imu.gyro_data().y(),  imu.gyro_data().z() };
+        put( &sec, sizeof( sec ) );
+        put( &nsec, sizeof( nsec ) );
+        put( data, sizeof( data ) );
+    }
+}
+
+
+/*static*/ std::vector< imu_msg > imu_msg::unpack( std::vector< uint8_t > const & input )
+{
+    if( input.size() < pack_header_size )
+        DDS_THROW( runtime_error, "imu pack is too small (" << input.size() << " bytes)" );
+    if( input[0] != pack_version )
+        DDS_THROW( runtime_error, "unsupported imu pack version " << int( input[0] ) );
+    uint32_t count;
+    std::memcpy( &count, input.data() + 4, sizeof( count ) );
+    if( input.size() != pack_header_size + size_t( count ) * pack_item_size )
+        DDS_THROW( runtime_error, "imu pack of " << count << " items has invalid size " << input.size() );
+
+    std::vector< imu_msg > imus( count );
+    auto p = input.data() + pack_header_size;
+    auto get = [&p]( void * data, size_t size )
+    {
+        std::memcpy( data, p, size );
+        p += size;
+    };
+    for( auto & imu : imus )
+    {
+        int32_t sec;
+        uint32_t nsec;
+        double data[6];
+        get( &sec, sizeof( sec ) );
+        get( &nsec, sizeof( nsec ) );
+        get( data, sizeof( data ) );
+        imu.imu_data().header().stamp().sec( sec );
+        imu.imu_data().header().stamp().nanosec( nsec );
+        imu.accel_data().x( data[0] );
+        imu.accel_data().y( data[1] );
+        imu.accel_data().z( data[2] );
+        imu.gyro_data().x( data[3] );
+        imu.gyro_data().y( data[4] );
+        imu.gyro_data().z( data[5] );
+    }
+    return imus;
+}
+
+
 std::string imu_msg::to_string() const
 {
     std::ostringstream ss;
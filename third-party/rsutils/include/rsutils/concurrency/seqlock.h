@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A value that is written rarely, by one thread at a time, and read often, from any number of threads.
+//
+// Readers never block and never write anything shared: they copy the value out and retry, instead, on the rare
+// occasion it changed while they were reading it. A writer never waits for readers.
+//
+// T must be trivially copyable; it is kept as raw words so that the concurrent reads are well-defined.
+//
+template< class T >
+class seqlock
+{
+    static_assert( std::is_trivially_copyable< T >::value, "seqlock values are copied as raw memory" );
+
+    static constexpr size_t n_words = ( sizeof( T ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t );
+
+    std::atomic< uint64_t > _seq;  // odd while a store is in progress
+    std::atomic< uint64_t > _words[n_words];
+
+public:
+    explicit seqlock( T const & value = T() )
+        : _seq( 0 )
+    {
+        store( value );
+    }
+
+    seqlock( seqlock const & ) = delete;
+    seqlock & operator=( seqlock const & ) = delete;
+
+    // Stores must not run concurrently with each other: serialize them if there's more than one writer
+    void store( T const & value )
+    {
+        uint64_t words[n_words] = {};
+        std::memcpy( words, &value, sizeof( T ) );
+
+        auto const seq = _seq.load( std::memory_order_relaxed );
+        _seq.store( seq + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        for( size_t i = 0; i < n_words; ++i )
+            _words[i].store( words[i], std::memory_order_relaxed );
+        _seq.store( seq + 2, std::memory_order_release );
+    }
+
+    T load() const
+    {
+        uint64_t words[n_words];
+        uint64_t seq;
+        do
+        {
+            seq = _seq.load( std::memory_order_acquire );
+            for( size_t i = 0; i < n_words; ++i )
+                words[i] = _words[i].load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+        }
+        while( ( seq & 1 ) || seq != _seq.load( std::memory_order_relaxed ) );
+
+        T value;
+        std::memcpy( &value, words, sizeof( T ) );
+        return value;
+    }
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
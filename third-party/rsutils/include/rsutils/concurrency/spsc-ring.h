@@ -0,0 +1,75 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A bounded, lock-free queue for exactly one producer thread and exactly one consumer thread.
+//
+// Nothing blocks: a push into a full ring, or a pop from an empty one, simply fails and it's up to the caller to
+// decide what to do (drop, retry, wait on something else...).
+//
+// T must be default-constructible and move-assignable; slots are reused rather than constructed and destroyed.
+//
+// A consumer that sleeps when the ring is empty needs its own handshake with the producer: e.g., a flag it sets before
+// checking empty(), which the producer checks after pushing, with a seq_cst fence on both sides between the two.
+//
+template< class T >
+class spsc_ring
+{
+    std::vector< T > _slots;
+
+    // Both indices only ever increase; the slot is (index % capacity)
+    alignas( 64 ) std::atomic< size_t > _head;  // next to pop; written only by the consumer
+    alignas( 64 ) std::atomic< size_t > _tail;  // next to push; written only by the producer
+
+public:
+    explicit spsc_ring( size_t capacity )
+        : _slots( capacity ? capacity : 1 )
+        , _head( 0 )
+        , _tail( 0 )
+    {
+    }
+
+    spsc_ring( spsc_ring const & ) = delete;
+    spsc_ring & operator=( spsc_ring const & ) = delete;
+
+    size_t capacity() const { return _slots.size(); }
+
+    // Only approximate when called while the producer or consumer are active
+    size_t size() const { return _tail.load( std::memory_order_acquire ) - _head.load( std::memory_order_acquire ); }
+    bool empty() const { return ! size(); }
+
+    // Producer only: returns false (and leaves 'item' intact) if full
+    bool try_push( T && item )
+    {
+        auto const tail = _tail.load( std::memory_order_relaxed );
+        if( tail - _head.load( std::memory_order_acquire ) >= _slots.size() )
+            return false;
+        _slots[tail % _slots.size()] = std::move( item );
+        _tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Consumer only: returns false if empty
+    bool try_pop( T & item )
+    {
+        auto const head = _head.load( std::memory_order_relaxed );
+        if( head == _tail.load( std::memory_order_acquire ) )
+            return false;
+        item = std::move( _slots[head % _slots.size()] );
+        _head.store( head + 1, std::memory_order_release );
+        return true;
+    }
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -19,6 +19,7 @@
 
 #if BUILD_EASYLOGGINGPP
 #include <third-party/easyloggingpp/src/easylogging++.h>
+#include <atomic>
 
 
 #define LIBREALSENSE_ELPP_ID "librealsense"
@@ -51,9 +52,14 @@
 // Direct log to ELPP, without conversion to string first; use this as an optimization, if you have simple string output
 // 
 // We've seen cases where this fails in U22, causing weird effects with custom overloads/types (e.g., json)
+//
+// The level gate is checked first: disabled levels (most of the time, Debug) then cost a single atomic load, without
+// the locked logger lookup.
 #define LIBRS_LOG_STR_( LEVEL, STR )                                                                                   \
     do                                                                                                                 \
     {                                                                                                                  \
+        if( ! rsutils::elpp_level_enabled( el::Level::LEVEL ) )                                                        \
+            break;                                                                                                     \
         auto logger__ = el::Loggers::getLogger( rsutils::g_librealsense_elpp_id );                                     \
         if( logger__ && logger__->enabled( el::Level::LEVEL ) )                                                        \
         {                                                                                                              \
@@ -68,6 +74,8 @@
 #define LIBRS_LOG_( LEVEL, ... )                                                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
+        if( ! rsutils::elpp_level_enabled( el::Level::LEVEL ) )                                                        \
+            break;                                                                                                     \
         auto logger__ = el::Loggers::getLogger( rsutils::g_librealsense_elpp_id );                                     \
         if( logger__ && logger__->typedConfigurations() &&  logger__->enabled( el::Level::LEVEL ) )                    \
         {                                                                                                              \
@@ -99,6 +107,20 @@ namespace rsutils {
 extern std::string const g_librealsense_elpp_id;
 
 
+// The levels enabled in the LIBREALSENSE_ELPP_ID logger, as a mask of el::Level bits, so the LOG_XXX macros can skip
+// disabled levels without looking up the logger. All bits are set until the first refresh, so everything then goes
+// through the full check.
+extern std::atomic< unsigned > g_librealsense_elpp_levels;
+
+inline bool elpp_level_enabled( el::Level level )
+{
+    return ( g_librealsense_elpp_levels.load( std::memory_order_relaxed ) & static_cast< unsigned >( level ) ) != 0;
+}
+
+// Must be called whenever the logger configuration changes, or the LOG_XXX macros will keep using the old levels
+void refresh_elpp_level_gate( std::string const & logger_id = LIBREALSENSE_ELPP_ID );
+
+
 // Configure the same logger as librealsense (by default), to disable/enable debug output
 void configure_elpp_logger( bool enable_debug = false,
                             std::string const & nested_indent = "",
@@ -9,6 +9,32 @@ namespace rsutils {
 
 
 std::string const g_librealsense_elpp_id( LIBREALSENSE_ELPP_ID );
+std::atomic< unsigned > g_librealsense_elpp_levels( ~0u );
+
+
+void refresh_elpp_level_gate( std::string const & logger_id )
+{
+    // Not g_librealsense_elpp_id: we may be called during static initialization, before it is constructed
+    if( logger_id != LIBREALSENSE_ELPP_ID )
+        return;  // the gate is only for the librealsense logger
+
+    unsigned levels = ~0u;
+    auto logger = el::Loggers::getLogger( logger_id, false );  // don't register it
+    if( logger && logger->typedConfigurations() )
+    {
+        levels = 0;
+        for( auto level : { el::Level::Trace,
+                            el::Level::Debug,
+                            el::Level::Fatal,
+                            el::Level::Error,
+                            el::Level::Warning,
+                            el::Level::Verbose,
+                            el::Level::Info } )
+            if( logger->enabled( level ) )
+                levels |= static_cast< unsigned >( level );
+    }
+    g_librealsense_elpp_levels = levels;
+}
 
 
 void configure_elpp_logger( bool enable_debug, std::string const & nested_indent, std::string const & logger_id )
@@ -44,6 +70,7 @@ void configure_elpp_logger( bool enable_debug, std::string const & nested_indent
         logger->reconfigure();
     else
         el::Loggers::reconfigureLogger( logger_id, defaultConf );
+    refresh_elpp_level_gate( logger_id );
 }
 
 
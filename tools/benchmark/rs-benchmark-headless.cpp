@@ -0,0 +1,540 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Benchmark of the CPU processing blocks that needs neither a camera nor a display, for CI machines.
+//
+// The frames come either from a recording (--input), or from a software device generating synthetic depth, infrared and
+// color. Every block is run over the same frames, and for each we report the median and 99th percentile of the time it
+// took, the median in nanoseconds per input pixel, and how many output frames it had to allocate rather than recycle.
+// The results are written as JSON; given the results of a previous run (--baseline), blocks whose ns/pixel grew by
+// more than --threshold percent are reported as regressions, and the exit code is non-zero.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <random>
+#include <cmath>
+
+#include <common/cli.h>
+#include <rsutils/json.h>
+#include "cpu-info.h"
+
+using namespace std;
+using namespace chrono;
+using namespace rs2;
+
+
+// The frames of one point in time; each test picks the one it needs
+struct capture
+{
+    frameset frames;  // depth, infrared and color, as a pipeline would deliver them
+    vector< frame > extra;  // frames of the same time not in the frameset (synthetic Y411)
+
+    frame find( rs2_stream stream, rs2_format format ) const
+    {
+        for( auto && f : frames )
+            if( f.get_profile().stream_type() == stream && f.get_profile().format() == format )
+                return f;
+        for( auto && f : extra )
+            if( f.get_profile().stream_type() == stream && f.get_profile().format() == format )
+                return f;
+        return {};
+    }
+};
+
+typedef function< frame( capture const & ) > input_selector;
+
+input_selector select_frame( rs2_stream stream, rs2_format format )
+{
+    return [stream, format]( capture const & c ) { return c.find( stream, format ); };
+}
+
+// Framesets are the input of blocks that need several streams, so they must have all of them
+input_selector select_frameset( vector< rs2_stream > streams )
+{
+    return [streams]( capture const & c ) -> frame {
+        for( auto stream : streams )
+            if( ! c.frames.first_or_default( stream ) )
+                return {};
+        return c.frames;
+    };
+}
+
+// The pixels a block has to go over
+size_t count_pixels( frame const & f )
+{
+    if( auto fs = f.as< frameset >() )
+    {
+        if( auto depth = fs.get_depth_frame() )
+            return count_pixels( depth );
+        return fs.size() ? count_pixels( fs[0] ) : 0;
+    }
+    if( auto vf = f.as< video_frame >() )
+        return size_t( vf.get_width() ) * vf.get_height();
+    return 0;
+}
+
+
+class test
+{
+public:
+    test( string name, shared_ptr< filter > block, input_selector select, function< frame( frame ) > prepare = nullptr )
+        : _name( move( name ) )
+        , _block( block )
+        , _select( move( select ) )
+        , _prepare( move( prepare ) )
+    {
+    }
+
+    string const & name() const { return _name; }
+
+    // The frame we process for the capture, with any preparation done outside the measurement; empty if the capture
+    // does not have what we need
+    frame input( capture const & c ) const
+    {
+        auto f = _select( c );
+        if( f && _prepare )
+            f = _prepare( f );
+        if( f )
+            f.keep();
+        return f;
+    }
+
+    frame process( frame f ) { return _block->process( f ); }
+
+    rsutils::json output_statistics() const
+    {
+        auto j = rsutils::json::parse( _block->get_statistics() );
+        return j.contains( "output" ) ? j["output"] : rsutils::json::object();
+    }
+
+private:
+    string _name;
+    shared_ptr< filter > _block;
+    input_selector _select;
+    function< frame( frame ) > _prepare;
+};
+
+
+vector< shared_ptr< test > > register_tests()
+{
+    vector< shared_ptr< test > > tests;
+    auto depth = select_frame( RS2_STREAM_DEPTH, RS2_FORMAT_Z16 );
+    auto add = [&]( string name, shared_ptr< filter > block, input_selector selector, function< frame( frame ) > prepare = nullptr ) {
+        tests.push_back( make_shared< test >( move( name ), block, move( selector ), move( prepare ) ) );
+    };
+
+    add( "colorizer", make_shared< colorizer >(), depth );
+    add( "pointcloud", make_shared< pointcloud >(), depth );
+    add( "spatial_filter", make_shared< spatial_filter >(), depth );
+    add( "temporal_filter", make_shared< temporal_filter >(), depth );
+    add( "hole_filling_filter", make_shared< hole_filling_filter >(), depth );
+    add( "threshold_filter", make_shared< threshold_filter >(), depth );
+    add( "decimation_filter", make_shared< decimation_filter >(), depth );
+    add( "units_transform", make_shared< units_transform >(), depth );
+    add( "rotation_filter", make_shared< rotation_filter >( vector< rs2_stream >{ RS2_STREAM_DEPTH }, 90.f ), depth );
+    add( "sequence_id_filter", make_shared< sequence_id_filter >(), depth );
+    add( "disparity_transform", make_shared< disparity_transform >( true ), depth );
+
+    // Disparity to depth, starting from the depth converted to disparity (in the preparation step)
+    auto to_disparity = make_shared< disparity_transform >( true );
+    auto prepare_disparity = [to_disparity]( frame f ) { return to_disparity->process( f ); };
+    add( "disparity_to_depth", make_shared< disparity_transform >( false ), depth, prepare_disparity );
+    auto to_distance = make_shared< disparity_transform >( false );
+    to_distance->set_option( RS2_OPTION_OUTPUT_DISTANCE, 1.f );
+    add( "disparity_to_distance", to_distance, depth, prepare_disparity );
+
+    add( "hdr_merge", make_shared< hdr_merge >(), select_frameset( { RS2_STREAM_DEPTH, RS2_STREAM_INFRARED } ) );
+    add( "align_to_color", make_shared< rs2::align >( RS2_STREAM_COLOR ), select_frameset( { RS2_STREAM_DEPTH, RS2_STREAM_COLOR } ) );
+    add( "align_to_depth", make_shared< rs2::align >( RS2_STREAM_DEPTH ), select_frameset( { RS2_STREAM_DEPTH, RS2_STREAM_COLOR } ) );
+
+    // Format conversions
+    add( "yuy_decoder", make_shared< yuy_decoder >(), select_frame( RS2_STREAM_COLOR, RS2_FORMAT_YUYV ) );
+    add( "y411_decoder", make_shared< y411_decoder >(), select_frame( RS2_STREAM_COLOR, RS2_FORMAT_Y411 ) );
+
+    return tests;
+}
+
+
+// A software device with depth and infrared (in an alternating HDR sequence), YUYV color and Y411 color, all at the
+// same resolution. The content is random but repeatable, with a smooth depth surface and some holes, so filters have
+// real work to do.
+class synthetic_source
+{
+public:
+    synthetic_source( int width, int height )
+        : _width( width )
+        , _height( height )
+        , _stereo( _dev.add_sensor( "Stereo Module" ) )
+        , _color( _dev.add_sensor( "RGB Camera" ) )
+        , _y411( _dev.add_sensor( "Y411 Camera" ) )
+        , _random( 0 )
+        , _combiner( [this]( frame, frame_source & source ) {
+            source.frame_ready( source.allocate_composite_frame( _to_combine ) );
+        } )
+    {
+        rs2_intrinsics intrinsics = { width, height, width / 2.f, height / 2.f, width * .9f, width * .9f,
+                                      RS2_DISTORTION_BROWN_CONRADY, { 0, 0, 0, 0, 0 } };
+        _stereo.add_read_only_option( RS2_OPTION_DEPTH_UNITS, .001f );
+        _stereo.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+        _depth_profile = _stereo.add_video_stream(
+            { RS2_STREAM_DEPTH, 0, 0, width, height, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+        _ir_profile = _stereo.add_video_stream(
+            { RS2_STREAM_INFRARED, 1, 1, width, height, 30, 1, RS2_FORMAT_Y8, intrinsics } );
+        _color_profile = _color.add_video_stream(
+            { RS2_STREAM_COLOR, 0, 2, width, height, 30, 2, RS2_FORMAT_YUYV, intrinsics } );
+        _y411_profile = _y411.add_video_stream(
+            { RS2_STREAM_COLOR, 1, 3, width, height, 30, 1, RS2_FORMAT_Y411, intrinsics } );
+
+        rs2_extrinsics extrinsics = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { .015f, 0, 0 } };
+        _depth_profile.register_extrinsics_to( _color_profile, extrinsics );
+
+        _stereo.open( { _depth_profile, _ir_profile } );
+        _color.open( _color_profile );
+        _y411.open( _y411_profile );
+        _stereo.start( _queue );
+        _color.start( _queue );
+        _y411.start( _queue );
+        _combiner.start( _framesets );
+    }
+
+    ~synthetic_source()
+    {
+        for( auto s : { _stereo, _color, _y411 } )
+        {
+            s.stop();
+            s.close();
+        }
+    }
+
+    vector< capture > generate( int n )
+    {
+        vector< capture > captures;
+        for( int i = 0; i < n; ++i )
+        {
+            auto timestamp = i * 1000. / 30;
+
+            // HDR alternates between two exposures, and only merges framesets of the same sequence
+            _stereo.set_metadata( RS2_FRAME_METADATA_SEQUENCE_SIZE, 2 );
+            _stereo.set_metadata( RS2_FRAME_METADATA_SEQUENCE_ID, i % 2 );
+            _stereo.set_metadata( RS2_FRAME_METADATA_FRAME_COUNTER, i );
+
+            auto depth = generate_frame( _stereo, _depth_profile, i, timestamp, [&]( uint8_t * p ) {
+                auto pixels = reinterpret_cast< uint16_t * >( p );
+                uniform_int_distribution< int > noise( -5, 5 );
+                uniform_int_distribution< int > hole( 0, 49 );
+                for( int y = 0; y < _height; ++y )
+                    for( int x = 0; x < _width; ++x )
+                    {
+                        // A slanted plane with bumps, 0.5-4m away, with noise and 2% holes
+                        auto z = 500. + 3000. * y / _height + 200. * sin( x * .05 + i ) * cos( y * .05 );
+                        *pixels++ = hole( _random ) ? uint16_t( z + noise( _random ) ) : 0;
+                    }
+            } );
+            auto ir = generate_frame( _stereo, _ir_profile, i, timestamp, [&]( uint8_t * p ) { fill_random( p, _width * _height ); } );
+            auto color = generate_frame( _color, _color_profile, i, timestamp, [&]( uint8_t * p ) { fill_random( p, _width * _height * 2 ); } );
+            auto y411 = generate_frame( _y411, _y411_profile, i, timestamp, [&]( uint8_t * p ) { fill_random( p, _width * _height * 3 / 2 ); } );
+
+            capture c;
+            c.frames = combine( { depth, ir, color } );
+            c.extra.push_back( y411 );
+            captures.push_back( c );
+        }
+        return captures;
+    }
+
+private:
+    void fill_random( uint8_t * p, size_t size )
+    {
+        uniform_int_distribution< int > byte( 0, 255 );
+        for( size_t i = 0; i < size; ++i )
+            p[i] = uint8_t( byte( _random ) );
+    }
+
+    frame generate_frame( software_sensor & sensor, stream_profile const & profile, int number, double timestamp,
+                          function< void( uint8_t * ) > fill )
+    {
+        auto vsp = profile.as< video_stream_profile >();
+        // Y411 is 12 bits per pixel: the stride is in bytes, while bpp is rounded up
+        int stride = profile.format() == RS2_FORMAT_Y411 ? vsp.width() * 3 / 2 : vsp.width() * get_bpp( profile );
+        auto pixels = new uint8_t[stride * vsp.height()];
+        fill( pixels );
+
+        rs2_software_video_frame f;
+        f.pixels = pixels;
+        f.deleter = []( void * p ) { delete[] static_cast< uint8_t * >( p ); };
+        f.stride = stride;
+        f.bpp = get_bpp( profile );
+        f.timestamp = timestamp;
+        f.domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
+        f.frame_number = number;
+        f.profile = profile.get();
+        f.depth_units = 0;
+        sensor.on_video_frame( f );
+
+        frame result;
+        if( ! _queue.try_wait_for_frame( &result, 5000 ) )
+            throw runtime_error( "software device did not deliver frame " + to_string( number ) );
+        // We hold on to the frames for the whole run, beyond what the sensor's frame pool allows
+        result.keep();
+        return result;
+    }
+
+    static int get_bpp( stream_profile const & profile )
+    {
+        switch( profile.format() )
+        {
+        case RS2_FORMAT_Z16:
+        case RS2_FORMAT_YUYV:
+            return 2;
+        default:
+            return 1;
+        }
+    }
+
+    frameset combine( vector< frame > frames )
+    {
+        _to_combine = move( frames );
+        _combiner.invoke( _to_combine.front() );
+        auto fs = _framesets.wait_for_frame().as< frameset >();
+        fs.keep();
+        _to_combine.clear();
+        return fs;
+    }
+
+    int _width, _height;
+    software_device _dev;
+    software_sensor _stereo, _color, _y411;
+    stream_profile _depth_profile, _ir_profile, _color_profile, _y411_profile;
+    frame_queue _queue{ 1 };
+    mt19937 _random;
+
+    // Makes framesets out of the frames we want, like a syncer would but without waiting on timestamps
+    vector< frame > _to_combine;
+    processing_block _combiner;
+    frame_queue _framesets{ 1 };
+};
+
+
+// Framesets from a recording, played back as fast as possible
+vector< capture > read_bag( context & ctx, string const & filename, int n )
+{
+    pipeline pipe( ctx );
+    config cfg;
+    cfg.enable_device_from_file( filename, false );
+    auto profile = pipe.start( cfg );
+    profile.get_device().as< playback >().set_real_time( false );
+
+    vector< capture > captures;
+    frameset fs;
+    while( int( captures.size() ) < n && pipe.try_wait_for_frames( &fs, 5000 ) )
+    {
+        fs.keep();
+        capture c;
+        c.frames = fs;
+        captures.push_back( c );
+    }
+    pipe.stop();
+    return captures;
+}
+
+
+double percentile( vector< double > const & sorted, double p )
+{
+    if( sorted.empty() )
+        return 0;
+    auto rank = size_t( ceil( p * sorted.size() ) );
+    return sorted[min( max( rank, size_t( 1 ) ), sorted.size() ) - 1];
+}
+
+
+rsutils::json run( test & t, vector< capture > const & captures, int warmup, int iterations )
+{
+    vector< frame > inputs;
+    for( auto && c : captures )
+        if( auto f = t.input( c ) )
+            inputs.push_back( f );
+    if( inputs.empty() )
+        return {};
+
+    for( int i = 0; i < warmup; ++i )
+        t.process( inputs[i % inputs.size()] );
+
+    auto before = t.output_statistics();
+    vector< double > durations;  // in microseconds
+    durations.reserve( iterations );
+    size_t pixels = 0;
+    for( int i = 0; i < iterations; ++i )
+    {
+        auto & f = inputs[i % inputs.size()];
+        auto start = steady_clock::now();
+        auto output = t.process( f );  // released only after we stop the clock
+        auto end = steady_clock::now();
+        durations.push_back( duration< double, micro >( end - start ).count() );
+        pixels += count_pixels( f );
+    }
+    auto after = t.output_statistics();
+
+    sort( durations.begin(), durations.end() );
+    auto delta = [&]( char const * counter ) {
+        return ( after.value( counter, 0. ) - before.value( counter, 0. ) ) / iterations;
+    };
+    auto p50 = percentile( durations, .5 );
+    auto pixels_per_frame = double( pixels ) / iterations;
+
+    rsutils::json j;
+    j["frames"] = iterations;
+    j["pixels"] = pixels_per_frame;
+    j["p50-us"] = p50;
+    j["p99-us"] = percentile( durations, .99 );
+    j["mean-us"] = accumulate( durations.begin(), durations.end(), 0. ) / iterations;
+    j["max-us"] = durations.back();
+    j["ns-per-pixel"] = pixels_per_frame ? p50 * 1000 / pixels_per_frame : 0.;
+    j["allocations-per-frame"] = delta( "buffers-allocated" );
+    j["recycles-per-frame"] = delta( "buffers-recycled" );
+    return j;
+}
+
+
+// Blocks whose ns/pixel grew by more than the threshold (in percent) since the baseline; returns how many
+int compare( rsutils::json & results, rsutils::json const & baseline, double threshold )
+{
+    int regressions = 0;
+    auto & blocks = results["blocks"];
+    auto const & base_blocks = baseline.contains( "blocks" ) ? baseline["blocks"] : rsutils::json::object();
+
+    cerr << left << setw( 24 ) << "block" << right << setw( 12 ) << "baseline" << setw( 12 ) << "ns/pixel"
+         << setw( 10 ) << "change" << endl;
+    for( auto it = blocks.begin(); it != blocks.end(); ++it )
+    {
+        if( ! base_blocks.contains( it.key() ) )
+            continue;
+        double base = base_blocks[it.key()].value( "ns-per-pixel", 0. );
+        double current = it.value().value( "ns-per-pixel", 0. );
+        if( base <= 0 )
+            continue;
+
+        double change = ( current - base ) * 100. / base;
+        bool regression = change > threshold;
+        it.value()["baseline-ns-per-pixel"] = base;
+        it.value()["change-percent"] = change;
+        it.value()["regression"] = regression;
+        if( regression )
+            ++regressions;
+
+        cerr << left << setw( 24 ) << it.key() << right << fixed << setprecision( 3 ) << setw( 12 ) << base
+             << setw( 12 ) << current << setprecision( 1 ) << setw( 9 ) << showpos << change << noshowpos << "%"
+             << ( regression ? "  REGRESSION" : "" ) << endl;
+    }
+    results["regressions"] = regressions;
+    return regressions;
+}
+
+
+int main( int argc, char ** argv ) try
+{
+    cli::value< string > bag_arg( 'i', "input", "path", "", "Recording (.bag) to take frames from; synthetic frames if none" );
+    cli::value< int > width_arg( "width", "pixels", 1280, "Width of synthetic frames" );
+    cli::value< int > height_arg( "height", "pixels", 720, "Height of synthetic frames" );
+    cli::value< int > captures_arg( 'c', "captures", "number", 10, "How many distinct framesets to cycle over" );
+    cli::value< int > frames_arg( 'n', "frames", "number", 300, "How many frames each block processes" );
+    cli::value< int > warmup_arg( "warmup", "number", 30, "How many frames each block processes before we measure" );
+    cli::value< string > output_arg( 'o', "output", "path", "", "Where to write the results (JSON); standard output if none" );
+    cli::value< string > baseline_arg( 'b', "baseline", "path", "", "Results of a previous run to compare to" );
+    cli::value< double > threshold_arg( 't', "threshold", "percent", 10., "Growth in ns/pixel reported as a regression" );
+
+    auto settings = rs2::cli( "rs-benchmark-headless tool" )
+        .arg( bag_arg )
+        .arg( width_arg )
+        .arg( height_arg )
+        .arg( captures_arg )
+        .arg( frames_arg )
+        .arg( warmup_arg )
+        .arg( output_arg )
+        .arg( baseline_arg )
+        .arg( threshold_arg )
+        .process( argc, argv );
+    rs2::context ctx( settings.dump() );
+
+    rsutils::json results;
+    results["cpu"] = get_cpu();
+
+    // The source must outlive its frames: some blocks need the sensor that produced them
+    unique_ptr< synthetic_source > source;
+    vector< capture > captures;
+    // HDR merges pairs of consecutive framesets, so we cycle over an even number of them
+    int n_captures = max( 2, captures_arg.getValue() + captures_arg.getValue() % 2 );
+    if( bag_arg.isSet() )
+    {
+        captures = read_bag( ctx, bag_arg.getValue(), n_captures );
+        results["input"]["source"] = bag_arg.getValue();
+    }
+    else
+    {
+        source.reset( new synthetic_source( width_arg.getValue(), height_arg.getValue() ) );
+        captures = source->generate( n_captures );
+        results["input"]["source"] = "synthetic";
+        results["input"]["width"] = width_arg.getValue();
+        results["input"]["height"] = height_arg.getValue();
+    }
+    if( captures.empty() )
+        throw runtime_error( "no frames to benchmark" );
+    results["input"]["captures"] = captures.size();
+
+    results["blocks"] = rsutils::json::object();
+    for( auto && t : register_tests() )
+    {
+        cerr << t->name() << "..." << endl;
+        auto j = run( *t, captures, warmup_arg.getValue(), max( 1, frames_arg.getValue() ) );
+        if( j.is_null() )
+        {
+            cerr << "    skipped: no input" << endl;
+            continue;
+        }
+        results["blocks"][t->name()] = j;
+    }
+
+    int regressions = 0;
+    if( baseline_arg.isSet() )
+    {
+        ifstream f( baseline_arg.getValue() );
+        if( ! f )
+            throw runtime_error( "failed to open baseline " + baseline_arg.getValue() );
+        auto baseline = rsutils::json::parse( string( istreambuf_iterator< char >( f ), istreambuf_iterator< char >() ) );
+        results["threshold-percent"] = threshold_arg.getValue();
+        regressions = compare( results, baseline, threshold_arg.getValue() );
+    }
+
+    if( output_arg.isSet() )
+    {
+        ofstream f( output_arg.getValue() );
+        f << results.dump( 4 ) << endl;
+    }
+    else
+        cout << results.dump( 4 ) << endl;
+
+    return regressions ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+catch( const error & e )
+{
+    cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    " << e.what() << endl;
+    return EXIT_FAILURE;
+}
+catch( const exception & e )
+{
+    cerr << e.what() << endl;
+    return EXIT_FAILURE;
+}
+catch( ... )
+{
+    cerr << "some error" << endl;
+    return EXIT_FAILURE;
+}
@@ -2,6 +2,7 @@
 // Copyright(c) 2024-5 Intel Corporation. All Rights Reserved.
 
 #include "lrs-device-controller.h"
+#include "lrs-jpeg-encoder.h"
 
 #include <common/metadata-helper.h>
 
@@ -284,6 +285,32 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
                 profiles.push_back( profile );
                 LOG_DEBUG( stream_name << ": " << profile->to_string() );
             }
+
+            // Offer a compressed version of color profiles we can encode, but only once for each resolution
+            auto const vsp = sp.as< rs2::video_stream_profile >();
+            if( _jpeg_quality && sp.stream_type() == RS2_STREAM_COLOR && vsp
+                && tools::lrs_jpeg_encoder::can_encode( sp.format(), vsp.width() ) )
+            {
+                realdds::dds_video_encoding const jpeg( "jpeg" );
+                bool const exists = std::any_of(
+                    profiles.begin(),
+                    profiles.end(),
+                    [&]( std::shared_ptr< realdds::dds_stream_profile > const & p )
+                    {
+                        auto vp = std::dynamic_pointer_cast< realdds::dds_video_stream_profile >( p );
+                        return vp && vp->encoding() == jpeg && vp->frequency() == vsp.fps()
+                            && vp->width() == vsp.width() && vp->height() == vsp.height();
+                    } );
+                if( ! exists )
+                {
+                    profiles.push_back( std::make_shared< realdds::dds_video_stream_profile >(
+                        static_cast< int16_t >( vsp.fps() ),
+                        jpeg,
+                        static_cast< uint16_t >( vsp.width() ),
+                        static_cast< int16_t >( vsp.height() ) ) );
+                    LOG_DEBUG( stream_name << ": " << profiles.back()->to_string() );
+                }
+            }
         } );
     }
 
@@ -402,6 +429,19 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
                     }
                 }
 
+                if( _jpeg_quality && ! strcmp( server->type_string(), "color" ) )
+                {
+                    json j = json::array();
+                    j += tools::lrs_jpeg_encoder::option_name;
+                    j += _jpeg_quality.load();
+                    j += tools::lrs_jpeg_encoder::min_quality;
+                    j += tools::lrs_jpeg_encoder::max_quality;
+                    j += 1;                    // Step
+                    j += _jpeg_quality.load();  // Default
+                    j += "Quality of JPEG-encoded color frames; lower values use less bandwidth";
+                    stream_options.push_back( realdds::dds_option::from_json( j ) );
+                }
+
                 if( auto roi_sensor = rs2::roi_sensor( sensor ) )
                 {
                     // AE ROI is exposed as an interface in the librealsense API and through a "Region of Interest"
@@ -576,21 +616,32 @@ rs2::stream_profile get_required_profile( const rs2::sensor & sensor,
     auto const stream_type = stream_name_to_type( stream_name );
     auto const stream_index = stream_name_to_index( stream_name );
 
-    auto profile_iter = std::find_if( sensor_stream_profiles.begin(),
-                                      sensor_stream_profiles.end(),
-                                      [&]( rs2::stream_profile const & sp ) {
-                                          auto vp = sp.as< rs2::video_stream_profile >();
-                                          auto dds_vp = std::dynamic_pointer_cast< dds_video_stream_profile >( profile );
-                                          bool video_params_match = ( vp && dds_vp )
-                                                                      ? vp.width() == dds_vp->width()
-                                                                            && vp.height() == dds_vp->height()
-                                                                            && vp.format() == dds_vp->encoding().to_rs2()
-                                                                      : true;
-                                          return sp.stream_type() == stream_type
-                                              && sp.stream_index() == stream_index
-                                              && sp.fps() == profile->frequency()
-                                              && video_params_match;
-                                      } );
+    auto find_sensor_profile = [&]( std::function< bool( rs2_format ) > format_matches )
+    {
+        return std::find_if( sensor_stream_profiles.begin(),
+                             sensor_stream_profiles.end(),
+                             [&]( rs2::stream_profile const & sp ) {
+                                 auto vp = sp.as< rs2::video_stream_profile >();
+                                 auto dds_vp = std::dynamic_pointer_cast< dds_video_stream_profile >( profile );
+                                 bool video_params_match = ( vp && dds_vp )
+                                                             ? vp.width() == dds_vp->width()
+                                                                   && vp.height() == dds_vp->height()
+                                                                   && format_matches( vp.format() )
+                                                             : true;
+                                 return sp.stream_type() == stream_type
+                                     && sp.stream_index() == stream_index
+                                     && sp.fps() == profile->frequency()
+                                     && video_params_match;
+                             } );
+    };
+
+    auto dds_vp = std::dynamic_pointer_cast< dds_video_stream_profile >( profile );
+    auto const format = dds_vp ? dds_vp->encoding().to_rs2() : RS2_FORMAT_ANY;
+    auto profile_iter = find_sensor_profile( [format]( rs2_format f ) { return f == format; } );
+    if( profile_iter == sensor_stream_profiles.end() && format == RS2_FORMAT_MJPEG )
+        // JPEG profiles we added ourselves: we'll encode from anything we can
+        profile_iter = find_sensor_profile(
+            [&]( rs2_format f ) { return tools::lrs_jpeg_encoder::can_encode( f, dds_vp->width() ); } );
     if( profile_iter == sensor_stream_profiles.end() )
     {
         throw std::runtime_error( "Could not find required profile" );
@@ -644,6 +695,7 @@ lrs_device_controller::frame_to_streaming_server( rs2::frame const & f, rs2::str
 lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr< realdds::dds_device_server > dds_device_server )
     : _rs_dev( dev )
     , _dds_device_server( dds_device_server )
+    , _jpeg_quality( 0 )
     , _control_dispatcher( QUEUE_MAX_SIZE )
 {
     if( ! _dds_device_server )
@@ -683,6 +735,17 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
     _md_enabled = rs2::metadata_helper::instance().can_support_metadata( _rs_dev.get_info( RS2_CAMERA_INFO_PRODUCT_LINE ) )
                && rs2::metadata_helper::instance().is_enabled( _rs_dev.get_info( RS2_CAMERA_INFO_PHYSICAL_PORT ) );
 
+    // JPEG compression of color streams is opt-in
+    int jpeg_quality = 0;
+    _dds_device_server->participant()->settings().nested( "device", "color", "jpeg-quality" ).get_ex( jpeg_quality );
+    if( jpeg_quality && ( jpeg_quality < tools::lrs_jpeg_encoder::min_quality
+                          || jpeg_quality > tools::lrs_jpeg_encoder::max_quality ) )
+    {
+        LOG_ERROR( "invalid JPEG quality " << jpeg_quality << "; JPEG encoding is disabled" );
+        jpeg_quality = 0;
+    }
+    _jpeg_quality = jpeg_quality;
+
     // Create a supported streams list for initializing the relevant DDS topics
     supported_streams = get_supported_streams();
 
@@ -747,9 +810,26 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         image.set_height( video->get_image_header().height );
                         image.set_width( video->get_image_header().width );
                         image.set_timestamp( timestamp );
-                        auto data = static_cast< const uint8_t * >( f.get_data() );
-                        image.raw().data().assign( data, data + f.get_data_size() );
-                        video->publish_image( image );
+                        static realdds::dds_video_encoding const jpeg( "jpeg" );
+                        if( video->get_image_header().encoding == jpeg
+                            && f.get_profile().format() != RS2_FORMAT_MJPEG )
+                        {
+                            try
+                            {
+                                tools::lrs_jpeg_encoder::encode( f, _jpeg_quality, image.raw().data() );
+                            }
+                            catch( std::exception const & e )
+                            {
+                                LOG_ERROR( "dropping frame: " << e.what() );
+                                return;
+                            }
+                        }
+                        else
+                        {
+                            auto data = static_cast< const uint8_t * >( f.get_data() );
+                            image.raw().data().assign( data, data + f.get_data_size() );
+                        }
+                        video->publish_image( std::move( image ) );
 
                         publish_frame_metadata( f, timestamp );
                     } );
@@ -1176,7 +1256,15 @@ void lrs_device_controller::set_option( const std::shared_ptr< realdds::dds_opti
         throw std::runtime_error( "no stream '" + stream->name() + "' in device" );
     auto server = it->second;
     auto & sensor = _rs_sensors[server->sensor_name()];
-    if( auto roi_option = std::dynamic_pointer_cast< realdds::dds_rect_option >( option ) )
+    if( option->get_name() == tools::lrs_jpeg_encoder::option_name )
+    {
+        // Not a librealsense option: it's ours
+        int const quality = new_value;
+        if( quality < tools::lrs_jpeg_encoder::min_quality || quality > tools::lrs_jpeg_encoder::max_quality )
+            throw std::runtime_error( rsutils::string::from() << "invalid JPEG quality " << new_value );
+        _jpeg_quality = quality;
+    }
+    else if( auto roi_option = std::dynamic_pointer_cast< realdds::dds_rect_option >( option ) )
     {
         // ROI has its own API in librealsense
         if( auto roi_sensor = rs2::roi_sensor( sensor ) )
@@ -1234,6 +1322,8 @@ json lrs_device_controller::query_option( const std::shared_ptr< realdds::dds_op
     auto & sensor = _rs_sensors[server->sensor_name()];
     try
     {
+        if( option->get_name() == tools::lrs_jpeg_encoder::option_name )
+            return _jpeg_quality.load();
         if( auto roi_option = std::dynamic_pointer_cast< realdds::dds_rect_option >( option ) )
         {
             if( auto roi_sensor = rs2::roi_sensor( sensor ) )
@@ -10,6 +10,7 @@
 #include <rsutils/concurrency/concurrency.h>
 #include <map>
 #include <vector>
+#include <atomic>
 
 namespace rs2 {
     class frame;
@@ -102,6 +103,9 @@ private:
     std::shared_ptr< realdds::dds_device_server > _dds_device_server;
     bool _md_enabled;
 
+    // Color streams can also be offered JPEG-compressed; 0 if not enabled
+    std::atomic< int > _jpeg_quality;
+
     dispatcher _control_dispatcher;
 
     std::string _ros2_node_name;
@@ -0,0 +1,143 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "lrs-jpeg-encoder.h"
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <third-party/stb_image_write.h>
+
+#include <rsutils/string/from.h>
+
+#include <stdexcept>
+#include <string>
+
+using tools::lrs_jpeg_encoder;
+
+
+char const * const lrs_jpeg_encoder::option_name = "JPEG Quality";
+int const lrs_jpeg_encoder::min_quality;
+int const lrs_jpeg_encoder::max_quality;
+
+
+static inline uint8_t clamp_byte( int x )
+{
+    return x < 0 ? 0 : x > 255 ? 255 : uint8_t( x );
+}
+
+
+// BT.601 limited-range to RGB, in integer math
+static inline void yuv_to_rgb( int y, int u, int v, uint8_t * rgb )
+{
+    int const c = 298 * ( y - 16 ) + 128;
+    int const d = u - 128;
+    int const e = v - 128;
+    rgb[0] = clamp_byte( ( c + 409 * e ) >> 8 );
+    rgb[1] = clamp_byte( ( c - 100 * d - 208 * e ) >> 8 );
+    rgb[2] = clamp_byte( ( c + 516 * d ) >> 8 );
+}
+
+
+// Packed 4:2:2 (two pixels per 4 bytes) to RGB; the offsets select YUYV or UYVY. The width must be even: there's no
+// chroma for a trailing pixel.
+static void packed_422_to_rgb( uint8_t const * src, int stride, int width, int height,
+                               int y0, int y1, int u, int v,
+                               uint8_t * rgb )
+{
+    for( int row = 0; row < height; ++row )
+    {
+        auto in = src + row * stride;
+        for( int x = 0; x < width; x += 2, in += 4, rgb += 6 )
+        {
+            yuv_to_rgb( in[y0], in[u], in[v], rgb );
+            yuv_to_rgb( in[y1], in[u], in[v], rgb + 3 );
+        }
+    }
+}
+
+
+bool lrs_jpeg_encoder::can_encode( rs2_format format, int width )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_YUYV:
+    case RS2_FORMAT_UYVY:
+        return width % 2 == 0;
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8:
+    case RS2_FORMAT_Y8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+void lrs_jpeg_encoder::encode( rs2::video_frame const & f, int quality, std::vector< uint8_t > & out )
+{
+    if( quality < min_quality || quality > max_quality )
+        throw std::runtime_error( "invalid JPEG quality " + std::to_string( quality ) );
+
+    int const width = f.get_width();
+    int const height = f.get_height();
+    int const stride = f.get_stride_in_bytes();
+    auto const src = static_cast< uint8_t const * >( f.get_data() );
+    auto const format = f.get_profile().format();
+    if( ! can_encode( format, width ) )
+        throw std::runtime_error( rsutils::string::from()
+                                  << "cannot JPEG-encode " << width << "-wide " << rs2_format_to_string( format ) );
+
+    // stb wants tightly-packed RGB (or grey); convert anything else first. Per-thread so we don't reallocate for
+    // every frame.
+    thread_local std::vector< uint8_t > converted;
+    void const * pixels = src;
+    int comp = 3;
+    switch( format )
+    {
+    case RS2_FORMAT_YUYV:
+        converted.resize( size_t( width ) * height * 3 );
+        packed_422_to_rgb( src, stride, width, height, 0, 2, 1, 3, converted.data() );
+        pixels = converted.data();
+        break;
+    case RS2_FORMAT_UYVY:
+        converted.resize( size_t( width ) * height * 3 );
+        packed_422_to_rgb( src, stride, width, height, 1, 3, 0, 2, converted.data() );
+        pixels = converted.data();
+        break;
+    case RS2_FORMAT_BGR8:
+        converted.resize( size_t( width ) * height * 3 );
+        for( int row = 0; row < height; ++row )
+        {
+            auto in = src + row * stride;
+            auto rgb = converted.data() + size_t( row ) * width * 3;
+            for( int x = 0; x < width; ++x, in += 3, rgb += 3 )
+            {
+                rgb[0] = in[2];
+                rgb[1] = in[1];
+                rgb[2] = in[0];
+            }
+        }
+        pixels = converted.data();
+        break;
+    case RS2_FORMAT_RGB8:
+        break;
+    case RS2_FORMAT_Y8:
+        comp = 1;
+        break;
+    default:
+        break;  // already checked
+    }
+    if( pixels == src && stride != width * comp )
+        throw std::runtime_error( "cannot JPEG-encode padded frames" );
+
+    out.clear();
+    out.reserve( size_t( width ) * height / 4 );  // typical compression ratio is much better than this
+    auto write = []( void * context, void * data, int size )
+    {
+        auto & out = *static_cast< std::vector< uint8_t > * >( context );
+        auto bytes = static_cast< uint8_t const * >( data );
+        out.insert( out.end(), bytes, bytes + size );
+    };
+    if( ! stbi_write_jpg_to_func( write, &out, width, height, comp, pixels, quality ) )
+        throw std::runtime_error( "failed to JPEG-encode frame" );
+}
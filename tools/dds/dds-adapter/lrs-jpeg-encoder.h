@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <librealsense2/rs.hpp>  // Include RealSense Cross Platform API
+#include <vector>
+#include <cstdint>
+
+namespace tools {
+
+// Lossy, intra-frame (JPEG) compression of color frames, so more cameras can share the same network link.
+// Everything is done on the CPU: no hardware codec is needed.
+class lrs_jpeg_encoder
+{
+public:
+    // Name of the stream option controlling the quality
+    static char const * const option_name;
+    static int const min_quality = 1;
+    static int const max_quality = 100;
+
+    // Whether frames of the given format and width can be encoded
+    static bool can_encode( rs2_format, int width );
+
+    // Encode the frame into 'out' (replacing its content) with the given quality [1-100]; throws on failure
+    static void encode( rs2::video_frame const &, int quality, std::vector< uint8_t > & out );
+};  // class lrs_jpeg_encoder
+
+}  // namespace tools
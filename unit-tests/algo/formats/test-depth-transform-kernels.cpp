@@ -0,0 +1,126 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/depth-transform-kernels.cpp
+
+#include "../algo-common.h"
+#include <src/proc/depth-transform-kernels.h>
+
+#include <vector>
+#include <random>
+#include <limits>
+#include <cmath>
+
+using namespace librealsense;
+
+
+// D455-like: 95 mm baseline, fx=640, 5 fractional bits, 1 mm units
+static float const factor = 0.095f * 640.f * 32 / 0.001f;
+static float const depth_units = 0.001f;
+
+
+static std::vector< uint16_t > random_z16( int count, std::mt19937 & gen )
+{
+    std::uniform_int_distribution< int > value( 0, 0xffff );
+    std::vector< uint16_t > v( count );
+    for( auto & z : v )
+        z = value( gen ) % 5 ? uint16_t( value( gen ) ) : 0;
+    return v;
+}
+
+
+TEST_CASE( "z16 to meters" )
+{
+    std::mt19937 gen( 1 );
+    // Odd sizes, to cover the scalar tails
+    for( int count : { 1, 7, 8, 9, 17, 640 * 480 + 5 } )
+    {
+        CAPTURE( count );
+        auto z = random_z16( count, gen );
+        std::vector< float > out( count, -1.f );
+        z16_to_meters( out.data(), z.data(), count, depth_units );
+        for( int i = 0; i < count; ++i )
+            REQUIRE( out[i] == depth_units * z[i] );
+    }
+}
+
+
+TEST_CASE( "z16 to disparity and back" )
+{
+    std::mt19937 gen( 2 );
+    for( int count : { 1, 7, 8, 9, 17, 640 * 480 + 5 } )
+    {
+        CAPTURE( count );
+        auto z = random_z16( count, gen );
+        std::vector< float > disparity( count, -1.f );
+        z16_to_disparity( disparity.data(), z.data(), count, factor );
+        for( int i = 0; i < count; ++i )
+            REQUIRE( disparity[i] == ( z[i] ? factor / z[i] : 0.f ) );
+
+        std::vector< uint16_t > back( count, 0xbeef );
+        disparity_to_z16( back.data(), disparity.data(), count, factor );
+        for( int i = 0; i < count; ++i )
+        {
+            CAPTURE( z[i] );
+            REQUIRE( back[i] == uint16_t( disparity[i] ? uint16_t( factor / disparity[i] + 0.5f ) : 0 ) );
+            REQUIRE( std::abs( int( back[i] ) - int( z[i] ) ) <= 1 );
+        }
+    }
+}
+
+
+TEST_CASE( "disparity special values" )
+{
+    float const inf = std::numeric_limits< float >::infinity();
+    float const nan = std::numeric_limits< float >::quiet_NaN();
+    float const denormal = std::numeric_limits< float >::denorm_min();
+    // Too small a disparity gives a depth that does not fit in Z16
+    float const tiny = factor / 100000.f;
+    float const d250 = factor / 250.f, d65000 = factor / 65000.5f, d1234 = factor / 1234.f;
+    std::vector< float > disparity = { 0.f, inf, nan, denormal, -0.f, tiny, d250, d65000, 0.f, inf, nan, denormal, tiny, d250, d65000, d1234 };
+
+    std::vector< uint16_t > z( disparity.size() );
+    disparity_to_z16( z.data(), disparity.data(), int( z.size() ), factor );
+    std::vector< float > meters( disparity.size() );
+    disparity_to_meters( meters.data(), disparity.data(), int( z.size() ), factor, depth_units );
+
+    for( size_t i = 0; i < disparity.size(); ++i )
+    {
+        CAPTURE( i );
+        if( ! std::isnormal( disparity[i] ) )
+        {
+            CHECK( z[i] == 0 );
+            CHECK( meters[i] == 0.f );
+        }
+        else if( disparity[i] == tiny )
+        {
+            CHECK( z[i] == 65535 );
+            CHECK( meters[i] == Approx( 100.f ) );
+        }
+        else
+        {
+            CHECK( z[i] == uint16_t( factor / disparity[i] + 0.5f ) );
+            CHECK( meters[i] == Approx( factor / disparity[i] * depth_units ) );
+        }
+    }
+}
+
+
+TEST_CASE( "disparity to meters matches disparity to z16 to meters" )
+{
+    std::mt19937 gen( 3 );
+    int const count = 640 * 480 + 3;
+    auto z = random_z16( count, gen );
+    std::vector< float > disparity( count );
+    z16_to_disparity( disparity.data(), z.data(), count, factor );
+
+    std::vector< float > meters( count );
+    disparity_to_meters( meters.data(), disparity.data(), count, factor, depth_units );
+    for( int i = 0; i < count; ++i )
+    {
+        CAPTURE( z[i] );
+        // Without the rounding to Z16 in between, the result is within the Z16 resolution
+        REQUIRE( std::abs( meters[i] - depth_units * z[i] ) <= depth_units * ( 0.5f + z[i] * 1e-6f ) );
+    }
+}
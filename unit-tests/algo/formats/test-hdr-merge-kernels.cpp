@@ -0,0 +1,190 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/hdr-merge-kernels.cpp
+
+#include "../algo-common.h"
+#include <src/proc/hdr-merge-kernels.h>
+
+#include <vector>
+#include <random>
+#include <mutex>
+#include <thread>
+#include <set>
+#include <map>
+
+using namespace librealsense;
+
+
+// The per-pixel logic, as hdr_merge used to do it
+template< class T >
+static std::vector< uint16_t > reference_merge( const std::vector< uint16_t > & d0,
+                                                const std::vector< uint16_t > & d1,
+                                                const std::vector< T > * ir0,
+                                                const std::vector< T > * ir1,
+                                                T low,
+                                                T high )
+{
+    std::vector< uint16_t > out( d0.size() );
+    for( size_t i = 0; i < d0.size(); ++i )
+    {
+        if( ! ir0 )
+            out[i] = d0[i] ? d0[i] : ( d1[i] ? d1[i] : 0 );
+        else if( ( *ir0 )[i] > low && ( *ir0 )[i] < high && d0[i] )
+            out[i] = d0[i];
+        else if( ( *ir1 )[i] > low && ( *ir1 )[i] < high && d1[i] )
+            out[i] = d1[i];
+        else
+            out[i] = 0;
+    }
+    return out;
+}
+
+
+template< class T >
+static std::vector< T > random_values( size_t count, std::mt19937 & gen, int max_value, int zero_percent = 0 )
+{
+    std::uniform_int_distribution< int > value( 0, max_value );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< T > v( count );
+    for( auto & x : v )
+        x = percent( gen ) < zero_percent ? 0 : T( value( gen ) );
+    return v;
+}
+
+
+TEST_CASE( "hdr merge, depth only" )
+{
+    std::mt19937 gen( 1234 );
+    // Odd sizes, to cover the scalar tails
+    for( int count : { 1, 7, 8, 15, 16, 17, 33, 640 * 480 + 3 } )
+    {
+        CAPTURE( count );
+        auto d0 = random_values< uint16_t >( count, gen, 0xffff, 30 );
+        auto d1 = random_values< uint16_t >( count, gen, 0xffff, 30 );
+        std::vector< uint16_t > out( count, 0xbeef );
+        hdr_merge_depth_only( out.data(), d0.data(), d1.data(), count );
+        CHECK( out == reference_merge< uint16_t >( d0, d1, nullptr, nullptr, 0, 0 ) );
+    }
+}
+
+
+TEST_CASE( "hdr merge, using Y8 IR" )
+{
+    std::mt19937 gen( 5678 );
+    for( int count : { 1, 7, 8, 15, 16, 17, 33, 640 * 480 + 3 } )
+    {
+        CAPTURE( count );
+        auto d0 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+        auto d1 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+        auto ir0 = random_values< uint8_t >( count, gen, 0xff );
+        auto ir1 = random_values< uint8_t >( count, gen, 0xff );
+        std::vector< uint16_t > out( count, 0xbeef );
+        hdr_merge_using_ir( out.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, uint8_t( 5 ), uint8_t( 250 ) );
+        CHECK( out == reference_merge< uint8_t >( d0, d1, &ir0, &ir1, 5, 250 ) );
+    }
+}
+
+
+TEST_CASE( "hdr merge, using Y16 IR" )
+{
+    std::mt19937 gen( 9012 );
+    for( int count : { 1, 7, 8, 15, 16, 17, 33, 640 * 480 + 3 } )
+    {
+        CAPTURE( count );
+        auto d0 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+        auto d1 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+        // Mostly 10-bit values around the thresholds, but also some with the top bit set
+        auto ir0 = random_values< uint16_t >( count, gen, 1100 );
+        auto ir1 = random_values< uint16_t >( count, gen, 0xffff );
+        std::vector< uint16_t > out( count, 0xbeef );
+        hdr_merge_using_ir( out.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, uint16_t( 20 ), uint16_t( 1003 ) );
+        CHECK( out == reference_merge< uint16_t >( d0, d1, &ir0, &ir1, 20, 1003 ) );
+    }
+}
+
+
+TEST_CASE( "hdr merge, in bands" )
+{
+    std::mt19937 gen( 3456 );
+    int const width = 1280, height = 720;  // 3 bands of at least MIN_PIXELS_PER_BAND
+    int const count = width * height;
+    auto d0 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+    auto d1 = random_values< uint16_t >( count, gen, 0xffff, 20 );
+    auto ir0 = random_values< uint8_t >( count, gen, 0xff );
+    auto ir1 = random_values< uint8_t >( count, gen, 0xff );
+
+    // Not limited by the number of CPUs, so we split even on a single core
+    hdr_merge_bands bands( 4 );
+
+    std::mutex mutex;
+    std::map< int, int > band_sizes;  // by first pixel
+    std::set< std::thread::id > threads;
+    auto merge_into = [&]( std::vector< uint16_t > & out, bool use_ir )
+    {
+        band_sizes.clear();
+        threads.clear();
+        bands.run( width, height, [&]( int first, int n )
+        {
+            if( use_ir )
+                hdr_merge_using_ir( out.data() + first, d0.data() + first, d1.data() + first,
+                                    ir0.data() + first, ir1.data() + first, n, uint8_t( 5 ), uint8_t( 250 ) );
+            else
+                hdr_merge_depth_only( out.data() + first, d0.data() + first, d1.data() + first, n );
+            std::lock_guard< std::mutex > lock( mutex );
+            band_sizes[first] = n;
+            threads.insert( std::this_thread::get_id() );
+        } );
+    };
+
+    SECTION( "small frames are not split" )
+    {
+        std::vector< uint16_t > out( 640 * 480, 0xbeef );
+        bands.run( 640, 480, [&]( int first, int n )
+        {
+            hdr_merge_depth_only( out.data() + first, d0.data() + first, d1.data() + first, n );
+            band_sizes[first] = n;
+        } );
+        CHECK( band_sizes.size() == 1 );
+        CHECK( bands.n_workers() == 0 );
+    }
+
+    SECTION( "large frames are split, and the workers reused" )
+    {
+        for( int i = 0; i < 3; ++i )
+        {
+            CAPTURE( i );
+            bool const use_ir = i % 2 == 1;
+            std::vector< uint16_t > out( count, 0xbeef );
+            merge_into( out, use_ir );
+            if( use_ir )
+                CHECK( out == reference_merge< uint8_t >( d0, d1, &ir0, &ir1, 5, 250 ) );
+            else
+                CHECK( out == reference_merge< uint16_t >( d0, d1, nullptr, nullptr, 0, 0 ) );
+
+            // The bands cover the frame, in whole rows
+            REQUIRE( band_sizes.size() == 3 );
+            int next = 0;
+            for( auto & band : band_sizes )
+            {
+                CHECK( band.first == next );
+                CHECK( band.second % width == 0 );
+                next = band.first + band.second;
+            }
+            CHECK( next == count );
+            CHECK( threads.size() == 3 );
+            CHECK( bands.n_workers() == 2 );
+        }
+    }
+
+    SECTION( "an exception in any band is passed on" )
+    {
+        CHECK_THROWS( bands.run( width, height, []( int first, int n )
+        {
+            if( first )
+                throw std::runtime_error( "band failed" );
+        } ) );
+        CHECK_NOTHROW( bands.run( width, height, []( int, int ) {} ) );
+    }
+}
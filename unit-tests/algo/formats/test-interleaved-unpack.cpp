@@ -0,0 +1,132 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/interleaved-unpack.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-interleaved.cpp
+//#cmake:add-file ../../../src/proc/neon/neon-interleaved.cpp
+
+#include "../algo-common.h"
+#include <src/proc/interleaved-unpack.h>
+
+#include <vector>
+#include <random>
+#include <initializer_list>
+
+using namespace librealsense;
+
+
+// The original per-pixel implementations, which all others must match bit for bit
+namespace reference {
+
+struct y8i_pixel { uint8_t l, r; };
+struct y12i_pixel { uint8_t rl : 8, rh : 4, ll : 4, lh : 8; int l() const { return lh << 4 | ll; } int r() const { return rh << 8 | rl; } };
+struct y12i_pixel_mipi { uint8_t rl : 8, rh : 4, ll : 4, lh : 8, padding : 8; int l() const { return lh << 4 | ll; } int r() const { return rh << 8 | rl; } };
+struct y16i_pixel { uint16_t left : 16, right : 16; int l() const { return left; } int r() const { return right; } };
+
+template< class SOURCE, class T >
+void split( std::vector< T > & a, std::vector< T > & b, const uint8_t * source, int count, bool mipi = false )
+{
+    auto px = reinterpret_cast< const SOURCE * >( source );
+    for( int i = 0; i < count; i += 2 )
+    {
+        a[i] = mipi ? px[i + 1].l : px[i].l;
+        b[i] = px[i].r;
+        a[i + 1] = mipi ? px[i].l : px[i + 1].l;
+        b[i + 1] = px[i + 1].r;
+    }
+}
+
+template< class SOURCE >
+void split_10bit( std::vector< uint16_t > & a, std::vector< uint16_t > & b, const uint8_t * source, int count )
+{
+    auto px = reinterpret_cast< const SOURCE * >( source );
+    for( int i = 0; i < count; ++i )
+    {
+        a[i] = uint16_t( px[i].l() << 6 | px[i].l() >> 4 );
+        b[i] = uint16_t( px[i].r() << 6 | px[i].r() >> 4 );
+    }
+}
+
+}  // namespace reference
+
+
+static std::vector< uint8_t > random_bytes( size_t n )
+{
+    std::mt19937 gen( 1234 );
+    std::uniform_int_distribution< int > dist( 0, 255 );
+    std::vector< uint8_t > bytes( n );
+    for( auto & b : bytes )
+        b = uint8_t( dist( gen ) );
+    return bytes;
+}
+
+
+static std::vector< interleaved_impl > available_impls()
+{
+    std::vector< interleaved_impl > impls;
+    for( auto impl : { interleaved_impl::best,
+                       interleaved_impl::scalar,
+                       interleaved_impl::ssse3,
+                       interleaved_impl::avx2,
+                       interleaved_impl::neon } )
+        if( is_available( impl ) )
+            impls.push_back( impl );
+    return impls;
+}
+
+
+// Even counts (pairs are needed for MIPI), including ones that leave partial vectors at the end
+static const int counts[] = { 2, 6, 16, 30, 32, 62, 64, 66, 98, 1280 * 2 + 14 };
+
+
+template< class T, class SPLIT, class REFERENCE >
+void check_split( size_t bytes_per_pixel, SPLIT split, REFERENCE reference )
+{
+    for( auto impl : available_impls() )
+    {
+        for( int count : counts )
+        {
+            CAPTURE( int( impl ) );
+            CAPTURE( count );
+            auto source = random_bytes( count * bytes_per_pixel );
+            std::vector< T > left( count ), right( count ), expected_left( count ), expected_right( count );
+            reference( expected_left, expected_right, source.data(), count );
+            uint8_t * const dest[] = { reinterpret_cast< uint8_t * >( left.data() ),
+                                       reinterpret_cast< uint8_t * >( right.data() ) };
+            split( dest, source.data(), count, impl );
+            CHECK( left == expected_left );
+            CHECK( right == expected_right );
+        }
+    }
+}
+
+
+TEST_CASE( "y8i" )
+{
+    check_split< uint8_t >( 2, split_y8i, []( std::vector< uint8_t > & a, std::vector< uint8_t > & b, const uint8_t * s, int n ) {
+        reference::split< reference::y8i_pixel >( a, b, s, n );
+    } );
+}
+
+TEST_CASE( "y8i mipi" )
+{
+    check_split< uint8_t >( 2, split_y8i_mipi, []( std::vector< uint8_t > & a, std::vector< uint8_t > & b, const uint8_t * s, int n ) {
+        reference::split< reference::y8i_pixel >( a, b, s, n, true );
+    } );
+}
+
+TEST_CASE( "y12i" )
+{
+    check_split< uint16_t >( 3, split_y12i, reference::split_10bit< reference::y12i_pixel > );
+}
+
+TEST_CASE( "y12i mipi" )
+{
+    check_split< uint16_t >( 4, split_y12i_mipi, reference::split_10bit< reference::y12i_pixel_mipi > );
+}
+
+TEST_CASE( "y16i 10msb" )
+{
+    check_split< uint16_t >( 4, split_y16i_10msb, reference::split_10bit< reference::y16i_pixel > );
+}
@@ -0,0 +1,116 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/rotate-image.cpp
+
+#include "../algo-common.h"
+#include <src/proc/rotate-image.h>
+
+#include <vector>
+#include <cstring>
+
+using namespace librealsense;
+
+
+// Straightforward per-pixel rotation, as rotation_filter used to do it
+static std::vector< uint8_t > reference_rotate( const std::vector< uint8_t > & source, int width, int height, int bpp, int angle )
+{
+    std::vector< uint8_t > out( source.size() );
+    for( int i = 0; i < height; ++i )
+    {
+        for( int j = 0; j < width; ++j )
+        {
+            size_t src_index = ( size_t( i ) * width + j ) * bpp;
+            size_t out_index;
+            if( angle == 90 )
+                out_index = ( size_t( j ) * height + ( height - i - 1 ) ) * bpp;
+            else if( angle == -90 )
+                out_index = ( size_t( width - j - 1 ) * height + i ) * bpp;
+            else
+                out_index = ( size_t( height - i - 1 ) * width + ( width - j - 1 ) ) * bpp;
+            std::memcpy( &out[out_index], &source[src_index], bpp );
+        }
+    }
+    return out;
+}
+
+
+static std::vector< uint8_t > make_image( int width, int height, int bpp )
+{
+    std::vector< uint8_t > image( size_t( width ) * height * bpp );
+    for( size_t i = 0; i < image.size(); ++i )
+        image[i] = uint8_t( i * 7 + i / 251 );
+    return image;
+}
+
+
+TEST_CASE( "rotate" )
+{
+    // Sizes that are, and are not, multiples of the blocks and tiles
+    struct { int width, height; } const sizes[] = { { 8, 8 }, { 16, 8 }, { 64, 64 }, { 70, 13 }, { 13, 70 }, { 1, 5 }, { 640, 480 }, { 130, 66 } };
+    for( int bpp = 1; bpp <= 4; ++bpp )
+    {
+        for( auto size : sizes )
+        {
+            for( int angle : { 90, -90, 180 } )
+            {
+                // With SSE (where the build has it) and without
+                for( bool simd : { true, false } )
+                {
+                    CAPTURE( bpp, size.width, size.height, angle, simd );
+                    auto source = make_image( size.width, size.height, bpp );
+                    std::vector< uint8_t > out( source.size() );
+                    rotate_image( out.data(), source.data(), size.width, size.height, bpp, angle, simd );
+                    CHECK( out == reference_rotate( source, size.width, size.height, bpp, angle ) );
+                }
+            }
+        }
+    }
+}
+
+
+TEST_CASE( "rotate YUYV" )
+{
+    int const width = 64, height = 48;
+    auto source = make_image( width, height, 2 );
+    std::vector< uint8_t > out( source.size() );
+    std::vector< uint32_t > scratch;
+
+    SECTION( "180 keeps the pairs together" )
+    {
+        rotate_yuyv( out.data(), source.data(), width, height, 180, scratch );
+        CHECK( out == reference_rotate( source, width / 2, height, 4, 180 ) );
+    }
+
+    for( int angle : { 90, -90 } )
+    {
+        CAPTURE( angle );
+        rotate_yuyv( out.data(), source.data(), width, height, angle, scratch );
+
+        // Y must be rotated exactly
+        std::vector< uint8_t > y( size_t( width ) * height );
+        for( size_t i = 0; i < y.size(); ++i )
+            y[i] = source[2 * i];
+        auto expected_y = reference_rotate( y, width, height, 1, angle );
+        for( size_t i = 0; i < y.size(); ++i )
+            REQUIRE( out[2 * i] == expected_y[i] );
+
+        // U and V are the averages of the two source pairs that make up each new pair
+        std::vector< uint8_t > u( y.size() ), v( y.size() );
+        for( size_t i = 0; i < y.size(); ++i )
+        {
+            u[i] = source[( i & ~size_t( 1 ) ) * 2 + 1];
+            v[i] = source[( i & ~size_t( 1 ) ) * 2 + 3];
+        }
+        auto expected_u = reference_rotate( u, width, height, 1, angle );
+        auto expected_v = reference_rotate( v, width, height, 1, angle );
+        for( size_t i = 0; i < y.size(); i += 2 )
+        {
+            REQUIRE( out[2 * i + 1] == ( expected_u[i] + expected_u[i + 1] + 1 ) / 2 );
+            REQUIRE( out[2 * i + 3] == ( expected_v[i] + expected_v[i + 1] + 1 ) / 2 );
+        }
+    }
+
+    CHECK_THROWS( rotate_yuyv( out.data(), source.data(), width, height - 1, 90, scratch ) );
+}
@@ -0,0 +1,401 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#test:donotrun:!nightly
+//#test:timeout 300
+
+// Microbenchmarks of the frame plumbing: how many operations per second each piece sustains, and how many heap
+// allocations each operation costs, with frames coming from a software device. The multi-threaded scenarios show what
+// lock contention costs. Nothing here fails on timing: the numbers are printed, to be compared between builds.
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <src/core/frame-holder.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using librealsense::frame_holder;
+using librealsense::frame_interface;
+
+
+// Every heap allocation in the process: the library is linked statically, so its own are counted, too
+static std::atomic< uint64_t > n_allocations( 0 );
+
+void * operator new( size_t size )
+{
+    ++n_allocations;
+    if( void * p = std::malloc( size ? size : 1 ) )
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p ) noexcept
+{
+    std::free( p );
+}
+
+
+// Each measurement runs for at least this long, to smooth out the noise
+static double const min_seconds = .25;
+
+// Frames are tiny: we want to measure the plumbing, not the pixels
+static int const width = 64;
+static int const height = 48;
+
+
+struct measurement
+{
+    uint64_t ops = 0;
+    double seconds = 0;
+    uint64_t allocations = 0;
+};
+
+
+static void report( std::string const & name, measurement const & m )
+{
+    std::cout << std::left << std::setw( 56 ) << name << std::right << std::fixed << std::setprecision( 0 )
+              << std::setw( 12 ) << m.ops / m.seconds << " ops/s" << std::setprecision( 1 ) << std::setw( 10 )
+              << m.seconds * 1e9 / m.ops << " ns/op" << std::setprecision( 2 ) << std::setw( 8 )
+              << double( m.allocations ) / m.ops << " allocs/op" << std::endl;
+}
+
+
+// Runs the batch again and again until enough time has passed; the batch returns how many operations it did
+template< class Batch >
+static measurement measure( std::string const & name, Batch && batch )
+{
+    batch();  // warm-up: we are not after first-time allocations
+    measurement m;
+    auto const allocations = n_allocations.load();
+    auto const start = std::chrono::steady_clock::now();
+    do
+    {
+        m.ops += batch();
+        m.seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+    }
+    while( m.seconds < min_seconds );
+    m.allocations = n_allocations - allocations;
+    report( name, m );
+    return m;
+}
+
+
+// The same batch, on several threads at once; returns the total of all of them
+template< class Batch >
+static uint64_t on_threads( int n_threads, Batch && batch )
+{
+    std::atomic< uint64_t > ops( 0 );
+    std::vector< std::thread > threads;
+    for( int i = 0; i < n_threads; ++i )
+        threads.emplace_back( [&]() { ops += batch(); } );
+    for( auto & th : threads )
+        th.join();
+    return ops;
+}
+
+
+// Producers each push n items while one consumer pops them, until all were either popped or dropped. The pop waits a
+// little for an item, and returns false if none came.
+template< class Push, class Pop >
+static uint64_t produce_consume( int n_producers, int n, Push && push, Pop && pop )
+{
+    std::atomic< int > producing( n_producers );
+    std::thread consumer( [&]() {
+        while( true )
+        {
+            if( pop() )
+                continue;
+            if( ! producing )
+            {
+                while( pop() )
+                    ;
+                break;
+            }
+        }
+    } );
+    on_threads( n_producers, [&]() {
+        for( int i = 0; i < n; ++i )
+            push();
+        --producing;
+        return 0;
+    } );
+    consumer.join();
+    return uint64_t( n_producers ) * n;
+}
+
+
+// A video stream of a software device
+class sw_stream
+{
+public:
+    sw_stream( rs2::software_device & dev, std::string const & name, rs2_stream type, int uid, rs2_format format, int bpp )
+        : _sensor( dev.add_sensor( name ) )
+        , _pixels( width * height * bpp )
+        , _bpp( bpp )
+    {
+        rs2_intrinsics intrinsics = { width, height, width / 2.f, height / 2.f, float( width ), float( width ),
+                                      RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        _profile = _sensor.add_video_stream( { type, 0, uid, width, height, 30, bpp, format, intrinsics } );
+        _sensor.open( _profile );
+    }
+
+    ~sw_stream()
+    {
+        _sensor.stop();
+        _sensor.close();
+    }
+
+    rs2::software_sensor & sensor() { return _sensor; }
+
+    void generate( double timestamp )
+    {
+        rs2_software_video_frame f;
+        f.pixels = _pixels.data();
+        f.deleter = []( void * ) {};  // the pixels are ours
+        f.stride = width * _bpp;
+        f.bpp = _bpp;
+        f.timestamp = timestamp;
+        f.domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
+        f.frame_number = ++_frame_number;
+        f.profile = _profile.get();
+        f.depth_units = 0;
+        _sensor.on_video_frame( f );
+    }
+
+    void generate() { generate( _frame_number * 1000. / 30 ); }
+
+private:
+    rs2::software_sensor _sensor;
+    rs2::stream_profile _profile;
+    std::vector< uint8_t > _pixels;
+    int _bpp;
+    int _frame_number = 0;
+};
+
+
+// One frame, held for the whole test
+static rs2::frame get_frame( sw_stream & stream )
+{
+    rs2::frame_queue q( 1 );
+    stream.sensor().start( q );
+    stream.generate();
+    rs2::frame f;
+    REQUIRE( q.try_wait_for_frame( &f, 1000 ) );
+    stream.sensor().stop();
+    f.keep();
+    return f;
+}
+
+
+TEST_CASE( "frame_archive" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+
+    SECTION( "allocate, publish and release" )
+    {
+        std::atomic< uint64_t > received( 0 );
+        depth.sensor().start( [&]( rs2::frame ) { ++received; } );
+        auto m = measure( "frame_archive: allocate, publish, release", [&]() {
+            for( int i = 0; i < 1000; ++i )
+                depth.generate();
+            return 1000;
+        } );
+        CHECK( received == m.ops + 1000 );  // with the warm-up
+    }
+
+    SECTION( "released on another thread" )
+    {
+        // The frames go back to the archive from the consumer, while the producer allocates more
+        rs2::frame_queue q( 16 );
+        depth.sensor().start( q );
+        measure( "frame_archive: released by a consumer thread", [&]() {
+            return produce_consume(
+                1, 1000,
+                [&]() { depth.generate(); },
+                [&]() {
+                    rs2::frame f;
+                    return q.try_wait_for_frame( &f, 10 );
+                } );
+        } );
+    }
+}
+
+
+TEST_CASE( "frame_holder" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+    auto f = get_frame( depth );
+    auto fi = (frame_interface *)f.get();
+
+    auto acquire_release = [fi]() {
+        for( int i = 0; i < 10000; ++i )
+            auto holder = frame_holder::acquire( fi );
+        return 10000;
+    };
+    measure( "frame_holder: acquire and release", acquire_release );
+
+    // All threads hold the same frame, so they contend on its ref-count
+    for( int n_threads : { 2, 4, 8 } )
+        measure( "frame_holder: acquire and release, " + std::to_string( n_threads ) + " threads",
+                 [&]() { return on_threads( n_threads, acquire_release ); } );
+}
+
+
+TEST_CASE( "single_consumer_frame_queue" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+    auto f = get_frame( depth );
+    auto fi = (frame_interface *)f.get();
+
+    std::atomic< uint64_t > dropped( 0 );
+    single_consumer_frame_queue< frame_holder > q( QUEUE_MAX_SIZE,
+                                                   [&]( frame_holder const & ) { ++dropped; } );
+
+    measure( "single_consumer_frame_queue: enqueue and dequeue", [&]() {
+        frame_holder out;
+        for( int i = 0; i < 10000; ++i )
+        {
+            q.enqueue( frame_holder::acquire( fi ) );
+            q.try_dequeue( &out );
+        }
+        return 10000;
+    } );
+    CHECK( dropped == 0 );
+
+    for( int n_producers : { 1, 4 } )
+    {
+        dropped = 0;
+        auto m = measure( "single_consumer_frame_queue: " + std::to_string( n_producers ) + " producers, 1 consumer",
+                          [&]() {
+                              return produce_consume(
+                                  n_producers, 10000,
+                                  [&]() { q.enqueue( frame_holder::acquire( fi ) ); },
+                                  [&]() {
+                                      frame_holder out;
+                                      return q.dequeue( &out, 10 );
+                                  } );
+                          } );
+        std::cout << "    dropped " << std::setprecision( 1 ) << dropped * 100. / m.ops << "%" << std::endl;
+    }
+    CHECK( q.empty() );
+}
+
+
+TEST_CASE( "rs2_frame_queue" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+    auto f = get_frame( depth );
+
+    rs2::frame_queue q( QUEUE_MAX_SIZE );
+    measure( "rs2_frame_queue: enqueue and poll", [&]() {
+        rs2::frame out;
+        for( int i = 0; i < 10000; ++i )
+        {
+            q.enqueue( f );
+            q.poll_for_frame( &out );
+        }
+        return 10000;
+    } );
+
+    for( int n_producers : { 1, 4 } )
+        measure( "rs2_frame_queue: " + std::to_string( n_producers ) + " producers, 1 consumer", [&]() {
+            return produce_consume(
+                n_producers, 10000,
+                [&]() { q.enqueue( f ); },
+                [&]() {
+                    rs2::frame out;
+                    return q.try_wait_for_frame( &out, 10 );
+                } );
+        } );
+}
+
+
+TEST_CASE( "composite_matcher" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+    sw_stream color( dev, "Color", RS2_STREAM_COLOR, 1, RS2_FORMAT_RGB8, 3 );
+    dev.create_matcher( RS2_MATCHER_DEFAULT );
+
+    rs2::syncer sync( 100 );
+    depth.sensor().start( sync );
+    color.sensor().start( sync );
+
+    // Each operation is a depth and a color frame, of the same timestamp, synchronized into a frameset
+    uint64_t framesets = 0;
+    auto m = measure( "composite_matcher: depth + color", [&]() {
+        rs2::frameset fs;
+        for( int i = 0; i < 1000; ++i )
+        {
+            depth.generate();
+            color.generate();
+            while( sync.poll_for_frames( &fs ) )
+                ++framesets;
+        }
+        return 1000;
+    } );
+    CHECK( framesets >= m.ops );
+
+    // Each stream from its own thread, as sensors would, while the framesets are consumed on a third
+    measure( "composite_matcher: depth + color, each on its own thread", [&]() {
+        std::atomic< bool > producing( true );
+        std::thread consumer( [&]() {
+            rs2::frameset fs;
+            while( producing )
+                sync.try_wait_for_frames( &fs, 10 );
+            while( sync.poll_for_frames( &fs ) )
+                ;
+        } );
+        std::thread color_producer( [&]() {
+            for( int i = 0; i < 1000; ++i )
+                color.generate();
+        } );
+        for( int i = 0; i < 1000; ++i )
+            depth.generate();
+        color_producer.join();
+        producing = false;
+        consumer.join();
+        return 1000;
+    } );
+}
+
+
+TEST_CASE( "metadata lookup" )
+{
+    rs2::software_device dev;
+    sw_stream depth( dev, "Depth", RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 2 );
+    depth.sensor().set_metadata( RS2_FRAME_METADATA_FRAME_COUNTER, 1 );
+    depth.sensor().set_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE, 8500 );
+    depth.sensor().set_metadata( RS2_FRAME_METADATA_SENSOR_TIMESTAMP, 123456 );
+    auto f = get_frame( depth );
+    REQUIRE( f.supports_frame_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE ) );
+
+    rs2_metadata_type sum = 0;
+    measure( "metadata: supported value", [&]() {
+        for( int i = 0; i < 10000; ++i )
+            if( f.supports_frame_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE ) )
+                sum += f.get_frame_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE );
+        return 10000;
+    } );
+    measure( "metadata: unsupported value", [&]() {
+        for( int i = 0; i < 10000; ++i )
+            if( f.supports_frame_metadata( RS2_FRAME_METADATA_GAIN_LEVEL ) )
+                sum += f.get_frame_metadata( RS2_FRAME_METADATA_GAIN_LEVEL );
+        return 10000;
+    } );
+    CHECK( sum > 0 );
+}
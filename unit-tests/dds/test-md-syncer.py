@@ -399,4 +399,51 @@ with test.closure( 'Two threads, slow callback -> different callbacks interleave
     test.check_equal( len(dropped_metadata), 0 )
 
 
+with test.closure( 'Pipelined: image without metadata -> out after max-wait' ):
+    syncer = new_syncer()
+    syncer.set_max_wait( 0.1 )
+    test.check( syncer.is_pipelined() )
+    syncer.enqueue_frame( 1, new_image( 1 ) )
+    sleep( 0.03 )
+    test.check_equal( last_frame(), None )
+    sleep( 0.2 )
+    if test.check( last_frame() is not None ):
+        test.check_equal( image_id( last_image() ), 1 )
+        test.check_equal( last_metadata(), None )
+    stats = syncer.get_statistics()
+    test.check_equal( stats['frames'], 1 )
+    test.check_equal( stats['matched'], 0 )
+    test.check_equal( stats['timed-out'], 1 )
+    test.check_equal( sum( stats['wait']['counts'] ), 1 )
+
+with test.closure( 'Pipelined: metadata+image -> out without waiting' ):
+    syncer = new_syncer()
+    syncer.set_max_wait( 1 )
+    syncer.enqueue_metadata( 0, new_metadata( 0 ) )
+    syncer.enqueue_frame( 0, new_image( 0 ) )
+    sleep( 0.1 )  # much less than max-wait
+    if test.check( last_frame() is not None ):
+        test.check_equal( image_id( last_image() ), 0 )
+        test.check_equal( md_id( last_metadata() ), 0 )
+    stats = syncer.get_statistics()
+    test.check_equal( stats['matched'], 1 )
+    test.check_equal( stats['timed-out'], 0 )
+    test.check_equal( stats['match-rate'], 1. )
+
+with test.closure( 'Pipelined: lost metadata -> match rate' ):
+    syncer = new_syncer()
+    syncer.set_max_wait( 0.05 )
+    for i in range( 4 ):
+        if i % 2:
+            syncer.enqueue_metadata( i, new_metadata( i ) )
+        syncer.enqueue_frame( i, new_image( i ) )
+    sleep( 0.2 )
+    test.check_equal( len(received_frames), 4 )
+    stats = syncer.get_statistics()
+    test.check_equal( stats['frames'], 4 )
+    test.check_equal( stats['matched'], 2 )
+    test.check_equal( stats['match-rate'], 0.5 )
+    test.check_equal( len(dropped_metadata), 0 )
+
+
 test.print_results_and_exit()
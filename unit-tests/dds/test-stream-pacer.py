@@ -0,0 +1,152 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#test:donotrun:!dds
+
+from rspy import log, test
+import pyrealdds as dds
+import threading
+import time
+
+dds.debug( log.is_debug_on() )
+
+# The pacer writes nothing itself: it calls whatever we enqueue, so we can see the order writes are done in without
+# anybody actually reading the streams
+settings = { 'device': { 'pacing': {
+    'stats-period': 0,
+    'depth': { 'priority': 0, 'deadline': 0, 'max-pending': 4 },
+    'ir':    { 'priority': 1, 'deadline': 0.2, 'max-pending': 4 },
+    'color': { 'priority': 2, 'deadline': 0, 'max-pending': 4 } } } }
+
+participant = dds.participant()
+participant.init( 123, 'test-stream-pacer', settings )
+publisher = dds.publisher( participant )
+
+def open_stream( stream, encoding ):
+    stream.init_profiles( [dds.video_stream_profile( 30, encoding, 640, 480 )], 0 )
+    stream.open( 'realsense/pacer-test/' + stream.name(), publisher )
+    return stream
+
+depth = open_stream( dds.depth_stream_server( 'Depth', 'Stereo Module' ), dds.video_encoding.z16 )
+ir = open_stream( dds.ir_stream_server( 'Infrared', 'Stereo Module' ), dds.video_encoding.y8 )
+color = open_stream( dds.color_stream_server( 'Color', 'RGB Camera' ), dds.video_encoding.yuyv )
+
+pacer = dds.stream_pacer( participant )
+index = { stream.name(): pacer.add_stream( stream ) for stream in [depth, ir, color] }
+
+written = []
+all_written = threading.Event()
+n_expected = 0
+
+def enqueue( stream_name, label ):
+    def write():
+        written.append( label )
+        if len( written ) == n_expected:
+            all_written.set()
+    pacer.enqueue( index[stream_name], 1000, write )
+
+def block_sender():
+    """
+    Enqueue a color write that holds the sender until the returned event is set, so the writes we enqueue in the
+    meantime all wait together
+    """
+    started = threading.Event()
+    release = threading.Event()
+    def write():
+        started.set()
+        release.wait()
+        written.append( 'blocker' )
+    pacer.enqueue( index['Color'], 1000, write )
+    test.check( started.wait( 5 ) )
+    return release
+
+def expect( labels ):
+    test.check( all_written.wait( 5 ) )
+    test.check_equal( written, labels )
+    written.clear()
+    all_written.clear()
+
+def dropped( stream_name ):
+    return pacer.get_stats()[stream_name]['dropped']
+
+
+#############################################################################################
+#
+with test.closure( 'the most important stream is written first' ):
+    release = block_sender()
+    enqueue( 'Color', 'color' )
+    enqueue( 'Infrared', 'ir' )
+    enqueue( 'Depth', 'depth' )
+    n_expected = 4
+    release.set()
+    expect( ['blocker', 'depth', 'ir', 'color'] )
+
+#############################################################################################
+#
+with test.closure( 'within a stream, order is kept' ):
+    release = block_sender()
+    for i in range( 3 ):
+        enqueue( 'Depth', f'depth{i}' )
+    n_expected = 4
+    release.set()
+    expect( ['blocker', 'depth0', 'depth1', 'depth2'] )
+
+#############################################################################################
+#
+with test.closure( 'frames past their deadline are dropped' ):
+    n_dropped = dropped( 'Infrared' )
+    release = block_sender()
+    enqueue( 'Infrared', 'late' )
+    time.sleep( 0.3 )  # past the 0.2 deadline
+    enqueue( 'Infrared', 'on-time' )
+    n_expected = 2
+    release.set()
+    expect( ['blocker', 'on-time'] )
+    test.check_equal( dropped( 'Infrared' ), n_dropped + 1 )
+
+#############################################################################################
+#
+with test.closure( 'color has no deadline' ):
+    release = block_sender()
+    enqueue( 'Color', 'late' )
+    time.sleep( 0.3 )
+    n_expected = 2
+    release.set()
+    expect( ['blocker', 'late'] )
+
+#############################################################################################
+#
+with test.closure( 'the oldest pending frames are replaced' ):
+    n_dropped = dropped( 'Depth' )
+    release = block_sender()
+    for i in range( 6 ):  # max-pending is 4
+        enqueue( 'Depth', f'depth{i}' )
+    n_expected = 5
+    release.set()
+    expect( ['blocker', 'depth2', 'depth3', 'depth4', 'depth5'] )
+    test.check_equal( dropped( 'Depth' ), n_dropped + 2 )
+
+#############################################################################################
+#
+with test.closure( 'sent frames are counted' ):
+    time.sleep( 0.1 )  # a write is only counted once it returns, after our event was set
+    stats = pacer.get_stats()
+    test.check_equal( stats['Depth']['sent'], 1 + 3 + 4 )
+    test.check_equal( stats['Infrared']['sent'], 2 )
+    test.check_equal( stats['Color']['sent'], 2 + 5 )  # the first test's, then a blocker in each test, and 'late'
+
+#############################################################################################
+#
+with test.closure( 'publish_image does not take the caller\'s image' ):
+    color.set_pacer( pacer )
+    color.start_streaming( dds.video_encoding.yuyv, 640, 480 )
+    image = dds.message.image()
+    image.width = 640
+    image.height = 480
+    image.data = bytearray( 640 * 480 * 2 )
+    color.publish_image( image )
+    test.check_equal( len( image.data ), 640 * 480 * 2 )
+    color.stop_streaming()
+
+del pacer
+test.print_results_and_exit()
@@ -0,0 +1,40 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+# test:device each(D400*)
+
+import pyrealsense2 as rs
+from rspy import test
+import json
+
+dev, ctx = test.find_first_device_or_exit()
+serial = dev.get_info( rs.camera_info.serial_number )
+del dev
+
+with test.closure( 'create_all' ):
+    devices, errors = ctx.query_devices().create_all()
+    test.check( len( devices ) > 0 )
+    test.check_equal( len( devices ), len( errors ) )
+    found = None
+    for d, e in zip( devices, errors ):
+        test.check_equal( bool( d ), not e )
+        if d and d.get_info( rs.camera_info.serial_number ) == serial:
+            found = d
+    test.check( found )
+
+with test.closure( 'open phases are reported' ):
+    stats = json.loads( found.get_statistics() )
+    phases = [phase['name'] for phase in stats['open-phases']]
+    test.check_equal( phases[:2], ['queued', 'create'] )
+    test.check( 'depth-sensor' in phases )
+    test.check( all( phase['ms'] >= 0 for phase in stats['open-phases'] ) )
+    del found
+    del devices
+
+with test.closure( 'single device is timed, too' ):
+    dev = ctx.query_devices()[0]
+    stats = json.loads( dev.get_statistics() )
+    test.check( 'open-phases' in stats )
+    del dev
+
+test.print_results_and_exit()
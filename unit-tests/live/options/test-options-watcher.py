@@ -48,6 +48,14 @@ with test.closure( 'set multiple options' ):
     test.check_equal( changed_options, 2 )
     changed_options = 0
 
+with test.closure( 'local changes are notified without waiting for the update interval' ):
+    changed_options = 0
+    current_gain = depth_sensor.get_option( rs.option.gain )
+    depth_sensor.set_option( rs.option.gain , current_gain + 1 )
+    time.sleep( 0.3 ) # well below the 1 second update interval
+    test.check_equal( changed_options, 1 )
+    changed_options = 0
+
 with test.closure( 'no sporadic changes' ):
     changed_options = 0
     time.sleep( 3 )
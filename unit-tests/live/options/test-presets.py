@@ -45,6 +45,17 @@ with test.closure( 'save/load preset' ):
     am_dev.load_json( saved_values )
     test.check( am_dev.get_depth_control().textureCountThreshold != 250 )
 
+with test.closure( 're-load unchanged preset' ):
+    # Groups the device already has are not written again; the values must still be right
+    expected = am_dev.get_depth_control().textureCountThreshold
+    am_dev.load_json( saved_values )
+    test.check_equal( am_dev.get_depth_control().textureCountThreshold, expected )
+    depth_control_group = am_dev.get_depth_control()
+    depth_control_group.textureCountThreshold = 250
+    am_dev.set_depth_control( depth_control_group )
+    am_dev.load_json( saved_values )
+    test.check_equal( am_dev.get_depth_control().textureCountThreshold, expected )
+
 with test.closure( 'setting color options' ):
     # Using Hue to test if setting visual preset changes color sensor settings.
     # Not all cameras support Hue (e.g. D457) but using common setting like Gain or Exposure is dependant on auto-exposure logic
@@ -0,0 +1,69 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+from rspy import log, test
+import pyrealsense2 as rs
+import common
+import tempfile
+
+
+def count_messages( filename ):
+    messages = dropped = 0
+    for line in open( filename, 'rt' ).read().split( '\n' ):
+        if 'async message' in line:
+            messages += 1
+        elif 'log lines dropped' in line:
+            dropped += int( line.split()[1] )
+    return messages, dropped
+
+
+#############################################################################################
+#
+test.start( "Async logging, nothing dropped" )
+
+try:
+    filename = tempfile.mktemp()
+    log.d( f'logging to: {filename}' )
+    rs.enable_async_logging( 100000 )
+    rs.log_to_file( rs.log_severity.info, filename )
+    drops_before = rs.get_log_drop_count()
+
+    for i in range( 10000 ):
+        rs.log( rs.log_severity.info, f'async message {i}' )
+    rs.log( rs.log_severity.debug, 'async message: below the minimum severity' )
+    rs.reset_logger()  # Should write everything that's queued!
+
+    test.check_equal( count_messages( filename ), ( 10000, 0 ) )
+    test.check_equal( rs.get_log_drop_count(), drops_before )
+except:
+    test.unexpected_exception()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Async logging, full queue" )
+
+try:
+    filename = tempfile.mktemp()
+    log.d( f'logging to: {filename}' )
+    rs.enable_async_logging( 16 )
+    rs.log_to_file( rs.log_severity.info, filename )
+    drops_before = rs.get_log_drop_count()
+
+    for i in range( 10000 ):
+        rs.log( rs.log_severity.info, f'async message {i}' )
+    rs.reset_logger()
+
+    # Whatever we cannot find in the file must have been dropped, and noted as such
+    n_messages, n_dropped = count_messages( filename )
+    log.d( f'{n_messages} written, {n_dropped} dropped' )
+    test.check_equal( n_messages + n_dropped, 10000 )
+    test.check_equal( rs.get_log_drop_count() - drops_before, n_dropped )
+except:
+    test.unexpected_exception()
+
+test.finish()
+#
+#############################################################################################
+test.print_results_and_exit()
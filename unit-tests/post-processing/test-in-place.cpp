@@ -0,0 +1,106 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Processing blocks that opt in (e.g., threshold) modify their input frame in place when the caller gave it up, and
+// allocate a new frame otherwise.
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+
+static int const width = 64;
+static int const height = 48;
+
+
+// One Z16 frame, with depth going from 0 to 4.7m (in mm) across the image
+static rs2::frame make_depth_frame( rs2::software_device & dev )
+{
+    auto sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intrinsics = { width, height, width / 2.f, height / 2.f, float( width ), float( width ),
+                                  RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    auto profile = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, width, height, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+    sensor.open( profile );
+    rs2::frame_queue q( 1 );
+    sensor.start( q );
+
+    std::vector< uint16_t > pixels( width * height );
+    for( size_t i = 0; i < pixels.size(); ++i )
+        pixels[i] = uint16_t( i % width * 75 );
+    rs2_software_video_frame f;
+    f.pixels = pixels.data();
+    f.deleter = []( void * ) {};  // the pixels are ours
+    f.stride = width * 2;
+    f.bpp = 2;
+    f.timestamp = 0;
+    f.domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
+    f.frame_number = 1;
+    f.profile = profile.get();
+    f.depth_units = 0.001f;
+    sensor.on_video_frame( f );
+
+    rs2::frame frame;
+    REQUIRE( q.try_wait_for_frame( &frame, 1000 ) );
+    sensor.stop();
+    sensor.close();
+    return frame;
+}
+
+
+static uint64_t frames_in_place( rs2::filter const & block )
+{
+    auto const stats = block.get_statistics();
+    std::string const key( "\"frames-in-place\":" );
+    auto const pos = stats.find( key );
+    REQUIRE( pos != std::string::npos );
+    return std::strtoull( stats.c_str() + pos + key.length(), nullptr, 10 );
+}
+
+
+static std::vector< uint16_t > pixels_of( rs2::frame const & f )
+{
+    auto data = reinterpret_cast< uint16_t const * >( f.get_data() );
+    return std::vector< uint16_t >( data, data + width * height );
+}
+
+
+TEST_CASE( "threshold" )
+{
+    rs2::software_device dev;
+    auto software_frame = make_depth_frame( dev );
+
+    rs2::threshold_filter threshold( 0.1f, 4.f );
+    rs2::threshold_filter closer( 0.1f, 1.f );
+
+    // Software-device frames do not own their pixels, so are never modified
+    auto f = threshold.process( std::move( software_frame ) );
+    REQUIRE( f );
+    CHECK( frames_in_place( threshold ) == 0 );
+
+    SECTION( "a frame given up is reused" )
+    {
+        auto const data = f.get_data();
+        auto g = closer.process( std::move( f ) );
+        REQUIRE( g );
+        CHECK( frames_in_place( closer ) == 1 );
+        CHECK( g.get_data() == data );
+        for( auto depth : pixels_of( g ) )
+            CHECK( ( depth == 0 || ( depth >= 100 && depth <= 1000 ) ) );
+    }
+
+    SECTION( "a frame held elsewhere is not modified" )
+    {
+        rs2::frame held = f;
+        auto const before = pixels_of( held );
+        auto g = closer.process( std::move( f ) );
+        REQUIRE( g );
+        CHECK( frames_in_place( closer ) == 0 );
+        CHECK( g.get_data() != held.get_data() );
+        CHECK( pixels_of( held ) == before );
+        CHECK( pixels_of( g ) != before );
+    }
+}
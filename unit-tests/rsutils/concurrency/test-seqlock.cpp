@@ -0,0 +1,88 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/seqlock.h>
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+using rsutils::concurrency::seqlock;
+
+
+namespace {
+
+// Odd size, so it does not fill the last word
+struct triplet
+{
+    double a, b;
+    int c;
+};
+
+}  // namespace
+
+
+TEST_CASE( "load what was stored" )
+{
+    seqlock< triplet > s;
+    auto t = s.load();
+    CHECK( t.a == 0 );
+    CHECK( t.b == 0 );
+    CHECK( t.c == 0 );
+
+    s.store( { 1.5, -2., 3 } );
+    t = s.load();
+    CHECK( t.a == 1.5 );
+    CHECK( t.b == -2. );
+    CHECK( t.c == 3 );
+
+    seqlock< int > i( 7 );
+    CHECK( i.load() == 7 );
+}
+
+
+TEST_CASE( "readers never see a partial store" )
+{
+    // The writer keeps all the members equal; readers must never see them differ. The value is wide, so a read that
+    // is not protected would very likely overlap a store.
+    struct wide
+    {
+        uint64_t v[32];
+    };
+    auto make = []( uint64_t i ) {
+        wide w;
+        for( auto & v : w.v )
+            v = i;
+        return w;
+    };
+    seqlock< wide > s( make( 0 ) );
+    std::atomic< bool > done( false );
+    std::atomic< int > torn( 0 );
+
+    std::vector< std::thread > readers;
+    for( int r = 0; r < 3; ++r )
+        readers.emplace_back( [&]() {
+            while( ! done )
+            {
+                auto const w = s.load();
+                for( auto v : w.v )
+                    if( v != w.v[0] )
+                    {
+                        ++torn;
+                        break;
+                    }
+            }
+        } );
+
+    for( uint64_t i = 1; i <= 200000; ++i )
+        s.store( make( i ) );
+    done = true;
+    for( auto & reader : readers )
+        reader.join();
+
+    CHECK( torn == 0 );
+    CHECK( s.load().v[31] == 200000 );
+}
@@ -0,0 +1,87 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/spsc-ring.h>
+
+#include <thread>
+#include <memory>
+
+using rsutils::concurrency::spsc_ring;
+
+
+TEST_CASE( "push until full, pop until empty" )
+{
+    spsc_ring< int > ring( 3 );
+    CHECK( ring.capacity() == 3 );
+    CHECK( ring.empty() );
+
+    CHECK( ring.try_push( 1 ) );
+    CHECK( ring.try_push( 2 ) );
+    CHECK( ring.try_push( 3 ) );
+    CHECK( ring.size() == 3 );
+    CHECK_FALSE( ring.try_push( 4 ) );
+
+    int x = 0;
+    CHECK( ring.try_pop( x ) );
+    CHECK( x == 1 );
+    CHECK( ring.try_push( 4 ) );  // wraps around
+    CHECK( ring.try_pop( x ) );
+    CHECK( x == 2 );
+    CHECK( ring.try_pop( x ) );
+    CHECK( x == 3 );
+    CHECK( ring.try_pop( x ) );
+    CHECK( x == 4 );
+    CHECK_FALSE( ring.try_pop( x ) );
+    CHECK( x == 4 );
+    CHECK( ring.empty() );
+}
+
+
+TEST_CASE( "failed push leaves the item intact" )
+{
+    spsc_ring< std::unique_ptr< int > > ring( 1 );
+    CHECK( ring.try_push( std::unique_ptr< int >( new int( 1 ) ) ) );
+    std::unique_ptr< int > p( new int( 2 ) );
+    CHECK_FALSE( ring.try_push( std::move( p ) ) );
+    REQUIRE( p );
+    CHECK( *p == 2 );
+}
+
+
+TEST_CASE( "one producer, one consumer keep order" )
+{
+    spsc_ring< size_t > ring( 16 );
+    size_t const n = 100000;
+
+    std::thread producer( [&]() {
+        for( size_t i = 1; i <= n; )
+            if( ring.try_push( size_t( i ) ) )
+                ++i;
+            else
+                std::this_thread::yield();
+    } );
+
+    // Whatever we get, we take all n values: otherwise the producer would never finish, and we'd hang on join()
+    size_t expected = 1;
+    size_t n_out_of_order = 0;
+    size_t first_bad = 0;
+    size_t x;
+    while( expected <= n )
+    {
+        if( ! ring.try_pop( x ) )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if( x != expected && ! n_out_of_order++ )
+            first_bad = expected;
+        ++expected;
+    }
+    producer.join();
+    CAPTURE( first_bad );
+    CHECK( n_out_of_order == 0 );
+    CHECK( ring.empty() );
+}
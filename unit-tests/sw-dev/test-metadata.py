@@ -192,5 +192,30 @@ except:
 test.finish()
 #
 #############################################################################################
+#
+test.start( "All metadata in one call" )
+try:
+    with sw.sensor( "Stereo Module" ) as sensor:
+        depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+        sensor.start( depth )
+
+        sensor.set( rs.frame_metadata_value.white_balance, 0xbaad )
+        sensor.set( rs.frame_metadata_value.actual_fps, 0xf00d )
+        f = sensor.publish( depth.frame() )
+
+        all_md = f.get_all_frame_metadata()
+        test.check_equal( all_md.get( rs.frame_metadata_value.white_balance ), 0xbaad )
+        test.check_equal( all_md.get( rs.frame_metadata_value.actual_fps ), 0xf00d )
+        # Same as asking for each, one by one
+        for md in frame_metadata_values():
+            if f.supports_frame_metadata( md ):
+                test.check_equal( all_md.get( md ), f.get_frame_metadata( md ))
+            else:
+                test.check_false( md in all_md )
+except:
+    test.unexpected_exception()
+test.finish()
+#
+#############################################################################################
 test.print_results_and_exit()
 
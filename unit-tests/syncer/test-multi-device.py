@@ -0,0 +1,145 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import time
+
+
+# Two software devices, each with a single depth stream; both stream global timestamps
+#
+fps = 30
+w = 640
+h = 480
+bpp = 2
+pixels = bytearray( b'\x00' * ( w * h * bpp ))
+
+syncer = rs.multi_device_syncer( 100 )  # don't lose any framesets
+
+def add_device():
+    device = rs.software_device()
+    sensor = device.add_sensor( "Depth" )
+    stream = rs.video_stream()
+    stream.type = rs.stream.depth
+    stream.uid = 0
+    stream.width = w
+    stream.height = h
+    stream.bpp = bpp
+    stream.fmt = rs.format.z16
+    stream.fps = fps
+    profile = rs.video_stream_profile( sensor.add_video_stream( stream ))
+    sensor.open( profile )
+    sensor.start( syncer )
+    return device, sensor, profile
+
+devices = [add_device(), add_device()]
+
+def generate( index, frame_number, timestamp ):
+    device, sensor, profile = devices[index]
+    frame = rs.software_video_frame()
+    frame.pixels = pixels
+    frame.stride = w * bpp
+    frame.bpp = bpp
+    frame.frame_number = frame_number
+    frame.timestamp = timestamp
+    frame.domain = rs.timestamp_domain.global_time
+    frame.profile = profile
+    log.d( "--> device", index, frame )
+    sensor.on_video_frame( frame )
+
+def expect( frame_numbers, timeout_ms = 1000 ):
+    """
+    Wait for the next frameset and check that it has exactly the given frame numbers
+    """
+    got, fs = syncer.try_wait_for_frames( timeout_ms )
+    test.check( got )
+    if got:
+        log.d( "Got", fs )
+        test.check_equal( sorted( f.get_frame_number() for f in fs ), sorted( frame_numbers ))
+
+def expect_nothing():
+    got, fs = syncer.try_wait_for_frames( 0 )
+    test.info( "Expected nothing; actual", fs )
+    test.check( not got )
+
+
+#############################################################################################
+#
+test.start( "A device is not waited for before it delivers anything" )
+
+# The syncer knows of no device before its first frame: device 0 is alone, and is released right away. Device 1, once
+# it appears, waits for device 0 until the deadline. Only from here on are both devices known.
+generate( 0, 0, 967 )
+expect( [0] )
+generate( 1, 100, 967 )
+expect( [100] )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Frames of all devices are combined" )
+
+generate( 0, 1, 1000 )
+generate( 1, 101, 1001 )   # less than half a frame apart
+expect( [1, 101] )
+expect_nothing()
+
+generate( 1, 102, 1034 )   # order does not matter
+generate( 0, 2, 1033 )
+expect( [2, 102] )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "A late device is released without, after the deadline" )
+
+syncer.set_option( rs.option.sync_deadline, 200 )
+start = time.time()
+generate( 0, 3, 1066 )
+time.sleep( 0.05 )
+expect_nothing()           # still waiting for device 1
+expect( [3] )
+test.check( time.time() - start >= 0.2 )
+
+# When it finally arrives, device 1 is alone, too
+generate( 1, 103, 1067 )
+expect( [103] )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Tolerance" )
+
+syncer.set_option( rs.option.sync_tolerance, 2 )
+syncer.set_option( rs.option.sync_deadline, 5000 )
+generate( 0, 4, 1100 )
+generate( 1, 104, 1104 )   # too far: device 0 has nothing to wait for
+expect( [4] )
+generate( 0, 5, 1105 )     # within tolerance
+expect( [5, 104] )
+expect_nothing()
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Devices that stopped streaming are not waited for" )
+
+time.sleep( 1.5 )
+generate( 0, 6, 1133 )
+expect( [6], timeout_ms = 500 )  # well before the deadline
+
+test.finish()
+#
+#############################################################################################
+#
+for device, sensor, profile in devices:
+    sensor.stop()
+    sensor.close()
+test.print_results_and_exit()
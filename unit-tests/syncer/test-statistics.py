@@ -0,0 +1,76 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+
+
+sw.fps_c = sw.fps_d = 60
+sw.init()
+sw.start()
+
+decimation = rs.decimation_filter()  # default magnitude 2: 640x480 -> 320x240
+n_frames = 10
+
+
+#############################################################################################
+#
+test.start( "Generate frames and process them" )
+
+sw.generate_depth_and_color( frame_number = 0, timestamp = 0 )
+sw.expect( depth_frame = 0 )
+sw.expect( color_frame = 0, nothing_else = True )
+for i in range( 1, n_frames + 1 ):
+    sw.generate_depth_and_color( i, sw.gap_d * i )
+    fs = sw.syncer.wait_for_frames()
+    depth = fs.get_depth_frame()
+    test.check( depth )
+    decimated = decimation.process( depth )
+    test.check_equal( decimated.as_video_frame().get_width(), 320 )
+    del decimated, depth, fs
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Sensor statistics" )
+
+stats = json.loads( sw.depth_sensor.get_statistics() )
+log.d( stats )
+test.check_equal( stats['frames-produced'], n_frames + 1 )
+test.check_equal( stats['frames-dropped'], 0 )
+# Software frames carry the memory they were given: none is allocated by the library
+test.check_equal( stats['bytes-produced'], 0 )
+test.check_equal( stats['buffers-allocated'] + stats['buffers-recycled'], 0 )
+# Every frame went to the syncer
+test.check_equal( stats['callback']['count'], n_frames + 1 )
+test.check( stats['callback']['max-us'] >= stats['callback']['p50-us'] )
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Processing block statistics" )
+
+stats = json.loads( decimation.get_statistics() )
+log.d( stats )
+test.check_equal( stats['frames-processed'], n_frames )
+test.check_equal( stats['bytes-processed'], n_frames * 640 * 480 * 2 )
+test.check_equal( stats['processing']['count'], n_frames )
+test.check( stats['processing']['mean-us'] > 0 )
+output = stats['output']
+test.check_equal( output['frames-produced'], n_frames )
+test.check_equal( output['bytes-produced'], n_frames * 320 * 240 * 2 )
+# Each output frame was released before the next one, so its memory got reused
+test.check_equal( output['buffers-allocated'] + output['buffers-recycled'], n_frames )
+test.check( output['buffers-recycled'] > 0 )
+test.check_equal( output['frames-in-flight'], 0 )
+
+test.finish()
+#
+#############################################################################################
+sw.stop()
+sw.reset()
+test.print_results_and_exit()
@@ -0,0 +1,61 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import tempfile, json
+
+
+# A context with a 'trace-file' records the pipeline stages of all frames until it is destroyed
+trace_file = tempfile.mktemp( suffix = '.json' )
+log.d( 'tracing to', trace_file )
+ctx = rs.context( { 'trace-file': trace_file } )
+
+sw.fps_c = sw.fps_d = 60
+sw.init()
+sw.start()
+
+
+#############################################################################################
+#
+test.start( "Generate framesets while tracing" )
+
+sw.generate_depth_and_color( frame_number = 0, timestamp = 0 )
+sw.expect( depth_frame = 0 )
+sw.expect( color_frame = 0, nothing_else = True )
+for i in range( 1, 11 ):
+    sw.generate_depth_and_color( i, sw.gap_d * i )
+    sw.expect( depth_frame = i, color_frame = i, nothing_else = True )
+
+sw.stop()
+sw.reset()
+del ctx  # writes the trace
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Trace file is valid Chrome trace JSON" )
+
+with open( trace_file, 'rt' ) as f:
+    trace = json.load( f )
+events = trace['traceEvents']
+test.check_equal( trace['otherData']['dropped-events'], 0 )
+
+# Every frame went through the syncer block...
+spans = [e for e in events if e['ph'] == 'X']
+syncer_frames = [e['args']['frame'] for e in spans if e['name'] == 'syncer' and 'args' in e]
+test.check( all( i in syncer_frames for i in range( 1, 11 )))
+test.check( all( e['dur'] >= 0 for e in spans ))
+
+# ... and waited in it for its counterpart: every wait has a begin and an end
+begins = [e for e in events if e['name'] == 'syncer wait' and e['ph'] == 'b']
+ends = [e for e in events if e['name'] == 'syncer wait' and e['ph'] == 'e']
+test.check( len( begins ) >= 20 )
+test.check_equal( len( begins ), len( ends ))
+
+test.finish()
+#
+#############################################################################################
+test.print_results_and_exit()
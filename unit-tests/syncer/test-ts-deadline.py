@@ -0,0 +1,72 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import json
+import time
+
+
+sw.fps_c = sw.fps_d = 60
+sw.init()
+sw.start()
+
+deadline_ms = 100
+sw.syncer.set_option( rs.option.sync_deadline, deadline_ms )
+
+
+#############################################################################################
+#
+test.start( "Wait for framesets" )
+
+sw.generate_depth_and_color( frame_number = 0, timestamp = 0 )
+sw.expect( depth_frame = 0 )                          # syncer doesn't know about color yet
+sw.expect( color_frame = 0, nothing_else = True )
+sw.generate_depth_and_color( 1, sw.gap_d * 1 )
+sw.expect( depth_frame = 1, color_frame = 1, nothing_else = True )
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "A late stream is not waited for past the deadline" )
+
+# Color is expected with the next Depth frame, so the syncer waits for it...
+sw.generate_depth_frame( 2, sw.gap_d * 2 )
+sw.expect( nothing_else = True )
+
+# ... but only until the deadline: then Depth is released on its own, without any more frames coming in
+time.sleep( 3 * deadline_ms / 1000 )
+sw.expect( depth_frame = 2, nothing_else = True )
+
+# When Color does arrive, there is nothing to match it with anymore
+sw.generate_color_frame( 2, sw.gap_c * 2 )
+sw.expect( color_frame = 2, nothing_else = True )
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Framesets are whole again once both streams arrive" )
+
+sw.generate_depth_and_color( 3, sw.gap_d * 3 )
+sw.expect( depth_frame = 3, color_frame = 3, nothing_else = True )
+
+test.finish()
+#
+#############################################################################################
+#
+test.start( "Wait statistics" )
+
+stats = json.loads( sw.syncer.get_statistics() )['sync']
+log.d( stats )
+test.check_equal( stats['framesets-released'], 6 )  # D0, C0, DC1, D2, C2, DC3
+test.check_equal( stats['framesets-partial'], 1 )   # D2
+test.check_equal( stats['wait']['count'], 6 )
+test.check( stats['wait']['max-us'] >= deadline_ms * 1000 )
+
+test.finish()
+#
+#############################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,288 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/api-trace.h>
+
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+using namespace librealsense;
+
+
+// The trace is always compiled in, and TRACE_API only decides whether the API macros use it; these call through
+// api_call the same way the macros do, so the test runs regardless. The trace is a singleton: each test uses its own
+// function names and looks only at its own lines.
+
+
+// The traced lines of the given function, without the time and thread prefix; how long each call took depends on the
+// machine, so it is removed unless asked for
+static std::vector< std::string > traced( std::string const & function, bool with_duration = false )
+{
+    std::regex const took( R"( /\* Took \d+us \*/)" );
+    std::ostringstream ss;
+    api_trace::instance().dump( ss );
+    std::istringstream lines( ss.str() );
+    std::vector< std::string > result;
+    std::string line;
+    while( std::getline( lines, line ) )
+    {
+        auto const start = line.find( "] " );
+        REQUIRE( start != std::string::npos );
+        line.erase( 0, start + 2 );
+        auto const name = line.find( function + "(" );
+        if( name == 0 || ( name != std::string::npos && line.compare( name - 3, 3, " = " ) == 0 ) )
+            result.push_back( with_duration ? line : std::regex_replace( line, took, "" ) );
+    }
+    return result;
+}
+
+
+static int widgets[4];
+
+static int * create_widget( int index, double scale )
+{
+    static api_function function( "rs2_test_create_widget" );
+    api_call call( function );
+    auto func = [&]() {
+        if( index < 0 )
+            throw std::runtime_error( "bad index" );
+        return &widgets[index];
+    };
+    try
+    {
+        call.set_args( "index, scale", index, scale );
+        return call.invoke( func, api_returns_void( nullptr ) );
+    }
+    catch( ... )
+    {
+        call.fail();
+        return nullptr;
+    }
+}
+
+static int get_widget_value( int * widget, int option )
+{
+    static api_function function( "rs2_test_get_widget_value" );
+    api_call call( function );
+    auto func = [&]() {
+        if( option == 2 )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+        return 40 + option;
+    };
+    call.set_args( "widget, option", widget, option );
+    return call.invoke( func, api_returns_void( 0 ) );
+}
+
+static void set_widget_value( int * widget, float value )
+{
+    static api_function function( "rs2_test_set_widget_value" );
+    api_call call( function );
+    auto func = [&]() {
+    };
+    call.set_args( "widget, value", widget, value );
+    call.invoke( func, api_returns_void() );
+}
+
+static void delete_widget( int * widget )
+{
+    static api_function function( "rs2_delete_test_widget" );
+    api_call call( function );
+    auto func = [&]() {
+    };
+    call.set_args( "widget", widget );
+    call.invoke( func, api_returns_void() );
+}
+
+static int many_args( int a, int b, int c, int d, int e, int f, int g, int h, int i )
+{
+    static api_function function( "rs2_test_many_args" );
+    api_call call( function );
+    auto func = [&]() {
+        return a;
+    };
+    call.set_args( "a, b, c, d, e, f, g, h, i", a, b, c, d, e, f, g, h, i );
+    return call.invoke( func, api_returns_void( 0 ) );
+}
+
+
+TEST_CASE( "api trace dump", "[api-trace]" )
+{
+    auto w = create_widget( 1, 0.5 );
+    CHECK( w == &widgets[1] );
+    CHECK( create_widget( -1, 1 ) == nullptr );
+    CHECK( get_widget_value( w, 3 ) == 43 );
+    CHECK( get_widget_value( nullptr, 2 ) == 42 );
+    set_widget_value( w, 1.5f );
+    delete_widget( w );
+    CHECK( get_widget_value( w, 1 ) == 41 );  // same address, but not the same object any more
+    CHECK( many_args( 1, 2, 3, 4, 5, 6, 7, 8, 9 ) == 1 );
+
+    SECTION( "calls are formatted from their raw values" )
+    {
+        auto create = traced( "rs2_test_create_widget" );
+        REQUIRE( create.size() == 2 );
+        CHECK( create[0] == "widget1 = rs2_test_create_widget(index:1, scale:0.5);" );
+        CHECK( create[1] == "rs2_test_create_widget(index:-1, scale:1); /* FAILED */" );
+
+        auto get = traced( "rs2_test_get_widget_value" );
+        REQUIRE( get.size() == 3 );
+        CHECK( get[0] == "rs2_test_get_widget_value(widget:widget1, option:3) returned 43;" );
+        CHECK( get[1] == "rs2_test_get_widget_value(widget:nullptr, option:2) returned 42;" );
+        CHECK( get[2] == "rs2_test_get_widget_value(widget:widget2, option:1) returned 41;" );
+
+        CHECK( traced( "rs2_test_set_widget_value" ) == std::vector< std::string >{ "rs2_test_set_widget_value(widget:widget1, value:1.5);" } );
+        CHECK( traced( "rs2_delete_test_widget" ) == std::vector< std::string >{ "rs2_delete_test_widget(widget:widget1);" } );
+        CHECK( traced( "rs2_test_many_args" ) == std::vector< std::string >{ "rs2_test_many_args(a:1, b:2, c:3, d:4, e:5, f:6, g:7, h:8, ...) returned 1;" } );
+    }
+    SECTION( "slow calls show how long they took" )
+    {
+        std::regex const took( R"(rs2_test_get_widget_value\(widget:nullptr, option:2\) returned 42; /\* Took (\d+)us \*/)" );
+        std::smatch match;
+        auto const line = traced( "rs2_test_get_widget_value", true )[1];
+        REQUIRE( std::regex_match( line, match, took ) );
+        CHECK( std::stoi( match[1] ) >= 2000 );
+    }
+    SECTION( "each line starts with the time and thread" )
+    {
+        uint32_t other_thread = 0;
+        std::thread( [&]() {
+            other_thread = api_trace::thread_id();
+            get_widget_value( nullptr, 5 );
+        } ).join();
+        CHECK( other_thread != api_trace::thread_id() );
+
+        std::ostringstream ss;
+        api_trace::instance().dump( ss );
+        std::string const dump = ss.str();
+        std::regex const line( R"((^|\n)\d+\.\d{6} \[(\d+)\] rs2_test_get_widget_value\(widget:nullptr, option:5\) returned 45;)" );
+        std::smatch match;
+        REQUIRE( std::regex_search( dump, match, line ) );
+        CHECK( match[2] == std::to_string( other_thread ) );
+    }
+}
+
+
+static void sampled( int i )
+{
+    static api_function function( "rs2_test_sampled" );
+    api_call call( function );
+    auto func = [&]() {
+    };
+    call.set_args( "i", i );
+    call.invoke( func, api_returns_void() );
+}
+
+static void unsampled( int i )
+{
+    static api_function function( "rs2_test_unsampled" );
+    api_call call( function );
+    auto func = [&]() {
+    };
+    call.set_args( "i", i );
+    call.invoke( func, api_returns_void() );
+}
+
+
+TEST_CASE( "api trace sampling", "[api-trace]" )
+{
+    // Before the function is first called, so before it registers
+    api_trace::instance().set_sampling( "rs2_test_sampled", 3 );
+    for( int i = 0; i < 9; ++i )
+        sampled( i );
+    CHECK( traced( "rs2_test_sampled" )
+           == std::vector< std::string >{ "rs2_test_sampled(i:0);", "rs2_test_sampled(i:3);", "rs2_test_sampled(i:6);" } );
+
+    // Others are unaffected
+    unsampled( 0 );
+    unsampled( 1 );
+    CHECK( traced( "rs2_test_unsampled" ).size() == 2 );
+
+    // 0 stops recording, once it was registered, too
+    api_trace::instance().set_sampling( "rs2_test_sampled", 0 );
+    for( int i = 10; i < 20; ++i )
+        sampled( i );
+    CHECK( traced( "rs2_test_sampled" ).size() == 3 );
+
+    api_trace::instance().set_sampling( "rs2_test_sampled", 1 );
+    sampled( 20 );
+    sampled( 21 );
+    auto lines = traced( "rs2_test_sampled" );
+    REQUIRE( lines.size() == 5 );
+    CHECK( lines[3] == "rs2_test_sampled(i:20);" );
+    CHECK( lines[4] == "rs2_test_sampled(i:21);" );
+
+    // No name is for all functions, and overrides what was set per function
+    api_trace::instance().set_sampling( nullptr, 0 );
+    sampled( 22 );
+    unsampled( 2 );
+    api_trace::instance().set_sampling( nullptr, 1 );
+    sampled( 23 );
+    unsampled( 3 );
+    CHECK( traced( "rs2_test_sampled" ).back() == "rs2_test_sampled(i:23);" );
+    CHECK( traced( "rs2_test_unsampled" )
+           == std::vector< std::string >{ "rs2_test_unsampled(i:0);", "rs2_test_unsampled(i:1);", "rs2_test_unsampled(i:3);" } );
+}
+
+
+static void ring( int i, int i3 )
+{
+    static api_function function( "rs2_test_ring" );
+    api_call call( function );
+    auto func = [&]() {
+    };
+    call.set_args( "i, i3", i, i3 );
+    call.invoke( func, api_returns_void() );
+}
+
+
+TEST_CASE( "api trace ring", "[api-trace]" )
+{
+    SECTION( "only the latest calls are kept" )
+    {
+        int const n = int( api_trace::capacity ) + 100;
+        for( int i = 0; i < n; ++i )
+            ring( i, 3 * i );
+        auto lines = traced( "rs2_test_ring" );
+        REQUIRE( lines.size() == api_trace::capacity );
+        CHECK( lines.front() == "rs2_test_ring(i:100, i3:300);" );
+        CHECK( lines.back() == "rs2_test_ring(i:" + std::to_string( n - 1 ) + ", i3:" + std::to_string( 3 * ( n - 1 ) ) + ");" );
+    }
+    SECTION( "dumps do not see records that are being written" )
+    {
+        // Writers keep overwriting the ring while we dump: whatever is dumped must be whole
+        std::atomic< bool > stop( false );
+        std::vector< std::thread > writers;
+        for( int t = 0; t < 3; ++t )
+            writers.emplace_back( [&]() {
+                for( int i = 0; ! stop; ++i )
+                    ring( i, 3 * i );
+            } );
+        std::regex const line( R"(rs2_test_ring\(i:(\d+), i3:(\d+)\);)" );
+        size_t n_lines = 0, n_torn = 0;
+        std::string first_torn;
+        for( int d = 0; d < 20; ++d )
+        {
+            for( auto & l : traced( "rs2_test_ring" ) )
+            {
+                ++n_lines;
+                std::smatch match;
+                if( ! std::regex_match( l, match, line ) || std::stoll( match[2] ) != 3 * std::stoll( match[1] ) )
+                {
+                    if( ! n_torn++ )
+                        first_torn = l;
+                }
+            }
+        }
+        stop = true;
+        for( auto & w : writers )
+            w.join();
+        CHECK( n_lines > 0 );
+        CAPTURE( first_torn );
+        CHECK( n_torn == 0 );
+    }
+}
@@ -0,0 +1,80 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+//#cmake:add-file ../../src/device-descriptor-cache.cpp
+
+#include <unit-tests/test.h>
+#include <src/device-descriptor-cache.h>
+#include <rsutils/os/special-folder.h>
+
+#include <cstdio>
+
+using librealsense::device_descriptor_cache;
+
+
+static std::string const directory = rsutils::os::get_special_folder( rsutils::os::special_folder::temp_folder );
+static device_descriptor_cache::key const k{ "123456789012", "5.16.0.1", "/sys/devices/pci0000:00/usb2/2-1" };
+static std::vector< uint8_t > const table{ 0x14, 0x00, 0x01, 0xfe, 0x7f };
+
+
+TEST_CASE( "disabled by default" )
+{
+    CHECK_FALSE( device_descriptor_cache::open( rsutils::json::object(), k ) );
+    rsutils::json settings;
+    settings["descriptor-cache"]["enabled"] = true;
+    settings["descriptor-cache"]["directory"] = directory;
+    CHECK( device_descriptor_cache::open( settings, k ) );
+    CHECK_FALSE( device_descriptor_cache::open( settings, { "", "5.16.0.1", "" } ) );
+}
+
+
+TEST_CASE( "entries persist" )
+{
+    {
+        device_descriptor_cache cache( directory, k );
+        cache.clear();
+        std::vector< uint8_t > data;
+        CHECK_FALSE( cache.get( "coefficients", data ) );
+        cache.set( "coefficients", table );
+        CHECK( cache.get( "coefficients", data ) );
+        CHECK( data == table );
+    }
+    {
+        device_descriptor_cache cache( directory, k );
+        std::vector< uint8_t > data;
+        REQUIRE( cache.get( "coefficients", data ) );
+        CHECK( data == table );
+        cache.forget( "coefficients" );
+        CHECK_FALSE( cache.get( "coefficients", data ) );
+    }
+    {
+        device_descriptor_cache cache( directory, k );
+        std::vector< uint8_t > data;
+        CHECK_FALSE( cache.get( "coefficients", data ) );
+    }
+    std::remove( device_descriptor_cache( directory, k ).get_filename().c_str() );
+}
+
+
+TEST_CASE( "stale entries are ignored" )
+{
+    {
+        device_descriptor_cache cache( directory, k );
+        cache.set( "coefficients", table );
+    }
+    std::vector< uint8_t > data;
+    {
+        auto other_fw = k;
+        other_fw.firmware_version = "5.16.0.2";
+        device_descriptor_cache cache( directory, other_fw );
+        CHECK_FALSE( cache.get( "coefficients", data ) );
+    }
+    {
+        auto other_port = k;
+        other_port.path = "/sys/devices/pci0000:00/usb2/2-2";
+        device_descriptor_cache cache( directory, other_port );
+        CHECK_FALSE( cache.get( "coefficients", data ) );
+    }
+    std::remove( device_descriptor_cache( directory, k ).get_filename().c_str() );
+}
@@ -0,0 +1,141 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <unit-tests/test.h>
+#include <src/device-batch-open.h>
+#include <src/device-info.h>
+
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+
+using namespace librealsense;
+using namespace std::chrono;
+
+
+// No actual device is created: create_device() just takes some time, in two phases, and may fail
+class fake_device_info : public device_info
+{
+    std::string const _name;
+    milliseconds const _delay;
+    bool const _fail;
+
+public:
+    static std::atomic< int > n_creating;
+    static std::atomic< int > max_creating;
+    bool had_phases = false;
+
+    fake_device_info( std::string const & name, milliseconds delay, bool fail = false )
+        : device_info( nullptr )
+        , _name( name )
+        , _delay( delay )
+        , _fail( fail )
+    {
+    }
+
+    std::string get_address() const override { return _name; }
+    bool is_same_as( std::shared_ptr< const device_info > const & other ) const override
+    {
+        return other.get() == this;
+    }
+
+    std::shared_ptr< device_interface > create_device() override
+    {
+        auto const n = ++n_creating;
+        int prev = max_creating;
+        while( n > prev && ! max_creating.compare_exchange_weak( prev, n ) )
+            ;
+        had_phases = !! get_device_open_phases();
+        mark_device_open_phase( "first" );
+        std::this_thread::sleep_for( _delay );
+        mark_device_open_phase( "second" );
+        std::this_thread::sleep_for( _delay );
+        --n_creating;
+        if( _fail )
+            throw std::runtime_error( _name + " failed" );
+        return nullptr;
+    }
+};
+std::atomic< int > fake_device_info::n_creating( 0 );
+std::atomic< int > fake_device_info::max_creating( 0 );
+
+
+static std::vector< std::shared_ptr< device_info > > make_infos( size_t n, milliseconds delay, size_t failing = size_t( -1 ) )
+{
+    std::vector< std::shared_ptr< device_info > > infos;
+    for( size_t i = 0; i < n; ++i )
+        infos.push_back( std::make_shared< fake_device_info >( "dev" + std::to_string( i ), delay, i == failing ) );
+    fake_device_info::max_creating = 0;
+    return infos;
+}
+
+
+TEST_CASE( "a failure does not affect the others" )
+{
+    auto infos = make_infos( 4, milliseconds( 1 ), 2 );
+    auto results = create_devices( infos );
+    REQUIRE( results.size() == infos.size() );
+    for( size_t i = 0; i < results.size(); ++i )
+    {
+        CAPTURE( i );
+        CHECK( results[i].info == infos[i] );  // in list order
+        CHECK( !! results[i].exception == ( i == 2 ) );
+    }
+    CHECK_THROWS( std::rethrow_exception( results[2].exception ) );
+}
+
+
+TEST_CASE( "devices are created concurrently" )
+{
+    auto infos = make_infos( 4, milliseconds( 50 ) );
+    auto const start = steady_clock::now();
+    create_devices( infos );
+    auto const elapsed = steady_clock::now() - start;
+    CHECK( fake_device_info::max_creating == 4 );
+    CHECK( elapsed < milliseconds( 4 * 100 ) );
+}
+
+
+TEST_CASE( "max-threads" )
+{
+    auto infos = make_infos( 4, milliseconds( 10 ) );
+    create_devices( infos, 2 );
+    CHECK( fake_device_info::max_creating == 2 );
+
+    infos = make_infos( 4, milliseconds( 10 ) );
+    create_devices( infos, 1 );
+    CHECK( fake_device_info::max_creating == 1 );
+}
+
+
+TEST_CASE( "phases" )
+{
+    auto infos = make_infos( 2, milliseconds( 20 ), 1 );
+    auto results = create_devices( infos );
+    for( auto & result : results )
+    {
+        CHECK( std::static_pointer_cast< fake_device_info >( result.info )->had_phases );
+        REQUIRE( result.phases.size() == 4 );
+        CHECK( result.phases[0].name == "queued" );
+        CHECK( result.phases[1].name == "create" );
+        CHECK( result.phases[2].name == "first" );
+        CHECK( result.phases[2].duration >= milliseconds( 20 ) );
+        CHECK( result.phases[3].name == "second" );
+        CHECK( result.phases[3].duration >= milliseconds( 20 ) );  // even if it failed
+    }
+
+    // Outside of creation, nothing is recorded
+    CHECK_FALSE( get_device_open_phases() );
+    CHECK_NOTHROW( mark_device_open_phase( "nothing" ) );
+}
+
+
+TEST_CASE( "single device" )
+{
+    auto infos = make_infos( 2, milliseconds( 1 ), 1 );
+    CHECK_NOTHROW( create_device_with_phases( infos[0] ) );
+    CHECK( std::static_pointer_cast< fake_device_info >( infos[0] )->had_phases );
+    CHECK_THROWS( create_device_with_phases( infos[1] ) );
+}
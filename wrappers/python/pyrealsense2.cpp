@@ -44,6 +44,10 @@ PYBIND11_MODULE(NAME, m) {
     m.def("log_to_file", &rs2::log_to_file, "min_severity"_a, "file_path"_a);
     m.def("reset_logger", &rs2::reset_logger);
     m.def("enable_rolling_log_file", &rs2::enable_rolling_log_file, "max_size"_a);
+    m.def("enable_async_logging", &rs2::enable_async_logging, "queue_size"_a = 4096);
+    m.def("get_log_drop_count", &rs2::get_log_drop_count);
+    m.def("set_api_trace_sampling", &rs2::set_api_trace_sampling, "function_name"_a, "every_nth"_a);
+    m.def("dump_api_trace", &rs2::dump_api_trace, "file_path"_a = nullptr);
 
     // Access to log_message is only from a callback (see log_to_callback below) and so already
     // should have the GIL acquired
@@ -30,6 +30,8 @@ void init_device(py::module &m) {
         .def("__nonzero__", &rs2::device::operator bool) // Called to implement truth value testing in Python 2
         .def("__bool__", &rs2::device::operator bool) // Called to implement truth value testing in Python 3
         .def( "is_connected", &rs2::device::is_connected )
+        .def( "get_statistics", &rs2::device::get_statistics, "Retrieves statistics of the device (e.g., the time spent in "
+              "each phase of its creation), as a JSON string." )
         .def(BIND_DOWNCAST(device, debug_protocol))
         .def(BIND_DOWNCAST(device, playback))
         .def(BIND_DOWNCAST(device, recorder))
@@ -289,6 +291,13 @@ void init_device(py::module &m) {
             }
             return dlist;
         })
+        .def("create_all", []( const rs2::device_list& self ) {
+            std::vector< std::string > errors;
+            auto devices = self.create_all( &errors );
+            return std::make_tuple( devices, errors );
+        }, "Create all the devices in the list, initializing them concurrently. Returns a tuple of (devices, errors): "
+           "a device that could not be created is empty (evaluates to False), with the reason in its errors entry",
+           py::call_guard< py::gil_scoped_release >() )
         .def("front", &rs2::device_list::front) // No docstring in C++
         .def("back", &rs2::device_list::back); // No docstring in C++
 
@@ -5,6 +5,7 @@ Copyright(c) 2017 Intel Corporation. All Rights Reserved. */
 #include <librealsense2/rs.hpp>
 
 #include <rsutils/string/from.h>
+#include <map>
 #include <src/image.cpp>  // bad idea? for get_image_bpp
 
 
@@ -140,6 +141,12 @@ void init_frame(py::module &m) {
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
         .def("get_frame_metadata", &rs2::frame::get_frame_metadata, "Retrieve the current value of a single frame_metadata.", "frame_metadata"_a)
         .def("supports_frame_metadata", &rs2::frame::supports_frame_metadata, "Determine if the device allows a specific metadata to be queried.", "frame_metadata"_a)
+        .def("get_all_frame_metadata", []( const rs2::frame & self ) {
+                std::map< rs2_frame_metadata_value, rs2_metadata_type > results;
+                for( auto & entry : self.get_all_frame_metadata() )
+                    results[entry.key] = entry.value;
+                return results;
+            }, "Retrieve all the metadata the frame supports, as a dictionary of frame_metadata to value, in one call.")
         .def("get_frame_number", &rs2::frame::get_frame_number, "Retrieve the frame number.")
         .def_property_readonly("frame_number", &rs2::frame::get_frame_number, "The frame number. Identical to calling get_frame_number.")
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
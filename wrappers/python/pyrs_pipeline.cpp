@@ -170,6 +170,8 @@ void init_pipeline(py::module &m) {
             return std::make_tuple(success, fs);
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>())
         .def("get_active_profile", &rs2::pipeline::get_active_profile) // No docstring in C++
+        .def("get_statistics", &rs2::pipeline::get_statistics, "Return runtime statistics of the syncer, the aggregator and the "
+             "streaming sensors used by the pipeline, as a JSON string. Valid only between start() and stop().")
         .def( "set_device", &rs2::pipeline::set_device,
               "The function is used to assign the device, useful when the user wish to set controls that cannot be set while streaming. ",
               "device"_a );
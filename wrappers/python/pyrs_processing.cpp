@@ -56,6 +56,7 @@ void init_processing(py::module &m) {
             self.start(f);
         }, "Start the processing block with callback function to inform the application the frame is processed.", "callback"_a)
         .def("invoke", &rs2::processing_block::invoke, "Ask processing block to process the frame", "f"_a)
+        .def("get_statistics", &rs2::processing_block::get_statistics, "Retrieves runtime statistics of the processing block, as a JSON string.")
         .def("supports", (bool (rs2::processing_block::*)(rs2_camera_info) const) &rs2::processing_block::supports, "Check if a specific camera info field is supported.")
         .def("get_info", &rs2::processing_block::get_info, "Retrieve camera specific information, like versions of various internal components.");
         /*.def("__call__", &rs2::processing_block::operator(), "f"_a)*/
@@ -131,9 +132,41 @@ void init_processing(py::module &m) {
         .def( "try_wait_for_frame",  // same, but with a name that matches frame_queue!
               wait_for_frame,
               "timeout_ms"_a = 5000,
-              py::call_guard< py::gil_scoped_release >() );
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "set_option", &rs2::syncer::set_option, "option"_a, "value"_a )
+        .def( "get_option", &rs2::syncer::get_option, "option"_a )
+        .def( "get_statistics", &rs2::syncer::get_statistics,
+              "Retrieves runtime statistics of the syncer, including how long framesets waited, as a JSON string." );
       /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
+    py::class_< rs2::multi_device_syncer > multi_device_syncer( m, "multi_device_syncer",
+                                                               "Sync instance to combine frames from several devices, "
+                                                               "by their global timestamps" );
+    auto md_poll_for_frame = []( const rs2::multi_device_syncer & self ) {
+        rs2::frameset frames;
+        self.poll_for_frames( &frames );
+        return frames;
+    };
+    auto md_wait_for_frame = []( const rs2::multi_device_syncer & self, unsigned int timeout_ms ) {
+        rs2::frameset fs;
+        auto success = self.try_wait_for_frames( &fs, timeout_ms );
+        return std::make_tuple( success, fs );
+    };
+    multi_device_syncer
+        .def( py::init< int, float, float >(), "queue_size"_a = 1, "tolerance_ms"_a = 0.f, "deadline_ms"_a = 100.f )
+        .def( "wait_for_frames",
+              &rs2::multi_device_syncer::wait_for_frames,
+              "Wait until a set of frames from all devices becomes available",
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "poll_for_frames", md_poll_for_frame, "Check if a set of frames from all devices is available" )
+        .def( "try_wait_for_frames",
+              md_wait_for_frame,
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "set_option", &rs2::multi_device_syncer::set_option, "option"_a, "value"_a )
+        .def( "get_option", &rs2::multi_device_syncer::get_option, "option"_a );
+
     py::class_<rs2::align, rs2::filter> align(m, "align", "Performs alignment between depth image and another image.");
     align.def(py::init<rs2_stream>(), "To perform alignment of a depth image to the other, set the align_to parameter with the other stream type.\n"
               "To perform alignment of a non depth image to a depth image, set the align_to parameter to RS2_STREAM_DEPTH.\n"
@@ -57,12 +57,16 @@ void init_sensor(py::module &m) {
         .def("start", [](const rs2::sensor& self, rs2::syncer& syncer) {
             self.start(syncer);
         }, "Start passing frames into user provided syncer.", "syncer"_a, py::call_guard< py::gil_scoped_release >())
+        .def("start", [](const rs2::sensor& self, rs2::multi_device_syncer& syncer) {
+            self.start(syncer);
+        }, "Start passing frames into user provided multi-device syncer.", "syncer"_a, py::call_guard< py::gil_scoped_release >())
         .def("start", [](const rs2::sensor& self, rs2::frame_queue& queue) {
             self.start(queue);
         }, "start passing frames into specified frame_queue", "queue"_a, py::call_guard< py::gil_scoped_release >())
         .def("stop", &rs2::sensor::stop, "Stop streaming.", py::call_guard<py::gil_scoped_release>())
         .def("get_stream_profiles", &rs2::sensor::get_stream_profiles, "Retrieves the list of stream profiles supported by the sensor.")
         .def("get_active_streams", &rs2::sensor::get_active_streams, "Retrieves the list of stream profiles currently streaming on the sensor.")
+        .def("get_statistics", &rs2::sensor::get_statistics, "Retrieves runtime statistics of the frames the sensor produced, as a JSON string.")
         .def_property_readonly("profiles", &rs2::sensor::get_stream_profiles, "The list of stream profiles supported by the sensor. Identical to calling get_stream_profiles")
         .def("get_recommended_filters", &rs2::sensor::get_recommended_filters, "Return the recommended list of filters by the sensor.")
         .def(py::init<>())